@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/atomic_name.h>
+#include <quicr/name.h>
+
+#include <mutex>
+
+namespace
+{
+/**
+ * The mutex protected Name that atomic_name replaces.
+ */
+class locked_name
+{
+  public:
+    quicr::Name load()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _name;
+    }
+
+    quicr::Name fetch_add(std::uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const quicr::Name name = _name;
+        _name += value;
+        return name;
+    }
+
+    bool advance(quicr::Name name)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!(_name < name)) return false;
+        _name = name;
+        return true;
+    }
+
+  private:
+    std::mutex _mutex;
+    quicr::Name _name = 0xA11CEE00F00001000000000000000000_name;
+};
+
+quicr::atomic_name shared_atomic = 0xA11CEE00F00001000000000000000000_name;
+locked_name shared_locked;
+} // namespace
+
+static void AtomicName_Load(benchmark::State& state)
+{
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(shared_atomic.load());
+    }
+}
+
+static void LockedName_Load(benchmark::State& state)
+{
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(shared_locked.load());
+    }
+}
+
+static void AtomicName_FetchAdd(benchmark::State& state)
+{
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(shared_atomic.fetch_add(1));
+    }
+}
+
+static void LockedName_FetchAdd(benchmark::State& state)
+{
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(shared_locked.fetch_add(1));
+    }
+}
+
+static void AtomicName_Advance(benchmark::State& state)
+{
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name + state.thread_index();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(shared_atomic.advance(name += state.threads()));
+    }
+}
+
+static void LockedName_Advance(benchmark::State& state)
+{
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name + state.thread_index();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(shared_locked.advance(name += state.threads()));
+    }
+}
+
+BENCHMARK(AtomicName_Load)->ThreadRange(1, 8);
+BENCHMARK(LockedName_Load)->ThreadRange(1, 8);
+BENCHMARK(AtomicName_FetchAdd)->ThreadRange(1, 8);
+BENCHMARK(LockedName_FetchAdd)->ThreadRange(1, 8);
+BENCHMARK(AtomicName_Advance)->ThreadRange(1, 8);
+BENCHMARK(LockedName_Advance)->ThreadRange(1, 8);
@@ -0,0 +1,241 @@
+#include "workload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <quicr/hex_endec.h>
+#include <quicr/name.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/*
+ * Throughput of converting names to and from strings, bytes and fields, over
+ * corpora of generated names. Each iteration converts the whole corpus, and
+ * reports both items and bytes per second, so that regressions show up as
+ * lower throughput.
+ */
+namespace
+{
+enum class Corpus
+{
+    // Random names, formatted with 0x and all 32 digits.
+    random,
+    // Random names, formatted with all 32 digits but without 0x.
+    random_no_prefix,
+    // Consecutive names, formatted with 0x and all 32 digits.
+    sequential,
+    // Names of 1 to 128 significant bits, formatted with 0x and without leading zeros.
+    mixed_length,
+    // Names of 1 to 128 significant bits, formatted without 0x nor leading zeros.
+    mixed_length_no_prefix,
+};
+
+constexpr std::size_t corpus_size = 4096;
+
+using layout = workload::conference_layout::hex_endec;
+
+std::vector<quicr::Name> make_names(Corpus corpus)
+{
+    switch (corpus)
+    {
+        case Corpus::sequential:
+            return workload::sequential_names(corpus_size);
+        case Corpus::mixed_length:
+        case Corpus::mixed_length_no_prefix:
+            return workload::mixed_length_names(corpus_size);
+        default:
+            return workload::random_names(corpus_size);
+    }
+}
+
+std::vector<std::string> make_strings(Corpus corpus)
+{
+    const bool prefix = corpus != Corpus::random_no_prefix && corpus != Corpus::mixed_length_no_prefix;
+    const bool padded = corpus != Corpus::mixed_length && corpus != Corpus::mixed_length_no_prefix;
+    return workload::hex_strings(make_names(corpus), prefix, padded);
+}
+
+std::size_t total_length(const std::vector<std::string>& strings)
+{
+    std::size_t length = 0;
+    for (const auto& str : strings)
+        length += str.size();
+
+    return length;
+}
+
+void Codec_Parse(benchmark::State& state, Corpus corpus)
+{
+    const auto strings = make_strings(corpus);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& str : strings)
+        {
+            auto result = quicr::Name::parse(str);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * strings.size());
+    state.SetBytesProcessed(state.iterations() * total_length(strings));
+}
+
+void Codec_FromChars(benchmark::State& state, Corpus corpus)
+{
+    const auto strings = make_strings(corpus);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& str : strings)
+        {
+            quicr::Name name;
+            auto result = from_chars(str.data(), str.data() + str.size(), name);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(name);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * strings.size());
+    state.SetBytesProcessed(state.iterations() * total_length(strings));
+}
+
+void Codec_Format(benchmark::State& state, Corpus corpus)
+{
+    const auto names = make_names(corpus);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& name : names)
+        {
+            const std::string str = name;
+            benchmark::DoNotOptimize(str);
+        }
+    }
+
+    // Formatting always writes 0x and all 32 digits.
+    state.SetItemsProcessed(state.iterations() * names.size());
+    state.SetBytesProcessed(state.iterations() * names.size() * (2 + sizeof(quicr::Name) * 2));
+}
+
+void Codec_FromBytes(benchmark::State& state, Corpus corpus)
+{
+    const auto names = make_names(corpus);
+    std::vector<std::uint8_t> bytes(names.size() * sizeof(quicr::Name));
+    std::memcpy(bytes.data(), names.data(), bytes.size());
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (std::size_t offset = 0; offset < bytes.size(); offset += sizeof(quicr::Name))
+        {
+            const quicr::Name name(bytes.data() + offset, sizeof(quicr::Name));
+            benchmark::DoNotOptimize(name);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * names.size());
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+void Codec_ToBytes(benchmark::State& state, Corpus corpus)
+{
+    // Names are serialized as their bytes in the order of the machine, which the byte constructor reads back.
+    const auto names = make_names(corpus);
+    std::vector<std::uint8_t> bytes(names.size() * sizeof(quicr::Name));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::uint8_t* out = bytes.data();
+        for (const auto& name : names)
+        {
+            std::memcpy(out, &name, sizeof(name));
+            out += sizeof(name);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * names.size());
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+void Codec_HexEndecEncode(benchmark::State& state, Corpus corpus)
+{
+    const auto names = make_names(corpus);
+    std::vector<std::array<std::uint64_t, 6>> fields;
+    for (const auto& name : names)
+        fields.push_back(layout::Decode(name));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& f : fields)
+            benchmark::DoNotOptimize(layout::Encode(f[0], f[1], f[2], f[3], f[4], f[5]));
+    }
+
+    state.SetItemsProcessed(state.iterations() * fields.size());
+    state.SetBytesProcessed(state.iterations() * fields.size() * sizeof(quicr::Name));
+}
+
+void Codec_HexEndecEncodeName(benchmark::State& state, Corpus corpus)
+{
+    const auto names = make_names(corpus);
+    std::vector<std::array<std::uint64_t, 6>> fields;
+    for (const auto& name : names)
+        fields.push_back(layout::Decode(name));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& f : fields)
+            benchmark::DoNotOptimize(layout::EncodeName(f[0], f[1], f[2], f[3], f[4], f[5]));
+    }
+
+    state.SetItemsProcessed(state.iterations() * fields.size());
+    state.SetBytesProcessed(state.iterations() * fields.size() * sizeof(quicr::Name));
+}
+
+void Codec_HexEndecDecode(benchmark::State& state, Corpus corpus)
+{
+    const auto names = make_names(corpus);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& name : names)
+            benchmark::DoNotOptimize(layout::Decode(name));
+    }
+
+    state.SetItemsProcessed(state.iterations() * names.size());
+    state.SetBytesProcessed(state.iterations() * names.size() * sizeof(quicr::Name));
+}
+
+void Codec_HexEndecDecodeString(benchmark::State& state, Corpus corpus)
+{
+    const auto strings = make_strings(corpus);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& str : strings)
+            benchmark::DoNotOptimize(layout::Decode(str.c_str()));
+    }
+
+    state.SetItemsProcessed(state.iterations() * strings.size());
+    state.SetBytesProcessed(state.iterations() * total_length(strings));
+}
+} // namespace
+
+#define CODEC_BENCHMARK(func)                                                                                          \
+    BENCHMARK_CAPTURE(func, random, Corpus::random);                                                                   \
+    BENCHMARK_CAPTURE(func, sequential, Corpus::sequential)
+
+#define CODEC_STRING_BENCHMARK(func)                                                                                   \
+    CODEC_BENCHMARK(func);                                                                                             \
+    BENCHMARK_CAPTURE(func, random_no_prefix, Corpus::random_no_prefix);                                               \
+    BENCHMARK_CAPTURE(func, mixed_length, Corpus::mixed_length);                                                       \
+    BENCHMARK_CAPTURE(func, mixed_length_no_prefix, Corpus::mixed_length_no_prefix)
+
+CODEC_STRING_BENCHMARK(Codec_Parse);
+CODEC_STRING_BENCHMARK(Codec_FromChars);
+CODEC_STRING_BENCHMARK(Codec_HexEndecDecodeString);
+CODEC_BENCHMARK(Codec_Format);
+CODEC_BENCHMARK(Codec_FromBytes);
+CODEC_BENCHMARK(Codec_ToBytes);
+CODEC_BENCHMARK(Codec_HexEndecEncode);
+CODEC_BENCHMARK(Codec_HexEndecEncodeName);
+CODEC_BENCHMARK(Codec_HexEndecDecode);
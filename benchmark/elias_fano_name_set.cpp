@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/elias_fano_name_set.h>
+#include <quicr/name.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr quicr::Name base_name = 0xA11CEE00F00001000000000000000000_name;
+
+/**
+ * Sorted object names with gaps of up to max_gap between them.
+ */
+std::vector<quicr::Name> make_names(std::size_t count, std::uint64_t max_gap)
+{
+    std::mt19937_64 rng(0x5EED);
+    std::vector<quicr::Name> names(count);
+    quicr::Name name = base_name;
+    for (auto& n : names)
+        n = name += 1 + rng() % max_gap;
+    return names;
+}
+
+void EliasFano_Build(benchmark::State& state)
+{
+    const auto names = make_names(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        quicr::elias_fano_name_set set(names.begin(), names.end());
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Lookup>
+void run_lookup(benchmark::State& state, Lookup&& lookup)
+{
+    const auto names = make_names(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+    const quicr::elias_fano_name_set set(names.begin(), names.end());
+
+    std::mt19937_64 rng(1);
+    const quicr::Name span = names.back() - names.front();
+    std::vector<quicr::Name> probes(4096);
+    for (auto& probe : probes)
+        probe = names.front() + rng() % (std::uint64_t(span) + 1);
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(lookup(set, probes[i++ % probes.size()]));
+
+    state.counters["bytes_per_name"] = static_cast<double>(set.memory_usage()) / static_cast<double>(set.size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+void EliasFano_Successor(benchmark::State& state)
+{
+    run_lookup(state, [](const auto& set, const quicr::Name& name) { return set.successor(name); });
+}
+
+void EliasFano_Contains(benchmark::State& state)
+{
+    run_lookup(state, [](const auto& set, const quicr::Name& name) { return set.contains(name); });
+}
+
+void EliasFano_Iterate(benchmark::State& state)
+{
+    const auto names = make_names(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+    const quicr::elias_fano_name_set set(names.begin(), names.end());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (auto name : set)
+            benchmark::DoNotOptimize(name);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void SortedVector_Successor(benchmark::State& state)
+{
+    const auto names = make_names(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+
+    std::mt19937_64 rng(1);
+    const quicr::Name span = names.back() - names.front();
+    std::vector<quicr::Name> probes(4096);
+    for (auto& probe : probes)
+        probe = names.front() + rng() % (std::uint64_t(span) + 1);
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(std::lower_bound(names.begin(), names.end(), probes[i++ % probes.size()]));
+
+    state.counters["bytes_per_name"] = sizeof(quicr::Name);
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+// Arguments are the number of names, and the maximum gap between consecutive names.
+BENCHMARK(EliasFano_Build)->ArgsProduct({ { 10'000'000 }, { 1, 16, 4096 } })->Unit(benchmark::kMillisecond);
+BENCHMARK(EliasFano_Successor)->ArgsProduct({ { 1'000'000, 100'000'000 }, { 1, 16, 4096 } });
+BENCHMARK(EliasFano_Contains)->ArgsProduct({ { 1'000'000, 100'000'000 }, { 1, 16, 4096 } });
+BENCHMARK(EliasFano_Iterate)->ArgsProduct({ { 10'000'000 }, { 1, 4096 } })->Unit(benchmark::kMillisecond);
+BENCHMARK(SortedVector_Successor)->ArgsProduct({ { 1'000'000, 100'000'000 }, { 1, 16, 4096 } });
@@ -4,20 +4,24 @@
 #include <quicr/name.h>
 
 #include <cstdint>
+#include <string>
+#include <vector>
 
 static void HexEndec_Encode4x32_to_128(benchmark::State& state)
 {
     for ([[maybe_unused]] auto _ : state)
     {
-        quicr::HexEndec<128, 32, 32, 32, 32>::Encode(0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU);
+        benchmark::DoNotOptimize(
+          quicr::HexEndec<128, 32, 32, 32, 32>::Encode(0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU));
     }
 }
 
 static void HexEndec_Decode128_to_4x32(benchmark::State& state)
 {
+    const std::string hex = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
     for ([[maybe_unused]] auto _ : state)
     {
-        quicr::HexEndec<128, 32, 32, 32, 32>::Decode("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+        benchmark::DoNotOptimize(quicr::HexEndec<128, 32, 32, 32, 32>::Decode(hex.c_str()));
     }
 }
 
@@ -25,15 +29,16 @@ static void HexEndec_Encode4x16_to_64(benchmark::State& state)
 {
     for ([[maybe_unused]] auto _ : state)
     {
-        quicr::HexEndec<64, 16, 16, 16, 16>::Encode(0xFFFFU, 0xFFFFU, 0xFFFFU, 0xFFFFU);
+        benchmark::DoNotOptimize(quicr::HexEndec<64, 16, 16, 16, 16>::Encode(0xFFFFU, 0xFFFFU, 0xFFFFU, 0xFFFFU));
     }
 }
 
 static void HexEndec_Decode64_to_4x16(benchmark::State& state)
 {
+    const std::string hex = "0xFFFFFFFFFFFFFFFF";
     for ([[maybe_unused]] auto _ : state)
     {
-        quicr::HexEndec<64, 16, 16, 16, 16>::Decode("0xFFFFFFFFFFFFFFFF");
+        benchmark::DoNotOptimize(quicr::HexEndec<64, 16, 16, 16, 16>::Decode(hex.c_str()));
     }
 }
 
@@ -47,25 +52,175 @@ static void HexEndec_RealEncode(benchmark::State& state)
     const uint64_t uniqueId = 0U;
     for ([[maybe_unused]] auto _ : state)
     {
-        quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Encode(orgId, appId, confId, mediaType, clientId, uniqueId);
+        benchmark::DoNotOptimize(
+          quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Encode(orgId, appId, confId, mediaType, clientId, uniqueId));
+    }
+}
+
+static void HexEndec_RealEncode_ToName(benchmark::State& state)
+{
+    uint32_t orgId = 0x00A11CEE;
+    uint8_t appId = 0x00;
+    uint32_t confId = 0x00F00001;
+    uint8_t mediaType = 0x00U | 0x1U;
+    uint16_t clientId = 0xFFFF;
+    uint64_t uniqueId = 0U;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(uniqueId);
+        const std::string hex =
+          quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Encode(orgId, appId, confId, mediaType, clientId, uniqueId);
+        benchmark::DoNotOptimize(quicr::Name(hex.c_str()));
+    }
+}
+
+static void HexEndec_RealEncodeName(benchmark::State& state)
+{
+    uint32_t orgId = 0x00A11CEE;
+    uint8_t appId = 0x00;
+    uint32_t confId = 0x00F00001;
+    uint8_t mediaType = 0x00U | 0x1U;
+    uint16_t clientId = 0xFFFF;
+    uint64_t uniqueId = 0U;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(uniqueId);
+        benchmark::DoNotOptimize(
+          quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::EncodeName(orgId, appId, confId, mediaType, clientId, uniqueId));
     }
 }
 
 static void HexEndec_RealDecode_Name(benchmark::State& state)
 {
-    const quicr::Name qname = 0xA11CEE00F00001000000000000000000_name;
+    quicr::Name qname = 0xA11CEE00F00001000000000000000000_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] auto s = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Decode(qname);
+        benchmark::DoNotOptimize(qname);
+        benchmark::DoNotOptimize(quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Decode(qname));
     }
 }
+static void HexEndec_RealDecode_NameField(benchmark::State& state)
+{
+    quicr::Name qname = 0xA11CEE00F00001000000000000000000_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(qname);
+        benchmark::DoNotOptimize(quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Decode<2>(qname));
+    }
+}
+
 static void HexEndec_RealDecode_String(benchmark::State& state)
 {
-    const quicr::Name qname = 0xA11CEE00F00001000000000000000000_name;
+    const std::string hex = "0xA11CEE00F00001000000000000000000";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] auto s = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Decode(qname);
+        benchmark::DoNotOptimize(quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::Decode(hex.c_str()));
+    }
+}
+
+using RealHexEndec = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>;
+
+struct RealColumns
+{
+    explicit RealColumns(std::size_t count)
+      : org(count)
+      , app(count)
+      , conf(count)
+      , media(count)
+      , client(count)
+      , object(count)
+    {
     }
+
+    std::vector<std::uint32_t> org;
+    std::vector<std::uint8_t> app;
+    std::vector<std::uint32_t> conf;
+    std::vector<std::uint8_t> media;
+    std::vector<std::uint16_t> client;
+    std::vector<std::uint64_t> object;
+};
+
+static std::vector<quicr::Name> RealNames(std::size_t count)
+{
+    std::vector<quicr::Name> names;
+    names.reserve(count);
+    for (std::uint64_t i = 0; i < count; ++i)
+        names.push_back(RealHexEndec::EncodeName(0xA11CEEu, 0x00u, 0xF00001u + (i >> 12), 0x01u, i & 0xFFFF, i));
+
+    return names;
+}
+
+static void HexEndec_RealDecode_Each(benchmark::State& state)
+{
+    const std::size_t count = state.range(0);
+    const auto names = RealNames(count);
+    RealColumns columns(count);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto values = RealHexEndec::Decode(names[i]);
+            columns.org[i] = values[0];
+            columns.app[i] = values[1];
+            columns.conf[i] = values[2];
+            columns.media[i] = values[3];
+            columns.client[i] = values[4];
+            columns.object[i] = values[5];
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void HexEndec_RealDecodeBatch(benchmark::State& state)
+{
+    const std::size_t count = state.range(0);
+    const auto names = RealNames(count);
+    RealColumns columns(count);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        RealHexEndec::DecodeBatch(names.data(),
+                                  count,
+                                  columns.org.data(),
+                                  columns.app.data(),
+                                  columns.conf.data(),
+                                  columns.media.data(),
+                                  columns.client.data(),
+                                  columns.object.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void HexEndec_RealEncodeBatch(benchmark::State& state)
+{
+    const std::size_t count = state.range(0);
+    std::vector<quicr::Name> names = RealNames(count);
+    RealColumns columns(count);
+    RealHexEndec::DecodeBatch(names.data(),
+                              count,
+                              columns.org.data(),
+                              columns.app.data(),
+                              columns.conf.data(),
+                              columns.media.data(),
+                              columns.client.data(),
+                              columns.object.data());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        RealHexEndec::EncodeBatch(names.data(),
+                                  count,
+                                  columns.org.data(),
+                                  columns.app.data(),
+                                  columns.conf.data(),
+                                  columns.media.data(),
+                                  columns.client.data(),
+                                  columns.object.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
 }
 
 BENCHMARK(HexEndec_Encode4x32_to_128);
@@ -73,5 +228,11 @@ BENCHMARK(HexEndec_Decode128_to_4x32);
 BENCHMARK(HexEndec_Encode4x16_to_64);
 BENCHMARK(HexEndec_Decode64_to_4x16);
 BENCHMARK(HexEndec_RealEncode);
+BENCHMARK(HexEndec_RealEncode_ToName);
+BENCHMARK(HexEndec_RealEncodeName);
 BENCHMARK(HexEndec_RealDecode_Name);
+BENCHMARK(HexEndec_RealDecode_NameField);
 BENCHMARK(HexEndec_RealDecode_String);
+BENCHMARK(HexEndec_RealDecode_Each)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(HexEndec_RealDecodeBatch)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(HexEndec_RealEncodeBatch)->Arg(1 << 10)->Arg(1 << 16);
@@ -14,7 +14,8 @@ static void Name_ConstructFrom_String(benchmark::State& state)
     const std::string str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(str);
+        const quicr::Name n(str);
+        benchmark::DoNotOptimize(n);
     }
 }
 
@@ -23,7 +24,8 @@ static void Name_ConstructFrom_StringView(benchmark::State& state)
     const std::string_view str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(str);
+        const quicr::Name n(str);
+        benchmark::DoNotOptimize(n);
     }
 }
 
@@ -32,7 +34,8 @@ static void Name_ConstructFrom_ConstexprStringView(benchmark::State& state)
     constexpr std::string_view str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(str);
+        const quicr::Name n(str);
+        benchmark::DoNotOptimize(n);
     }
 }
 #else
@@ -41,7 +44,8 @@ static void Name_ConstructFrom_CString(benchmark::State& state)
     const std::string str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(str.c_str());
+        const quicr::Name n(str.c_str());
+        benchmark::DoNotOptimize(n);
     }
 }
 
@@ -50,11 +54,22 @@ static void Name_ConstructFrom_ConstexprCString(benchmark::State& state)
     constexpr const char* str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(str);
+        const quicr::Name n(str);
+        benchmark::DoNotOptimize(n);
     }
 }
 #endif
 
+static void Name_Parse_StringView(benchmark::State& state)
+{
+    const std::string_view str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto result = quicr::Name::parse(str);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
 static void Name_ConstructFrom_Vector(benchmark::State& state)
 {
     std::vector<uint8_t> data = {
@@ -62,7 +77,8 @@ static void Name_ConstructFrom_Vector(benchmark::State& state)
     };
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(data.data(), data.size());
+        const quicr::Name n(data.data(), data.size());
+        benchmark::DoNotOptimize(n);
     }
 }
 
@@ -77,7 +93,8 @@ static void Name_ConstructFrom_BytePointer(benchmark::State& state)
 
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(data, length);
+        const quicr::Name n(data, length);
+        benchmark::DoNotOptimize(n);
     }
 }
 
@@ -86,25 +103,28 @@ static void Name_ConstructFrom_Copy(benchmark::State& state)
     constexpr const quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Name n(name);
+        const quicr::Name n(name);
+        benchmark::DoNotOptimize(n);
     }
 }
 
 static void Name_Arithmetic_LeftShift(benchmark::State& state)
 {
-    constexpr const quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
+    quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        name << 64;
+        benchmark::DoNotOptimize(name);
+        benchmark::DoNotOptimize(name << 64);
     }
 }
 
 static void Name_Arithmetic_RightShift(benchmark::State& state)
 {
-    constexpr const quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
+    quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        name >> 64;
+        benchmark::DoNotOptimize(name);
+        benchmark::DoNotOptimize(name >> 64);
     }
 }
 
@@ -114,6 +134,7 @@ static void Name_Arithmetic_Add(benchmark::State& state)
     for ([[maybe_unused]] auto _ : state)
     {
         ++name;
+        benchmark::DoNotOptimize(name);
     }
 }
 
@@ -123,6 +144,7 @@ static void Name_Arithmetic_Sub(benchmark::State& state)
     for ([[maybe_unused]] auto _ : state)
     {
         --name;
+        benchmark::DoNotOptimize(name);
     }
 }
 
@@ -137,24 +159,27 @@ static void Name_RealArithmetic(benchmark::State& state)
 
         auto group_id_bits = (++(name >> 16) << 16) & group_id_mask;
         name = ((name & ~group_id_mask) | group_id_bits) & ~object_id_mask;
+        benchmark::DoNotOptimize(name);
     }
 }
 
 static void Name_ExtractBits(benchmark::State& state)
 {
-    constexpr quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
+    quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] auto n = name.bits(64, 64);
+        benchmark::DoNotOptimize(name);
+        benchmark::DoNotOptimize(name.bits(64, 64));
     }
 }
 
 static void Name_ConvertTo_UInt64(benchmark::State& state)
 {
-    constexpr quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
+    quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] auto n = std::uint64_t(name);
+        benchmark::DoNotOptimize(name);
+        benchmark::DoNotOptimize(std::uint64_t(name));
     }
 }
 
@@ -163,10 +188,91 @@ static void Name_ConvertTo_String(benchmark::State& state)
     constexpr quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const std::string n = name;
+        const std::string n = name;
+        benchmark::DoNotOptimize(n);
     }
 }
 
+/**
+ * Names to cycle through, so that bit operations cannot be folded into constants.
+ */
+static const std::vector<quicr::Name>& bit_operation_names()
+{
+    static const std::vector<quicr::Name> names = [] {
+        std::vector<quicr::Name> result;
+        quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+        for (std::uint64_t i = 0; i < 1024; ++i)
+            result.push_back(name += i * 0x9E3779B97F4A7C15ull);
+        return result;
+    }();
+    return names;
+}
+
+template<class Op>
+static void run_bit_operation(benchmark::State& state, Op&& op)
+{
+    const auto& names = bit_operation_names();
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(op(names[i % names.size()], names[(i + 1) % names.size()]));
+        ++i;
+    }
+}
+
+static void Name_CountlZero(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto&) { return quicr::countl_zero(a >> 72); });
+}
+
+static void Name_CountlZero_ByteLoop(benchmark::State& state)
+{
+    // The loop over operator[] that users wrote before countl_zero existed.
+    run_bit_operation(state, [](const auto& a, const auto&) {
+        const quicr::Name name = a >> 72;
+        for (int bit = sizeof(quicr::Name) * 8 - 1; bit >= 0; --bit)
+        {
+            if ((name[bit / 8] >> (bit % 8)) & 1) return static_cast<int>(sizeof(quicr::Name) * 8) - 1 - bit;
+        }
+        return static_cast<int>(sizeof(quicr::Name) * 8);
+    });
+}
+
+static void Name_CountrZero(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto&) { return quicr::countr_zero(a << 72); });
+}
+
+static void Name_Popcount(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto&) { return quicr::popcount(a); });
+}
+
+static void Name_CommonPrefixLength(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto& b) { return quicr::common_prefix_length(a, b); });
+}
+
+static void Name_HighestDifferingBit(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto& b) { return quicr::highest_differing_bit(a, b); });
+}
+
+static void Name_Rotl(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto& b) { return quicr::rotl(a, std::uint64_t(b) % 128); });
+}
+
+static void Name_Rotr(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto& b) { return quicr::rotr(a, std::uint64_t(b) % 128); });
+}
+
+static void Name_Byteswap(benchmark::State& state)
+{
+    run_bit_operation(state, [](const auto& a, const auto&) { return quicr::byteswap(a); });
+}
+
 #if __cplusplus >= 202002L
 BENCHMARK(Name_ConstructFrom_String);
 BENCHMARK(Name_ConstructFrom_StringView);
@@ -175,6 +281,7 @@ BENCHMARK(Name_ConstructFrom_ConstexprStringView);
 BENCHMARK(Name_ConstructFrom_CString);
 BENCHMARK(Name_ConstructFrom_ConstexprCString);
 #endif
+BENCHMARK(Name_Parse_StringView);
 BENCHMARK(Name_ConstructFrom_Vector);
 BENCHMARK(Name_ConstructFrom_BytePointer);
 BENCHMARK(Name_ConstructFrom_Copy);
@@ -186,3 +293,12 @@ BENCHMARK(Name_RealArithmetic);
 BENCHMARK(Name_ExtractBits);
 BENCHMARK(Name_ConvertTo_UInt64);
 BENCHMARK(Name_ConvertTo_String);
+BENCHMARK(Name_CountlZero);
+BENCHMARK(Name_CountlZero_ByteLoop);
+BENCHMARK(Name_CountrZero);
+BENCHMARK(Name_Popcount);
+BENCHMARK(Name_CommonPrefixLength);
+BENCHMARK(Name_HighestDifferingBit);
+BENCHMARK(Name_Rotl);
+BENCHMARK(Name_Rotr);
+BENCHMARK(Name_Byteswap);
@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/atomic_name.h>
+#include <quicr/hex_endec.h>
+#include <quicr/name_allocator.h>
+#include <quicr/namespace.h>
+
+namespace
+{
+const quicr::Namespace ns(0xA11CEE00F00001000000000000000000_name, 80);
+}
+
+static void NameAllocator_SharedCounter(benchmark::State& state)
+{
+    static quicr::atomic_name counter = ns.name();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(counter.fetch_add(1));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void NameAllocator_LocalBlocks(benchmark::State& state)
+{
+    static quicr::name_allocator allocator(ns, quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>{}, 5, state.range(0));
+    auto local = allocator.local();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(local.next());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(NameAllocator_SharedCounter)->ThreadRange(1, 8);
+BENCHMARK(NameAllocator_LocalBlocks)->Arg(1024)->ThreadRange(1, 8);
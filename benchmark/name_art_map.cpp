@@ -0,0 +1,187 @@
+#include "workload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <quicr/name.h>
+#include <quicr/name_art_map.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+/*
+ * Ordered maps keyed by Name, comparing name_art_map to std::map, over
+ * sequential object ids and random names. Each benchmark also reports the
+ * bytes allocated by the map per entry.
+ */
+namespace
+{
+enum class Keys
+{
+    sequential,
+    random
+};
+
+constexpr std::size_t lookup_count = 1 << 20;
+
+using value_type = std::pair<const quicr::Name, std::uint64_t>;
+using art_map = quicr::name_art_map<std::uint64_t, workload::counting_allocator<value_type>>;
+using std_map = std::map<quicr::Name, std::uint64_t, std::less<>, workload::counting_allocator<value_type>>;
+
+std::vector<quicr::Name> make_names(Keys keys, std::size_t count)
+{
+    return keys == Keys::sequential ? workload::sequential_names(count) : workload::random_names(count);
+}
+
+template<class Map>
+std::size_t fill(Map& map, const std::vector<quicr::Name>& names)
+{
+    const std::size_t before = workload::allocated_bytes;
+    std::uint64_t value = 0;
+    for (const auto& name : names)
+        map.try_emplace(name, value++);
+
+    return workload::allocated_bytes - before;
+}
+
+std::vector<quicr::Name> random_lookups(const std::vector<quicr::Name>& names)
+{
+    workload::rng_type rng(3);
+    std::vector<quicr::Name> lookups(lookup_count);
+    for (auto& name : lookups)
+        name = names[rng() % names.size()];
+
+    return lookups;
+}
+
+void report_memory(benchmark::State& state, std::size_t bytes, std::size_t entries)
+{
+    state.counters["bytes_per_entry"] = entries ? double(bytes) / double(entries) : 0.0;
+}
+
+template<class Map, Keys K>
+void NameMap_Insert(benchmark::State& state)
+{
+    const auto names = make_names(K, state.range(0));
+    std::size_t bytes = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        Map map;
+        bytes = fill(map, names);
+        benchmark::DoNotOptimize(map.size());
+
+        state.PauseTiming();
+        map = {};
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * names.size());
+    report_memory(state, bytes, names.size());
+}
+
+template<class Map, Keys K>
+void NameMap_Find(benchmark::State& state)
+{
+    const auto names = make_names(K, state.range(0));
+    const auto lookups = random_lookups(names);
+
+    Map map;
+    const std::size_t bytes = fill(map, names);
+
+    std::size_t i = 0;
+    std::uint64_t sum = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        sum += map.find(lookups[i])->second;
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(sum);
+
+    state.SetItemsProcessed(state.iterations());
+    report_memory(state, bytes, names.size());
+}
+
+template<class Map, Keys K>
+void NameMap_LowerBound(benchmark::State& state)
+{
+    const auto names = make_names(K, state.range(0));
+    auto lookups = random_lookups(names);
+    for (auto& name : lookups)
+        name += 1;
+
+    Map map;
+    const std::size_t bytes = fill(map, names);
+
+    std::size_t i = 0;
+    std::size_t found = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        found += map.lower_bound(lookups[i]) != map.end();
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(found);
+
+    state.SetItemsProcessed(state.iterations());
+    report_memory(state, bytes, names.size());
+}
+
+template<class Map, Keys K>
+void NameMap_Iterate(benchmark::State& state)
+{
+    const auto names = make_names(K, state.range(0));
+
+    Map map;
+    const std::size_t bytes = fill(map, names);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const auto& [name, value] : map)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * names.size());
+    report_memory(state, bytes, names.size());
+}
+
+template<class Map>
+void NameMap_Erase(benchmark::State& state)
+{
+    const auto names = workload::random_names(state.range(0));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        Map map;
+        fill(map, names);
+        state.ResumeTiming();
+
+        for (const auto& name : names)
+            map.erase(name);
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+} // namespace
+
+#define NAME_MAP_SIZES RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+
+BENCHMARK_TEMPLATE(NameMap_Insert, art_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Insert, std_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Insert, art_map, Keys::random)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Insert, std_map, Keys::random)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Find, art_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Find, std_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Find, art_map, Keys::random)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Find, std_map, Keys::random)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_LowerBound, art_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_LowerBound, std_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_LowerBound, art_map, Keys::random)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_LowerBound, std_map, Keys::random)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Iterate, art_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Iterate, std_map, Keys::sequential)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Erase, art_map)->NAME_MAP_SIZES;
+BENCHMARK_TEMPLATE(NameMap_Erase, std_map)->NAME_MAP_SIZES;
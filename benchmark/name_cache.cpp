@@ -0,0 +1,178 @@
+#include "workload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <quicr/name.h>
+#include <quicr/name_cache.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+/*
+ * Put, get and range fetch of caches of 1M to 4M objects, for name_cache and
+ * for a std::map of the same objects. Objects are put either in increasing
+ * order of name, like the objects of a track, or in random order.
+ */
+namespace
+{
+enum class Order
+{
+    sequential,
+    random
+};
+
+constexpr std::size_t lookup_count = 1 << 20;
+
+/**
+ * The operations of the benchmarks over a std::map, evicting by hand.
+ */
+class map_cache
+{
+  public:
+    void put(const quicr::Name& name, std::uint64_t value) { _map.insert_or_assign(name, value); }
+
+    const std::uint64_t* get(const quicr::Name& name) const
+    {
+        const auto it = _map.find(name);
+        return it == _map.end() ? nullptr : &it->second;
+    }
+
+    template<class Fn>
+    std::size_t range(const quicr::Name& first, const quicr::Name& last, Fn&& fn) const
+    {
+        std::size_t count = 0;
+        for (auto it = _map.lower_bound(first); it != _map.end() && !(last < it->first); ++it, ++count)
+            fn(it->first, it->second);
+
+        return count;
+    }
+
+    std::size_t size() const noexcept { return _map.size(); }
+
+  private:
+    std::map<quicr::Name, std::uint64_t> _map;
+};
+
+using name_cache = quicr::name_cache<std::uint64_t>;
+
+std::vector<quicr::Name> make_names(Order order, std::size_t count)
+{
+    return order == Order::sequential ? workload::sequential_names(count) : workload::random_names(count);
+}
+
+template<class Cache>
+void fill(Cache& cache, const std::vector<quicr::Name>& names)
+{
+    std::uint64_t value = 0;
+    for (const auto& name : names)
+        cache.put(name, value++);
+}
+
+std::vector<std::size_t> random_indices(std::size_t count, std::size_t bound)
+{
+    workload::rng_type rng(3);
+    std::vector<std::size_t> indices(count);
+    for (auto& index : indices)
+        index = rng() % bound;
+
+    return indices;
+}
+
+template<class Cache, Order O>
+void NameCache_Put(benchmark::State& state)
+{
+    const auto names = make_names(O, state.range(0));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        Cache cache;
+        fill(cache, names);
+        benchmark::DoNotOptimize(cache.size());
+
+        state.PauseTiming();
+        cache = Cache{};
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+template<class Cache, Order O>
+void NameCache_Get(benchmark::State& state)
+{
+    const auto names = make_names(O, state.range(0));
+    const auto indices = random_indices(lookup_count, names.size());
+
+    Cache cache;
+    fill(cache, names);
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(cache.get(names[indices[i]]));
+        i = (i + 1) & (lookup_count - 1);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Fetches the 64 objects of a group from its start, like a late joiner would.
+ */
+template<class Cache>
+void NameCache_Range(benchmark::State& state)
+{
+    constexpr std::size_t group_size = 64;
+    const auto names = make_names(Order::sequential, state.range(0));
+    const auto indices = random_indices(lookup_count, names.size() - group_size);
+
+    Cache cache;
+    fill(cache, names);
+
+    std::size_t i = 0;
+    std::uint64_t sum = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const quicr::Name& first = names[indices[i]];
+        cache.range(first, first + (group_size - 1), [&](const quicr::Name&, std::uint64_t value) { sum += value; });
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(sum);
+
+    state.SetItemsProcessed(state.iterations() * group_size);
+}
+
+/**
+ * Puts objects into a name_cache whose budget holds half of them, so every put evicts the least recently used.
+ */
+void NameCache_PutEvict(benchmark::State& state)
+{
+    const auto names = workload::sequential_names(state.range(0));
+    name_cache cache(names.size() / 2 * sizeof(std::uint64_t));
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        cache.put(names[i], i);
+        i = i + 1 == names.size() ? 0 : i + 1;
+    }
+    benchmark::DoNotOptimize(cache.size());
+
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+#define NAME_CACHE_SIZES Arg(1 << 20)->Arg(1 << 22)
+
+BENCHMARK_TEMPLATE(NameCache_Put, name_cache, Order::sequential)->NAME_CACHE_SIZES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(NameCache_Put, map_cache, Order::sequential)->NAME_CACHE_SIZES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(NameCache_Put, name_cache, Order::random)->NAME_CACHE_SIZES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(NameCache_Put, map_cache, Order::random)->NAME_CACHE_SIZES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(NameCache_Get, name_cache, Order::sequential)->NAME_CACHE_SIZES;
+BENCHMARK_TEMPLATE(NameCache_Get, map_cache, Order::sequential)->NAME_CACHE_SIZES;
+BENCHMARK_TEMPLATE(NameCache_Get, name_cache, Order::random)->NAME_CACHE_SIZES;
+BENCHMARK_TEMPLATE(NameCache_Get, map_cache, Order::random)->NAME_CACHE_SIZES;
+BENCHMARK_TEMPLATE(NameCache_Range, name_cache)->NAME_CACHE_SIZES;
+BENCHMARK_TEMPLATE(NameCache_Range, map_cache)->NAME_CACHE_SIZES;
+BENCHMARK(NameCache_PutEvict)->NAME_CACHE_SIZES;
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/name.h>
+#include <quicr/name_hash_map.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace
+{
+constexpr quicr::Name base_name = 0xA11CEE00F00001000000000000000000_name;
+
+/**
+ * Visits every index in [0, count) in a scattered order, without storing a permutation.
+ */
+constexpr std::uint64_t scatter(std::uint64_t i, std::uint64_t count)
+{
+    return (i * 0x9E3779B97F4A7C15ull) % count;
+}
+
+template<class Map>
+Map make_map(std::uint64_t count)
+{
+    Map map;
+    map.reserve(count);
+    for (std::uint64_t i = 0; i < count; ++i)
+        map.emplace(base_name + i, i);
+    return map;
+}
+
+template<class Map>
+void HashMap_Insert(benchmark::State& state)
+{
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        Map map;
+        for (std::uint64_t i = 0; i < count; ++i)
+            map.emplace(base_name + i, i);
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<class Map>
+void HashMap_LookupHit(benchmark::State& state)
+{
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+    const Map map = make_map<Map>(count);
+
+    std::uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto it = map.find(base_name + scatter(i++, count));
+        benchmark::DoNotOptimize(it);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class Map>
+void HashMap_LookupMiss(benchmark::State& state)
+{
+    const auto count = static_cast<std::uint64_t>(state.range(0));
+    const Map map = make_map<Map>(count);
+
+    std::uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto it = map.find(base_name + count + scatter(i++, count));
+        benchmark::DoNotOptimize(it);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using std_map_t = std::unordered_map<quicr::Name, std::uint64_t>;
+using flat_map_t = quicr::name_hash_map<std::uint64_t>;
+} // namespace
+
+BENCHMARK_TEMPLATE(HashMap_Insert, std_map_t)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(HashMap_Insert, flat_map_t)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(HashMap_LookupHit, std_map_t)->RangeMultiplier(10)->Range(1'000'000, 100'000'000);
+BENCHMARK_TEMPLATE(HashMap_LookupHit, flat_map_t)->RangeMultiplier(10)->Range(1'000'000, 100'000'000);
+BENCHMARK_TEMPLATE(HashMap_LookupMiss, std_map_t)->RangeMultiplier(10)->Range(1'000'000, 100'000'000);
+BENCHMARK_TEMPLATE(HashMap_LookupMiss, flat_map_t)->RangeMultiplier(10)->Range(1'000'000, 100'000'000);
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/hex_endec.h>
+#include <quicr/name.h>
+#include <quicr/name_layout.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// The distributions are hidden from the optimizer, as they would be when read from configuration.
+namespace
+{
+constexpr quicr::Name real_name = 0xA11CEE01F00001C20017000000000005_name;
+
+void NameLayout_Decode_HexEndecRuntime(benchmark::State& state)
+{
+    std::vector<std::uint16_t> distribution{ 24, 8, 24, 8, 16, 48 };
+    quicr::Name name = real_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(distribution.data());
+        benchmark::DoNotOptimize(name);
+#if __cplusplus >= 202002L
+        benchmark::DoNotOptimize(quicr::HexEndec<128>::Decode(std::span<std::uint16_t>(distribution), name));
+#else
+        benchmark::DoNotOptimize(quicr::HexEndec<128>::Decode(distribution, name));
+#endif
+    }
+}
+
+void NameLayout_Decode(benchmark::State& state)
+{
+    const quicr::NameLayout layout{ 24, 8, 24, 8, 16, 48 };
+    std::array<std::uint64_t, 6> values{};
+    quicr::Name name = real_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(name);
+        layout.Decode(name, values.data(), values.size());
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+void NameLayout_Encode_HexEndecRuntime(benchmark::State& state)
+{
+    std::array<std::uint16_t, 6> distribution{ 24, 8, 24, 8, 16, 48 };
+    std::array<std::uint64_t, 6> values{ 0xA11CEE, 0x01, 0xF00001, 0xC2, 0x17, 0x5 };
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(distribution.data());
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(quicr::HexEndec<128>::EncodeName(distribution, values));
+    }
+}
+
+void NameLayout_Encode(benchmark::State& state)
+{
+    const quicr::NameLayout layout{ 24, 8, 24, 8, 16, 48 };
+    std::array<std::uint64_t, 6> values{ 0xA11CEE, 0x01, 0xF00001, 0xC2, 0x17, 0x5 };
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(layout.EncodeName(values.data(), values.size()));
+    }
+}
+} // namespace
+
+BENCHMARK(NameLayout_Decode_HexEndecRuntime);
+BENCHMARK(NameLayout_Decode);
+BENCHMARK(NameLayout_Encode_HexEndecRuntime);
+BENCHMARK(NameLayout_Encode);
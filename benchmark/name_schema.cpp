@@ -0,0 +1,167 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/hex_endec.h>
+#include <quicr/name.h>
+#include <quicr/name_schema.h>
+#include <quicr/namespace.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct org;
+struct app;
+struct conf;
+struct media;
+struct client;
+struct object;
+
+using layout = quicr::name_schema<quicr::field<org, 24>,
+                                  quicr::field<app, 8>,
+                                  quicr::field<conf, 24>,
+                                  quicr::field<media, 8>,
+                                  quicr::field<client, 16>,
+                                  quicr::field<object, 48>>;
+
+std::vector<quicr::Name> make_names(std::size_t count)
+{
+    std::vector<quicr::Name> names(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names[i] = layout::with<conf, media, object>(0xA11CEE01000000000000000000000000_name, i % 97, i & 0xFF, i);
+    return names;
+}
+
+void NameSchema_GetConf_HexEndecDecode(benchmark::State& state)
+{
+    const auto names = make_names(4096);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const auto& name : names)
+            sum += layout::hex_endec::Decode(name)[layout::index<conf>];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+void NameSchema_GetConf(benchmark::State& state)
+{
+    const auto names = make_names(4096);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const auto& name : names)
+            sum += layout::get<conf>(name);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+void NameSchema_SetObject_HexEndecEncode(benchmark::State& state)
+{
+    auto names = make_names(4096);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (auto& name : names)
+        {
+            auto fields = layout::hex_endec::Decode(name);
+            const std::string hex = layout::hex_endec::Encode(
+              fields[0], fields[1], fields[2], fields[3], fields[4], fields[layout::index<object>] + 1);
+            name = quicr::Name(hex.c_str());
+        }
+        benchmark::DoNotOptimize(names.data());
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+void NameSchema_SetObject(benchmark::State& state)
+{
+    auto names = make_names(4096);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (auto& name : names)
+            layout::set<object>(name, layout::get<object>(name) + 1);
+        benchmark::DoNotOptimize(names.data());
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+void NameSchema_AdvanceObject_Masks(benchmark::State& state)
+{
+    constexpr quicr::Name object_mask = layout::mask<object>;
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        name = (name & ~object_mask) | ((name + 1) & object_mask);
+        benchmark::DoNotOptimize(name);
+    }
+}
+
+void NameSchema_AdvanceObject(benchmark::State& state)
+{
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        layout::increment<object>(name);
+        benchmark::DoNotOptimize(name);
+    }
+}
+
+void NameSchema_AdvanceGroup_Masks(benchmark::State& state)
+{
+    constexpr quicr::Name client_mask = layout::mask<client>;
+    constexpr quicr::Name object_mask = layout::mask<object>;
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto group_bits = (++(name >> 48) << 48) & client_mask;
+        name = ((name & ~client_mask) | group_bits) & ~object_mask;
+        benchmark::DoNotOptimize(name);
+    }
+}
+
+void NameSchema_AdvanceGroup(benchmark::State& state)
+{
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        layout::increment<client>(name);
+        layout::reset_lower<client>(name);
+        benchmark::DoNotOptimize(name);
+    }
+}
+
+void NameSchema_MakeNamespace_HexEndecEncode(benchmark::State& state)
+{
+    std::uint32_t conf_id = 0xF00001;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(conf_id);
+        const std::string hex = layout::hex_endec::Encode(0xA11CEEu, 0x01u, conf_id, 0u, 0u, 0u);
+        benchmark::DoNotOptimize(quicr::Namespace(quicr::Name(hex.c_str()), 56));
+    }
+}
+
+void NameSchema_MakeNamespace(benchmark::State& state)
+{
+    std::uint32_t conf_id = 0xF00001;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(conf_id);
+        benchmark::DoNotOptimize(layout::make_namespace(0xA11CEEu, 0x01u, conf_id));
+    }
+}
+} // namespace
+
+BENCHMARK(NameSchema_GetConf_HexEndecDecode);
+BENCHMARK(NameSchema_GetConf);
+BENCHMARK(NameSchema_SetObject_HexEndecEncode);
+BENCHMARK(NameSchema_SetObject);
+BENCHMARK(NameSchema_AdvanceObject_Masks);
+BENCHMARK(NameSchema_AdvanceObject);
+BENCHMARK(NameSchema_AdvanceGroup_Masks);
+BENCHMARK(NameSchema_AdvanceGroup);
+BENCHMARK(NameSchema_MakeNamespace_HexEndecEncode);
+BENCHMARK(NameSchema_MakeNamespace);
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/name.h>
+#include <quicr/name_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#if defined(QNAME_BENCHMARK_PARALLEL_STL)
+#include <execution>
+#endif
+
+namespace
+{
+/**
+ * Names sharing an origin, with random conference, media, client and object ids.
+ */
+std::vector<quicr::Name> make_names(std::size_t count)
+{
+    std::mt19937_64 rng(0x5EED);
+    std::vector<quicr::Name> names(count);
+    for (auto& name : names)
+    {
+        const std::uint64_t conference = rng() % 1000;
+        const std::uint64_t media = rng() % 4;
+        const std::uint64_t client = rng() % 0xFFFF;
+        const std::uint64_t object = rng() & 0xFFFFFFFFFFFF;
+        name = quicr::Name(0xA11CEE0000000000ull | conference << 8 | media, client << 48 | object);
+    }
+    return names;
+}
+
+template<class Sort>
+void run_sort(benchmark::State& state, Sort&& sort)
+{
+    const auto input = make_names(static_cast<std::size_t>(state.range(0)));
+    std::vector<quicr::Name> names(input.size());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), names.begin());
+        state.ResumeTiming();
+
+        sort(names);
+        benchmark::DoNotOptimize(names.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void NameSort_StdSort(benchmark::State& state)
+{
+    run_sort(state, [](auto& names) { std::sort(names.begin(), names.end()); });
+}
+
+#if defined(QNAME_BENCHMARK_PARALLEL_STL)
+void NameSort_StdSortParallel(benchmark::State& state)
+{
+    run_sort(state, [](auto& names) { std::sort(std::execution::par, names.begin(), names.end()); });
+}
+#endif
+
+void NameSort_RadixSort(benchmark::State& state)
+{
+    run_sort(state, [](auto& names) { quicr::radix_sort(names.data(), names.data() + names.size()); });
+}
+
+void NameSort_ParallelRadixSort(benchmark::State& state)
+{
+    run_sort(state, [](auto& names) { quicr::parallel_radix_sort(names.data(), names.data() + names.size()); });
+}
+
+void NameSort_StdSortUnique(benchmark::State& state)
+{
+    run_sort(state, [](auto& names) {
+        std::sort(names.begin(), names.end());
+        benchmark::DoNotOptimize(std::unique(names.begin(), names.end()));
+    });
+}
+
+void NameSort_RadixSortUnique(benchmark::State& state)
+{
+    run_sort(state, [](auto& names) {
+        benchmark::DoNotOptimize(quicr::radix_sort_unique(names.data(), names.data() + names.size()));
+    });
+}
+
+void NameSort_ParallelRadixSortUnique(benchmark::State& state)
+{
+    run_sort(state, [](auto& names) {
+        benchmark::DoNotOptimize(quicr::parallel_radix_sort_unique(names.data(), names.data() + names.size()));
+    });
+}
+} // namespace
+
+BENCHMARK(NameSort_StdSort)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+#if defined(QNAME_BENCHMARK_PARALLEL_STL)
+BENCHMARK(NameSort_StdSortParallel)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
+BENCHMARK(NameSort_RadixSort)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameSort_ParallelRadixSort)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(NameSort_StdSortUnique)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameSort_RadixSortUnique)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameSort_ParallelRadixSortUnique)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
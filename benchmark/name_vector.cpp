@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <quicr/hex_endec.h>
+#include <quicr/name.h>
+#include <quicr/name_vector.h>
+#include <quicr/namespace.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+constexpr quicr::Name base_name = 0xA11CEE00F00001000000000000000000_name;
+const quicr::Namespace scan_namespace(0xA11CEE00F00001000000000000000000_name, 80);
+constexpr quicr::HexEndec<128, 24, 8, 24, 8, 16, 48> layout;
+
+/**
+ * Names alternating between two conferences, so that half fall within scan_namespace.
+ */
+std::vector<quicr::Name> make_names(std::size_t count)
+{
+    std::vector<quicr::Name> names(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names[i] = base_name + (quicr::Name(std::uint64_t(0), std::uint64_t(i & 1)) << 48) + i;
+    return names;
+}
+
+void NameVector_Count_Std(benchmark::State& state)
+{
+    const auto names = make_names(static_cast<std::size_t>(state.range(0)));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::size_t count = 0;
+        for (const auto& name : names)
+            count += scan_namespace.contains(name);
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(quicr::Name));
+}
+
+void NameVector_Count_Columnar(benchmark::State& state)
+{
+    const auto input = make_names(static_cast<std::size_t>(state.range(0)));
+    const quicr::name_vector names(input.begin(), input.end());
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(names.count(scan_namespace));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(quicr::Name));
+}
+
+void NameVector_Extract_Std(benchmark::State& state)
+{
+    const auto names = make_names(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint64_t> out(names.size());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (std::size_t i = 0; i < names.size(); ++i)
+            out[i] = names[i].bits<std::uint64_t>(layout.Offset(5), layout.Width(5));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(quicr::Name));
+}
+
+void NameVector_Extract_Columnar(benchmark::State& state)
+{
+    const auto input = make_names(static_cast<std::size_t>(state.range(0)));
+    const quicr::name_vector names(input.begin(), input.end());
+    std::vector<std::uint64_t> out(names.size());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        names.extract(layout, 5, out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(quicr::Name));
+}
+
+void NameVector_Max_Std(benchmark::State& state)
+{
+    const auto names = make_names(static_cast<std::size_t>(state.range(0)));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        quicr::Name max = names.front();
+        for (const auto& name : names)
+            max = max < name ? name : max;
+        benchmark::DoNotOptimize(max);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(quicr::Name));
+}
+
+void NameVector_Max_Columnar(benchmark::State& state)
+{
+    const auto input = make_names(static_cast<std::size_t>(state.range(0)));
+    const quicr::name_vector names(input.begin(), input.end());
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(names.max());
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(quicr::Name));
+}
+} // namespace
+
+BENCHMARK(NameVector_Count_Std)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameVector_Count_Columnar)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameVector_Extract_Std)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameVector_Extract_Columnar)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameVector_Max_Std)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(NameVector_Max_Columnar)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
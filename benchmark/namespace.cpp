@@ -3,15 +3,19 @@
 #include <quicr/name.h>
 #include <quicr/namespace.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <vector>
 
 static void Namespace_ConstructFrom_Name(benchmark::State& state)
 {
     constexpr quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Namespace ns(name, 80);
+        const quicr::Namespace ns(name, 80);
+        benchmark::DoNotOptimize(ns);
     }
 }
 
@@ -21,7 +25,8 @@ static void Namespace_ConstructFrom_String(benchmark::State& state)
     const std::string str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF/80";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Namespace ns(str);
+        const quicr::Namespace ns(str);
+        benchmark::DoNotOptimize(ns);
     }
 }
 
@@ -30,7 +35,8 @@ static void Namespace_ConstructFrom_StringView(benchmark::State& state)
     const std::string_view str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF/80";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Namespace ns(str);
+        const quicr::Namespace ns(str);
+        benchmark::DoNotOptimize(ns);
     }
 }
 
@@ -48,7 +54,8 @@ static void Namespace_ConstructFrom_CString(benchmark::State& state)
     const char* str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF/80";
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const quicr::Namespace ns(str);
+        const quicr::Namespace ns(str);
+        benchmark::DoNotOptimize(ns);
     }
 }
 
@@ -62,13 +69,60 @@ static void Namespace_ConstructFrom_ConstexprCString(benchmark::State& state)
 }
 #endif
 
+static void Namespace_Parse_StringView(benchmark::State& state)
+{
+    const std::string_view str = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF/80";
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto result = quicr::Namespace::parse(str);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
 static void Namespace_ConvertTo_String(benchmark::State& state)
 {
-    constexpr quicr::Name name = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
+    const quicr::Namespace ns(0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name, 80);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const std::string str = ns;
+        benchmark::DoNotOptimize(str);
+    }
+}
+
+static void Namespace_CommonPrefix(benchmark::State& state)
+{
+    quicr::Name a = 0xA11CEE00F00001000000000000000000_name;
+    quicr::Name b = 0xA11CEE00F00002000000000000000000_name;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(quicr::Namespace::common_prefix(a, b));
+    }
+}
+
+/**
+ * Scans names of each width for those in a namespace, showing the cost of wider names.
+ */
+template<std::size_t Bits>
+static void BasicNamespace_Contains(benchmark::State& state)
+{
+    using name_type = quicr::BasicName<Bits>;
+
+    std::vector<name_type> names(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 0; i < names.size(); ++i)
+        names[i] = (name_type{} | (i * 0x9E3779B97F4A7C15ull)) << (Bits - 64);
+    const quicr::BasicNamespace<Bits> ns(names[1], 12);
+
     for ([[maybe_unused]] auto _ : state)
     {
-        [[maybe_unused]] const std::string ns = name;
+        std::size_t count = 0;
+        for (const auto& name : names)
+            count += ns.contains(name);
+        benchmark::DoNotOptimize(count);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(name_type));
 }
 
 BENCHMARK(Namespace_ConstructFrom_Name);
@@ -80,4 +134,9 @@ BENCHMARK(Namespace_ConstructFrom_ConstexprStringView);
 BENCHMARK(Namespace_ConstructFrom_CString);
 BENCHMARK(Namespace_ConstructFrom_ConstexprCString);
 #endif
+BENCHMARK(Namespace_Parse_StringView);
 BENCHMARK(Namespace_ConvertTo_String);
+BENCHMARK(Namespace_CommonPrefix);
+BENCHMARK_TEMPLATE(BasicNamespace_Contains, 64)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BasicNamespace_Contains, 128)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BasicNamespace_Contains, 256)->Arg(1 << 20);
@@ -0,0 +1,228 @@
+#include "workload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <quicr/name.h>
+#include <quicr/namespace.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/*
+ * Lookups in namespace maps of 100 to 10M entries, for each workload.
+ *
+ * The time of a lookup benchmark is per lookup, and items_per_second is the
+ * lookups per second. Each benchmark also reports the bytes allocated by the
+ * map per entry. Cache misses can be counted alongside with
+ * --benchmark_perf_counters=CACHE-MISSES,CYCLES when Google Benchmark is built
+ * with libpfm.
+ */
+namespace
+{
+enum class Workload
+{
+    // Namespaces of random names, looked up uniformly.
+    uniform,
+    // Namespaces of random names, a few of them receiving most lookups.
+    zipf,
+    // Conference, media and client namespaces of a conferencing deployment.
+    conference,
+    // Chains of nested namespaces of varying depth.
+    nested
+};
+
+constexpr std::size_t lookup_count = 1 << 20;
+
+template<template<typename> class Comparator>
+using map_type =
+  quicr::namespace_map<std::uint32_t,
+                       Comparator,
+                       workload::counting_allocator<std::pair<const quicr::Namespace, std::uint32_t>>>;
+
+std::vector<quicr::Namespace> make_namespaces(Workload w, std::size_t count)
+{
+    switch (w)
+    {
+        case Workload::conference:
+            return workload::conference_namespaces(count);
+        case Workload::nested:
+            return workload::nested_namespaces(count);
+        default:
+            return workload::uniform_namespaces(count);
+    }
+}
+
+std::vector<quicr::Name> make_lookups(Workload w, const std::vector<quicr::Namespace>& namespaces)
+{
+    if (w == Workload::zipf) return workload::zipf_lookups(namespaces, lookup_count);
+    return workload::uniform_lookups(namespaces, lookup_count);
+}
+
+template<template<typename> class Comparator>
+void fill(map_type<Comparator>& map, const std::vector<quicr::Namespace>& namespaces)
+{
+    std::uint32_t value = 0;
+    for (const auto& ns : namespaces)
+        map.emplace(ns, value++);
+}
+
+void report_memory(benchmark::State& state, std::size_t bytes, std::size_t entries)
+{
+    state.counters["entries"] = double(entries);
+    state.counters["bytes_per_entry"] = entries ? double(bytes) / double(entries) : 0.0;
+}
+
+template<Workload W, template<typename> class Comparator>
+void NamespaceMap_Find(benchmark::State& state)
+{
+    const auto namespaces = make_namespaces(W, state.range(0));
+    const auto names = make_lookups(W, namespaces);
+
+    const std::size_t before = workload::allocated_bytes;
+    map_type<Comparator> map;
+    fill(map, namespaces);
+    const std::size_t bytes = workload::allocated_bytes - before;
+
+    std::size_t i = 0;
+    std::size_t found = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        found += map.find(names[i]) != map.end();
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(found);
+
+    state.SetItemsProcessed(state.iterations());
+    report_memory(state, bytes, map.size());
+}
+
+/**
+ * Lookups in an instrumented map, to compare against NamespaceMap_Find, and
+ * reporting the mean comparisons and hit rate of the lookups.
+ */
+template<Workload W>
+void NamespaceMap_FindInstrumented(benchmark::State& state)
+{
+    const auto namespaces = make_namespaces(W, state.range(0));
+    const auto names = make_lookups(W, namespaces);
+
+    quicr::instrumented_namespace_map<std::uint32_t> map;
+    std::uint32_t value = 0;
+    for (const auto& ns : namespaces)
+        map.emplace(ns, value++);
+
+    std::size_t i = 0;
+    std::size_t found = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        found += map.find(names[i]) != map.end();
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(found);
+
+    const auto stats = map.stats();
+    state.SetItemsProcessed(state.iterations());
+    state.counters["entries"] = double(map.size());
+    state.counters["comparisons"] = stats.comparisons_per_lookup();
+    state.counters["hit_rate"] = stats.lookups ? double(stats.hits) / double(stats.lookups) : 0.0;
+}
+
+template<Workload W>
+void NamespaceMap_Count(benchmark::State& state)
+{
+    const auto namespaces = make_namespaces(W, state.range(0));
+    const auto names = make_lookups(W, namespaces);
+
+    const std::size_t before = workload::allocated_bytes;
+    map_type<std::greater> map;
+    fill(map, namespaces);
+    const std::size_t bytes = workload::allocated_bytes - before;
+
+    std::size_t i = 0;
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        count += map.count(names[i]);
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(count);
+
+    state.SetItemsProcessed(state.iterations());
+    report_memory(state, bytes, map.size());
+}
+
+template<Workload W>
+void NamespaceMap_Insert(benchmark::State& state)
+{
+    const auto namespaces = make_namespaces(W, state.range(0));
+
+    std::size_t bytes = 0;
+    std::size_t entries = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const std::size_t before = workload::allocated_bytes;
+        map_type<std::greater> map;
+        fill(map, namespaces);
+        bytes = workload::allocated_bytes - before;
+        entries = map.size();
+
+        state.PauseTiming();
+        map = {};
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * namespaces.size());
+    report_memory(state, bytes, entries);
+}
+
+/**
+ * Erases an entry and inserts it back, keeping the size of the map steady.
+ */
+template<Workload W>
+void NamespaceMap_EraseInsert(benchmark::State& state)
+{
+    const auto namespaces = make_namespaces(W, state.range(0));
+
+    const std::size_t before = workload::allocated_bytes;
+    map_type<std::greater> map;
+    fill(map, namespaces);
+    const std::size_t bytes = workload::allocated_bytes - before;
+
+    workload::rng_type rng(3);
+    std::vector<std::size_t> order(lookup_count);
+    for (auto& index : order)
+        index = rng() % namespaces.size();
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto& ns = namespaces[order[i]];
+        map.erase(ns);
+        map.emplace(ns, std::uint32_t(i));
+        i = (i + 1) & (lookup_count - 1);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    report_memory(state, bytes, map.size());
+}
+} // namespace
+
+#define NAMESPACE_MAP_SIZES RangeMultiplier(10)->Range(100, 10'000'000)
+
+BENCHMARK_TEMPLATE(NamespaceMap_Find, Workload::uniform, std::greater)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Find, Workload::zipf, std::greater)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Find, Workload::conference, std::greater)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Find, Workload::nested, std::greater)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Find, Workload::conference, std::less)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Find, Workload::nested, std::less)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_FindInstrumented, Workload::uniform)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_FindInstrumented, Workload::conference)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Count, Workload::conference)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Count, Workload::nested)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_Insert, Workload::uniform)->NAMESPACE_MAP_SIZES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(NamespaceMap_Insert, Workload::conference)->NAMESPACE_MAP_SIZES->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(NamespaceMap_EraseInsert, Workload::uniform)->NAMESPACE_MAP_SIZES;
+BENCHMARK_TEMPLATE(NamespaceMap_EraseInsert, Workload::conference)->NAMESPACE_MAP_SIZES;
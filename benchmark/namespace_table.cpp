@@ -0,0 +1,77 @@
+#include "workload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <quicr/namespace.h>
+#include <quicr/namespace_table.h>
+#include <quicr/task_pool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*
+ * Building a routing table of 1M to 4M conference namespaces from an unsorted
+ * list, in bulk with namespace_table on 1 to 8 threads, and by inserting every
+ * namespace into a namespace_map. The pool of threads is started once, as it
+ * would be reused across reloads of the table.
+ */
+namespace
+{
+using entry_type = std::pair<quicr::Namespace, std::uint64_t>;
+
+std::vector<entry_type> make_entries(std::size_t count)
+{
+    std::vector<entry_type> entries;
+    entries.reserve(count);
+    for (const auto& ns : workload::conference_namespaces(count))
+        entries.emplace_back(ns, entries.size());
+
+    return entries;
+}
+
+void NamespaceTable_Build(benchmark::State& state)
+{
+    const auto entries = make_entries(state.range(0));
+    quicr::task_pool pool(state.range(1));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        quicr::namespace_table<std::uint64_t> table(entries.begin(), entries.end(), pool);
+        benchmark::DoNotOptimize(table.size());
+
+        state.PauseTiming();
+        table = {};
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * entries.size());
+}
+
+void NamespaceMap_InsertEach(benchmark::State& state)
+{
+    const auto entries = make_entries(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        quicr::namespace_map<std::uint64_t> map;
+        for (const auto& [ns, value] : entries)
+            map.emplace(ns, value);
+        benchmark::DoNotOptimize(map.size());
+
+        state.PauseTiming();
+        map = {};
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * entries.size());
+}
+} // namespace
+
+BENCHMARK(NamespaceTable_Build)
+  ->ArgsProduct({ { 1 << 20, 1 << 22 }, { 1, 2, 4, 8 } })
+  ->ArgNames({ "entries", "threads" })
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK(NamespaceMap_InsertEach)->Arg(1 << 20)->Arg(1 << 22)->ArgName("entries")->Unit(benchmark::kMillisecond);
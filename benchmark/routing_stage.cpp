@@ -0,0 +1,213 @@
+#include "scaling.h"
+#include "workload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <quicr/name.h>
+#include <quicr/namespace.h>
+#include <quicr/routing_stage.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * End-to-end throughput of routing names to destinations across cores.
+ *
+ * Every core runs a lane that plays all three parts of a relay: it feeds
+ * names to its worker, routes them, and delivers the names of the
+ * destinations it owns. The routing_stage is compared to routing each name
+ * through a virtual call into a destination queue behind a mutex. Arguments
+ * are the number of cores and, for the routing_stage, the batch size.
+ */
+namespace
+{
+constexpr std::size_t namespace_count = 1000;
+constexpr std::size_t destination_count = 16;
+constexpr std::size_t names_per_run = 1 << 20;
+
+using index_t = quicr::namespace_map<std::size_t>;
+using stage_t = quicr::routing_stage<index_t>;
+
+struct routing_table
+{
+    routing_table()
+    {
+        const auto namespaces = workload::conference_namespaces(namespace_count);
+        for (std::size_t i = 0; i < namespaces.size(); ++i)
+            index.emplace(namespaces[i], i % destination_count);
+
+        // Only names with a destination are kept, so that every name fed is eventually delivered.
+        for (const auto& name : workload::uniform_lookups(namespaces, names_per_run))
+        {
+            if (index.find(name) != index.end()) names.push_back({ name, names.size() });
+        }
+    }
+
+    index_t index;
+    std::vector<stage_t::value_type> names;
+};
+
+const routing_table& table()
+{
+    static const routing_table instance;
+    return instance;
+}
+
+/**
+ * Runs one lane per core until every name is delivered.
+ */
+template<class Lane>
+void run_lanes(std::size_t cores, Lane&& lane)
+{
+    std::vector<std::thread> threads;
+    for (std::size_t core = 0; core < cores; ++core)
+    {
+        threads.emplace_back([&, core] {
+            scaling::pin_to_cpu(static_cast<unsigned>(core));
+            lane(core);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+void RoutingStage_Throughput(benchmark::State& state)
+{
+    const auto cores = static_cast<std::size_t>(state.range(0));
+    const auto batch_size = static_cast<std::size_t>(state.range(1));
+    const auto& names = table().names;
+    const std::size_t share = names.size() / cores;
+
+    std::uint64_t stalls = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        stage_t stage(table().index, cores, destination_count, 1024, batch_size);
+        std::atomic<std::size_t> delivered{ 0 };
+        std::atomic<std::uint64_t> checksum{ 0 };
+
+        run_lanes(cores, [&](std::size_t core) {
+            const auto* first = names.data() + core * share;
+            std::size_t fed = 0;
+            std::uint64_t sum = 0;
+            while (delivered.load(std::memory_order_relaxed) < share * cores)
+            {
+                if (fed < share) fed += stage.input(core).try_push(first + fed, std::min(batch_size, share - fed));
+                stage.process(core);
+
+                std::size_t count = 0;
+                for (std::size_t destination = core; destination < destination_count; destination += cores)
+                    count += stage.drain(destination, [&](const stage_t::value_type& value) { sum += value.handle; });
+                if (count != 0) delivered.fetch_add(count, std::memory_order_relaxed);
+            }
+            checksum.fetch_add(sum, std::memory_order_relaxed);
+        });
+
+        benchmark::DoNotOptimize(checksum.load());
+        for (std::size_t core = 0; core < cores; ++core)
+            stalls += stage.stats(core).stalls;
+    }
+
+    state.SetItemsProcessed(state.iterations() * share * cores);
+    state.counters["stalls_per_run"] = double(stalls) / double(state.iterations());
+}
+
+/**
+ * A destination behind a mutex, reached through a virtual call per name.
+ */
+class sink
+{
+  public:
+    virtual ~sink() = default;
+    virtual void deliver(const stage_t::value_type& value) = 0;
+};
+
+class locked_destination final : public sink
+{
+  public:
+    void deliver(const stage_t::value_type& value) override
+    {
+        std::lock_guard lock(_mutex);
+        _queue.push_back(value);
+    }
+
+    template<class Fn>
+    std::size_t drain(Fn&& fn)
+    {
+        std::lock_guard lock(_mutex);
+        const std::size_t count = _queue.size();
+        for (const auto& value : _queue)
+            fn(value);
+        _queue.clear();
+        return count;
+    }
+
+  private:
+    std::mutex _mutex;
+    std::deque<stage_t::value_type> _queue;
+};
+
+void LockedRouting_Throughput(benchmark::State& state)
+{
+    const auto cores = static_cast<std::size_t>(state.range(0));
+    const auto& names = table().names;
+    const auto& index = table().index;
+    const std::size_t share = names.size() / cores;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::vector<std::unique_ptr<locked_destination>> destinations;
+        for (std::size_t i = 0; i < destination_count; ++i)
+            destinations.push_back(std::make_unique<locked_destination>());
+
+        std::atomic<std::size_t> delivered{ 0 };
+        std::atomic<std::uint64_t> checksum{ 0 };
+
+        run_lanes(cores, [&](std::size_t core) {
+            const auto* first = names.data() + core * share;
+            std::size_t fed = 0;
+            std::uint64_t sum = 0;
+            while (delivered.load(std::memory_order_relaxed) < share * cores)
+            {
+                for (const std::size_t end = std::min(share, fed + 32); fed < end; ++fed)
+                {
+                    const auto it = index.find(first[fed].name);
+                    sink& destination = *destinations[it->second];
+                    destination.deliver(first[fed]);
+                }
+
+                std::size_t count = 0;
+                for (std::size_t destination = core; destination < destination_count; destination += cores)
+                {
+                    count += destinations[destination]->drain([&](const auto& value) { sum += value.handle; });
+                }
+                if (count != 0) delivered.fetch_add(count, std::memory_order_relaxed);
+            }
+            checksum.fetch_add(sum, std::memory_order_relaxed);
+        });
+
+        benchmark::DoNotOptimize(checksum.load());
+    }
+
+    state.SetItemsProcessed(state.iterations() * share * cores);
+}
+} // namespace
+
+BENCHMARK(RoutingStage_Throughput)
+  ->ArgsProduct({ { 1, 2, 4, 8 }, { 1, 8, 32, 128 } })
+  ->ArgNames({ "cores", "batch" })
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK(LockedRouting_Throughput)
+  ->RangeMultiplier(2)
+  ->Range(1, 8)
+  ->ArgName("cores")
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
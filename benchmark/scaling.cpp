@@ -0,0 +1,58 @@
+#include "scaling.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+/*
+ * Scaling of shared name containers across threads, with a mix of reads and
+ * writes. Arguments are the percentage of reads, and whether each thread is
+ * pinned to its own CPU.
+ *
+ * items_per_second is the throughput of all threads together, and
+ * ops_per_thread the average throughput of a thread. The latency percentiles
+ * are sampled on one operation in 16 of each thread, and averaged over the
+ * threads. For longer runs, other thread counts, or percentiles over all
+ * threads, use the qname_scaling driver.
+ */
+namespace
+{
+constexpr std::size_t entries = 100000;
+
+template<class Target>
+void Scaling(benchmark::State& state)
+{
+    static std::unique_ptr<Target> target;
+    if (state.thread_index() == 0) target = std::make_unique<Target>(entries);
+    std::optional<scaling::scoped_pin> pin;
+    if (state.range(1)) pin.emplace(static_cast<unsigned>(state.thread_index()));
+
+    scaling::worker worker(state.thread_index() + 1, static_cast<unsigned>(state.range(0)));
+    for ([[maybe_unused]] auto _ : state)
+    {
+        worker.step(*target);
+    }
+
+    using benchmark::Counter;
+    auto& latencies = worker.latencies();
+    state.SetItemsProcessed(state.iterations());
+    state.counters["ops_per_thread"] = Counter(double(state.iterations()), Counter::kAvgThreadsRate);
+    state.counters["p50_ns"] = Counter(latencies.percentile(0.50), Counter::kAvgThreads);
+    state.counters["p99_ns"] = Counter(latencies.percentile(0.99), Counter::kAvgThreads);
+    state.counters["p999_ns"] = Counter(latencies.percentile(0.999), Counter::kAvgThreads);
+}
+} // namespace
+
+#define SCALING_BENCHMARK(target)                                                                                      \
+    BENCHMARK_TEMPLATE(Scaling, target)                                                                                \
+      ->ArgsProduct({ { 100, 95, 50 }, { 0, 1 } })                                                                     \
+      ->ArgNames({ "read_pct", "pin" })                                                                                \
+      ->ThreadRange(1, 8)                                                                                              \
+      ->UseRealTime()
+
+SCALING_BENCHMARK(scaling::namespace_map_target);
+SCALING_BENCHMARK(scaling::name_hash_map_target);
+SCALING_BENCHMARK(scaling::atomic_name_target);
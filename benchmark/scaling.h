@@ -0,0 +1,290 @@
+#pragma once
+
+#include "workload.h"
+
+#include <quicr/atomic_name.h>
+#include <quicr/name.h>
+#include <quicr/name_hash_map.h>
+#include <quicr/namespace.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * A harness running readers and writers against shared name containers from
+ * many threads, used by both the Google Benchmark scaling benchmarks and the
+ * standalone scaling driver.
+ *
+ * Each target offers a read and a write operation on its shared state, and a
+ * worker runs a mix of them with a given percentage of reads, sampling the
+ * latency of some operations to report percentiles.
+ */
+namespace scaling
+{
+/**
+ * @brief Pins the calling thread to a CPU, wrapping around the CPUs of the machine.
+ *
+ * @param cpu The index of the CPU.
+ * @returns True if the thread was pinned, false if pinning is not supported or failed.
+ */
+inline bool pin_to_cpu(unsigned cpu)
+{
+#if defined(__linux__)
+    const unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % cpus, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/**
+ * @brief Pins the calling thread to a CPU while in scope, then restores the CPUs it could run on before.
+ *
+ * @details Google Benchmark runs the first thread of every run on the main
+ *          thread, so a pin left in place would hold every later run, and
+ *          the threads they spawn, on a single CPU.
+ */
+class scoped_pin
+{
+  public:
+    explicit scoped_pin(unsigned cpu)
+    {
+#if defined(__linux__)
+        _saved = pthread_getaffinity_np(pthread_self(), sizeof(_affinity), &_affinity) == 0;
+#endif
+        pin_to_cpu(cpu);
+    }
+
+    scoped_pin(const scoped_pin&) = delete;
+    scoped_pin& operator=(const scoped_pin&) = delete;
+
+    ~scoped_pin()
+    {
+#if defined(__linux__)
+        if (_saved) pthread_setaffinity_np(pthread_self(), sizeof(_affinity), &_affinity);
+#endif
+    }
+
+  private:
+#if defined(__linux__)
+    cpu_set_t _affinity;
+    bool _saved = false;
+#endif
+};
+
+/**
+ * @brief A namespace_map of conference namespaces behind a reader-writer lock.
+ *
+ * Reads look up a name, and writes erase and re-insert a namespace.
+ */
+class namespace_map_target
+{
+  public:
+    explicit namespace_map_target(std::size_t entries)
+      : _namespaces(workload::conference_namespaces(entries))
+      , _lookups(workload::uniform_lookups(_namespaces, lookup_count))
+    {
+        std::uint32_t value = 0;
+        for (const auto& ns : _namespaces)
+            _map.emplace(ns, value++);
+    }
+
+    bool read(std::uint64_t key)
+    {
+        std::shared_lock lock(_mutex);
+        return _map.find(_lookups[key & (lookup_count - 1)]) != _map.end();
+    }
+
+    void write(std::uint64_t key)
+    {
+        const auto& ns = _namespaces[key % _namespaces.size()];
+        std::unique_lock lock(_mutex);
+        _map.erase(ns);
+        _map.emplace(ns, std::uint32_t(key));
+    }
+
+  private:
+    static constexpr std::size_t lookup_count = 1 << 16;
+
+    std::vector<quicr::Namespace> _namespaces;
+    std::vector<quicr::Name> _lookups;
+    quicr::namespace_map<std::uint32_t> _map;
+    std::shared_mutex _mutex;
+};
+
+/**
+ * @brief A name_hash_map of random names behind a reader-writer lock.
+ *
+ * Reads find a name, and writes assign the value of a name.
+ */
+class name_hash_map_target
+{
+  public:
+    explicit name_hash_map_target(std::size_t entries) : _names(workload::random_names(entries))
+    {
+        std::uint64_t value = 0;
+        for (const auto& name : _names)
+            _map.try_emplace(name, value++);
+    }
+
+    bool read(std::uint64_t key)
+    {
+        std::shared_lock lock(_mutex);
+        return _map.find(_names[key % _names.size()]) != _map.end();
+    }
+
+    void write(std::uint64_t key)
+    {
+        std::unique_lock lock(_mutex);
+        _map.insert_or_assign(_names[key % _names.size()], key);
+    }
+
+  private:
+    std::vector<quicr::Name> _names;
+    quicr::name_hash_map<std::uint64_t> _map;
+    std::shared_mutex _mutex;
+};
+
+/**
+ * @brief An atomic name shared by all threads, like the object name of a publisher.
+ *
+ * Reads load the name, and writes take the next name.
+ */
+class atomic_name_target
+{
+  public:
+    explicit atomic_name_target(std::size_t) {}
+
+    bool read(std::uint64_t) { return _name.load() != quicr::Name{}; }
+    void write(std::uint64_t) { _name.fetch_add(1); }
+
+  private:
+    quicr::atomic_name _name = 0xA11CEE00F00001000000000000000000_name;
+};
+
+/**
+ * @brief The latencies sampled by a thread, in nanoseconds.
+ */
+class latency_samples
+{
+  public:
+    void add(std::uint64_t ns) { _samples.push_back(ns); }
+
+    void merge(const latency_samples& other)
+    {
+        _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+    }
+
+    std::size_t size() const noexcept { return _samples.size(); }
+
+    /**
+     * @brief The latency under which a fraction of the samples fall.
+     *
+     * @param fraction The fraction of samples, such as 0.99 for the 99th percentile.
+     * @returns The latency in nanoseconds, or 0 without samples.
+     */
+    double percentile(double fraction)
+    {
+        if (_samples.empty()) return 0;
+
+        const auto rank = static_cast<std::size_t>(fraction * double(_samples.size() - 1));
+        std::nth_element(_samples.begin(), _samples.begin() + rank, _samples.end());
+        return double(_samples[rank]);
+    }
+
+  private:
+    std::vector<std::uint64_t> _samples;
+};
+
+/**
+ * @brief Runs a mix of reads and writes against a target from one thread.
+ *
+ * @details Aligned to a cache line, so that the counters of workers stored
+ *          side by side are not shared between threads.
+ */
+class alignas(64) worker
+{
+  public:
+    /**
+     * @param seed The seed of the keys and of the choice between reads and writes.
+     * @param read_percent The percentage of operations that are reads.
+     * @param sample_every The interval between operations whose latency is sampled.
+     */
+    worker(std::uint64_t seed, unsigned read_percent, unsigned sample_every = 16)
+      : _state{ seed * 0x9E3779B97F4A7C15ull | 1 }, _read_percent{ read_percent }, _sample_every{ sample_every }
+    {
+    }
+
+    template<class Target>
+    void step(Target& target)
+    {
+        const std::uint64_t key = next();
+        const bool read = key % 100 < _read_percent;
+
+        if (++_ops % _sample_every != 0)
+        {
+            run(target, read, key);
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        run(target, read, key);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        _latencies.add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    std::uint64_t reads() const noexcept { return _reads; }
+    std::uint64_t writes() const noexcept { return _writes; }
+    std::uint64_t hits() const noexcept { return _hits; }
+    latency_samples& latencies() noexcept { return _latencies; }
+
+  private:
+    template<class Target>
+    void run(Target& target, bool read, std::uint64_t key)
+    {
+        if (read)
+        {
+            ++_reads;
+            _hits += target.read(key >> 8);
+        }
+        else
+        {
+            ++_writes;
+            target.write(key >> 8);
+        }
+    }
+
+    std::uint64_t next() noexcept
+    {
+        // xorshift64*, cheap enough not to weigh on the operations.
+        _state ^= _state >> 12;
+        _state ^= _state << 25;
+        _state ^= _state >> 27;
+        return _state * 0x2545F4914F6CDD1Dull;
+    }
+
+  private:
+    std::uint64_t _state;
+    unsigned _read_percent;
+    unsigned _sample_every;
+    std::uint64_t _ops = 0;
+    std::uint64_t _reads = 0;
+    std::uint64_t _writes = 0;
+    std::uint64_t _hits = 0;
+    latency_samples _latencies;
+};
+} // namespace scaling
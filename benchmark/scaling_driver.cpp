@@ -0,0 +1,181 @@
+#include "scaling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/*
+ * Standalone driver of the scaling harness, running readers and writers
+ * against a shared target for a fixed duration, and reporting the throughput
+ * of each thread and the latency percentiles over all threads.
+ *
+ * Usage: qname_scaling [--target=namespace_map|name_hash_map|atomic_name]
+ *                      [--threads=1,2,4,8] [--read-percent=95] [--seconds=1]
+ *                      [--entries=100000] [--sample-every=16] [--pin]
+ */
+namespace
+{
+struct options
+{
+    std::vector<std::string> targets = { "namespace_map", "name_hash_map", "atomic_name" };
+    std::vector<unsigned> threads = { 1, 2, 4, 8 };
+    unsigned read_percent = 95;
+    double seconds = 1.0;
+    std::size_t entries = 100000;
+    unsigned sample_every = 16;
+    bool pin = false;
+};
+
+template<class T>
+std::vector<T> parse_list(std::string_view list, T (*parse)(const std::string&))
+{
+    std::vector<T> values;
+    while (!list.empty())
+    {
+        const auto comma = list.find(',');
+        values.push_back(parse(std::string(list.substr(0, comma))));
+        list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+    }
+
+    return values;
+}
+
+options parse_options(int argc, char** argv)
+{
+    options opts;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        const auto eq = arg.find('=');
+        const std::string_view key = arg.substr(0, eq);
+        const std::string value = eq == std::string_view::npos ? std::string{} : std::string(arg.substr(eq + 1));
+
+        if (key == "--target")
+            opts.targets = parse_list<std::string>(value, [](const std::string& s) { return s; });
+        else if (key == "--threads")
+            opts.threads = parse_list<unsigned>(value, [](const std::string& s) { return unsigned(std::stoul(s)); });
+        else if (key == "--read-percent")
+            opts.read_percent = unsigned(std::stoul(value));
+        else if (key == "--seconds")
+            opts.seconds = std::stod(value);
+        else if (key == "--entries")
+            opts.entries = std::stoul(value);
+        else if (key == "--sample-every")
+            opts.sample_every = std::max(1u, unsigned(std::stoul(value)));
+        else if (key == "--pin")
+            opts.pin = true;
+        else
+            throw std::invalid_argument("Unknown option: " + std::string(arg));
+    }
+
+    if (opts.read_percent > 100) throw std::invalid_argument("Read percentage cannot exceed 100");
+    return opts;
+}
+
+template<class Target>
+void run(const char* name, const options& opts, unsigned thread_count)
+{
+    Target target(opts.entries);
+    std::vector<scaling::worker> workers;
+    for (unsigned i = 0; i < thread_count; ++i)
+        workers.emplace_back(i + 1, opts.read_percent, opts.sample_every);
+
+    std::atomic<unsigned> ready{ 0 };
+    std::atomic<bool> start{ false };
+    std::atomic<bool> stop{ false };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&, i] {
+            if (opts.pin) scaling::pin_to_cpu(i);
+            ++ready;
+            while (!start.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed))
+                workers[i].step(target);
+        });
+    }
+
+    while (ready.load() != thread_count)
+        std::this_thread::yield();
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::duration<double>(opts.seconds));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& t : threads)
+        t.join();
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    std::printf("%s: %u threads, %u%% reads%s\n", name, thread_count, opts.read_percent, opts.pin ? ", pinned" : "");
+
+    std::uint64_t total = 0;
+    scaling::latency_samples latencies;
+    for (unsigned i = 0; i < thread_count; ++i)
+    {
+        auto& w = workers[i];
+        const std::uint64_t ops = w.reads() + w.writes();
+        total += ops;
+        std::printf("  thread %2u: %12.0f ops/s  reads %llu  writes %llu  hits %llu  p99 %.0f ns\n",
+                    i,
+                    double(ops) / elapsed,
+                    static_cast<unsigned long long>(w.reads()),
+                    static_cast<unsigned long long>(w.writes()),
+                    static_cast<unsigned long long>(w.hits()),
+                    w.latencies().percentile(0.99));
+        latencies.merge(w.latencies());
+    }
+
+    std::printf("  total:     %12.0f ops/s  p50 %.0f ns  p90 %.0f ns  p99 %.0f ns  p99.9 %.0f ns  max %.0f ns\n\n",
+                double(total) / elapsed,
+                latencies.percentile(0.50),
+                latencies.percentile(0.90),
+                latencies.percentile(0.99),
+                latencies.percentile(0.999),
+                latencies.percentile(1.0));
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    options opts;
+    try
+    {
+        opts = parse_options(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return EXIT_FAILURE;
+    }
+
+    for (const auto& target : opts.targets)
+    {
+        for (const unsigned thread_count : opts.threads)
+        {
+            if (target == "namespace_map")
+                run<scaling::namespace_map_target>("namespace_map", opts, thread_count);
+            else if (target == "name_hash_map")
+                run<scaling::name_hash_map_target>("name_hash_map", opts, thread_count);
+            else if (target == "atomic_name")
+                run<scaling::atomic_name_target>("atomic_name", opts, thread_count);
+            else
+            {
+                std::fprintf(stderr, "Unknown target: %s\n", target.c_str());
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,199 @@
+#include "workload.h"
+
+#include <benchmark/benchmark.h>
+
+#include <quicr/name.h>
+#include <quicr/namespace.h>
+#include <quicr/subscriber_index.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+/*
+ * Matching the objects of a conference to their subscribers, where everyone
+ * subscribes to the conference, some to a media type and a few to a single
+ * client. Compares subscriber_index to a map of subscriber vectors merged on
+ * every object.
+ */
+namespace
+{
+using layout = workload::conference_layout;
+
+constexpr std::size_t lookup_count = 1 << 16;
+constexpr unsigned media_count = 4;
+constexpr unsigned client_count = 16;
+constexpr std::uint32_t client_subscriber_count = 8;
+
+/**
+ * The conference, its media types and their clients, each with its subscribers.
+ */
+struct conference
+{
+    std::vector<std::pair<quicr::Namespace, std::vector<std::uint32_t>>> subscriptions;
+    std::vector<quicr::Namespace> tracks;
+};
+
+conference make_conference(std::uint32_t subscriber_count)
+{
+    workload::rng_type rng(1);
+    conference result;
+
+    std::vector<std::uint32_t> everyone(subscriber_count);
+    for (std::uint32_t id = 0; id < subscriber_count; ++id)
+        everyone[id] = id;
+    result.subscriptions.emplace_back(layout::make_namespace(0xA11CEEu, 1u, 0xF00001u), everyone);
+
+    const auto some = [&](std::uint32_t count) {
+        std::vector<std::uint32_t> ids;
+        std::sample(everyone.begin(), everyone.end(), std::back_inserter(ids), count, rng);
+        return ids;
+    };
+
+    for (unsigned media = 0; media < media_count; ++media)
+    {
+        result.subscriptions.emplace_back(layout::make_namespace(0xA11CEEu, 1u, 0xF00001u, media),
+                                          some(subscriber_count / 10));
+        for (unsigned client = 0; client < client_count; ++client)
+        {
+            const auto track = layout::make_namespace(0xA11CEEu, 1u, 0xF00001u, media, client);
+            result.subscriptions.emplace_back(track, some(client_subscriber_count));
+            result.tracks.push_back(track);
+        }
+    }
+
+    return result;
+}
+
+std::vector<quicr::Name> make_objects(const conference& conf)
+{
+    workload::rng_type rng(2);
+    std::vector<quicr::Name> objects(lookup_count);
+    for (auto& name : objects)
+        name = workload::name_in(conf.tracks[rng() % conf.tracks.size()], rng);
+
+    return objects;
+}
+
+/**
+ * Subscribers kept by namespace, with the vectors of every namespace containing an object merged per object.
+ */
+class merging_index
+{
+  public:
+    explicit merging_index(const conference& conf)
+    {
+        for (const auto& [ns, ids] : conf.subscriptions)
+        {
+            _map.emplace(std::make_pair(ns.name(), ns.length()), ids);
+            if (std::find(_lengths.begin(), _lengths.end(), ns.length()) == _lengths.end())
+                _lengths.push_back(ns.length());
+        }
+    }
+
+    std::vector<std::uint32_t> match(const quicr::Name& name) const
+    {
+        std::vector<std::uint32_t> merged;
+        for (const auto length : _lengths)
+        {
+            const auto it = _map.find({ quicr::Namespace(name, length).name(), length });
+            if (it == _map.end()) continue;
+
+            std::vector<std::uint32_t> next;
+            next.reserve(merged.size() + it->second.size());
+            const auto& ids = it->second;
+            std::set_union(merged.begin(), merged.end(), ids.begin(), ids.end(), std::back_inserter(next));
+            merged.swap(next);
+        }
+
+        return merged;
+    }
+
+  private:
+    std::map<std::pair<quicr::Name, std::uint8_t>, std::vector<std::uint32_t>> _map;
+    std::vector<std::uint8_t> _lengths;
+};
+
+quicr::subscriber_index<> make_index(const conference& conf)
+{
+    quicr::subscriber_index<> index;
+    for (const auto& [ns, ids] : conf.subscriptions)
+    {
+        for (const auto id : ids)
+            index.subscribe(ns, id);
+    }
+
+    return index;
+}
+
+void SubscriberIndex_Match(benchmark::State& state)
+{
+    const auto conf = make_conference(static_cast<std::uint32_t>(state.range(0)));
+    const auto objects = make_objects(conf);
+    auto index = make_index(conf);
+
+    std::size_t i = 0;
+    std::size_t fanout = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        fanout += index.match(objects[i]).size();
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(fanout);
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void MergingIndex_Match(benchmark::State& state)
+{
+    const auto conf = make_conference(static_cast<std::uint32_t>(state.range(0)));
+    const auto objects = make_objects(conf);
+    const merging_index index(conf);
+
+    std::size_t i = 0;
+    std::size_t fanout = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        fanout += index.match(objects[i]).size();
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(fanout);
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * A subscriber joins or leaves a client track before every object, so that the union of that track is merged again.
+ */
+void SubscriberIndex_MatchChurn(benchmark::State& state)
+{
+    const auto conf = make_conference(static_cast<std::uint32_t>(state.range(0)));
+    const auto objects = make_objects(conf);
+    auto index = make_index(conf);
+
+    const auto late_joiner = static_cast<std::uint32_t>(state.range(0));
+    std::size_t i = 0;
+    std::size_t fanout = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const quicr::Namespace track(objects[i], conf.tracks.front().length());
+        if (!index.subscribe(track, late_joiner)) index.unsubscribe(track, late_joiner);
+
+        fanout += index.match(objects[i]).size();
+        i = (i + 1) & (lookup_count - 1);
+    }
+    benchmark::DoNotOptimize(fanout);
+
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+#define SUBSCRIBER_COUNTS RangeMultiplier(10)->Range(1000, 100000)
+
+BENCHMARK(SubscriberIndex_Match)->SUBSCRIBER_COUNTS;
+BENCHMARK(MergingIndex_Match)->SUBSCRIBER_COUNTS;
+BENCHMARK(SubscriberIndex_MatchChurn)->SUBSCRIBER_COUNTS;
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <quicr/name.h>
+#include <quicr/name_schema.h>
+#include <quicr/namespace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Generators of namespaces and names shaped like real workloads, shared by the benchmarks.
+ *
+ * Every generator takes a seed, so that runs compare the same inputs.
+ */
+namespace workload
+{
+using rng_type = std::mt19937_64;
+
+struct org;
+struct app;
+struct conf;
+struct media;
+struct client;
+struct object;
+
+/**
+ * The layout of names in a conferencing deployment.
+ */
+using conference_layout = quicr::name_schema<quicr::field<org, 24>,
+                                             quicr::field<app, 8>,
+                                             quicr::field<conf, 24>,
+                                             quicr::field<media, 8>,
+                                             quicr::field<client, 16>,
+                                             quicr::field<object, 48>>;
+
+inline quicr::Name random_name(rng_type& rng)
+{
+    const std::uint64_t hi = rng();
+    return quicr::Name(hi, rng());
+}
+
+/**
+ * @brief Samples indices in [0, n) with a Zipf distribution, where index 0 is the most frequent.
+ */
+class zipf_distribution
+{
+  public:
+    zipf_distribution(std::size_t n, double skew) : _cdf(n)
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            _cdf[i] = sum += 1.0 / std::pow(double(i + 1), skew);
+        for (auto& p : _cdf)
+            p /= sum;
+    }
+
+    std::size_t operator()(rng_type& rng) const
+    {
+        const double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        const auto it = std::lower_bound(_cdf.begin(), _cdf.end(), u);
+        return std::min<std::size_t>(it - _cdf.begin(), _cdf.size() - 1);
+    }
+
+  private:
+    std::vector<double> _cdf;
+};
+
+/**
+ * @brief Namespaces of random names, with lengths uniform between 16 and 112 bits.
+ */
+inline std::vector<quicr::Namespace> uniform_namespaces(std::size_t count, std::uint64_t seed = 1)
+{
+    rng_type rng(seed);
+    std::uniform_int_distribution<int> length(16, 112);
+
+    std::vector<quicr::Namespace> namespaces;
+    namespaces.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        namespaces.emplace_back(random_name(rng), static_cast<std::uint8_t>(length(rng)));
+
+    return namespaces;
+}
+
+/**
+ * @brief Namespaces of a conferencing deployment: conferences of a few
+ *        organisations, each with namespaces for all of its media, for each
+ *        media, and for the first few clients of each media.
+ */
+inline std::vector<quicr::Namespace> conference_namespaces(std::size_t count, std::uint64_t seed = 1)
+{
+    using layout = conference_layout;
+    constexpr unsigned media_count = 4;
+    constexpr unsigned client_count = 4;
+
+    rng_type rng(seed);
+    const std::size_t orgs = std::max<std::size_t>(1, count / 10000);
+
+    std::vector<quicr::Namespace> namespaces;
+    namespaces.reserve(count);
+    for (std::uint64_t conf_id = 0; namespaces.size() < count; ++conf_id)
+    {
+        const std::uint64_t org_id = 0xA11CEE + rng() % orgs;
+        const std::uint64_t app_id = rng() % 4;
+        namespaces.push_back(layout::make_namespace(org_id, app_id, conf_id));
+        for (std::uint64_t media_id = 0; media_id < media_count && namespaces.size() < count; ++media_id)
+        {
+            namespaces.push_back(layout::make_namespace(org_id, app_id, conf_id, media_id));
+            for (std::uint64_t client_id = 0; client_id < client_count && namespaces.size() < count; ++client_id)
+                namespaces.push_back(layout::make_namespace(org_id, app_id, conf_id, media_id, client_id));
+        }
+    }
+
+    std::shuffle(namespaces.begin(), namespaces.end(), rng);
+    return namespaces;
+}
+
+/**
+ * @brief Chains of nested namespaces, each a prefix of the next, with between 1 and max_depth links.
+ */
+inline std::vector<quicr::Namespace> nested_namespaces(std::size_t count, int max_depth = 8, std::uint64_t seed = 1)
+{
+    rng_type rng(seed);
+    std::uniform_int_distribution<int> depth(1, max_depth);
+    std::uniform_int_distribution<int> length(8, 120);
+
+    std::vector<quicr::Namespace> namespaces;
+    namespaces.reserve(count);
+    std::vector<int> lengths;
+    while (namespaces.size() < count)
+    {
+        const quicr::Name name = random_name(rng);
+
+        lengths.resize(depth(rng));
+        for (auto& l : lengths)
+            l = length(rng);
+        std::sort(lengths.begin(), lengths.end());
+        lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+
+        for (std::size_t i = 0; i < lengths.size() && namespaces.size() < count; ++i)
+            namespaces.emplace_back(name, static_cast<std::uint8_t>(lengths[i]));
+    }
+
+    std::shuffle(namespaces.begin(), namespaces.end(), rng);
+    return namespaces;
+}
+
+/**
+ * @brief A random name within a namespace.
+ */
+inline quicr::Name name_in(const quicr::Namespace& ns, rng_type& rng)
+{
+    const quicr::Name suffix_mask = ~(~quicr::Name{} << (quicr::Name::size_bits - ns.length()));
+    return ns.name() | (random_name(rng) & suffix_mask);
+}
+
+/**
+ * @brief Names within namespaces picked uniformly.
+ */
+inline std::vector<quicr::Name> uniform_lookups(const std::vector<quicr::Namespace>& namespaces,
+                                                std::size_t count,
+                                                std::uint64_t seed = 2)
+{
+    rng_type rng(seed);
+    std::uniform_int_distribution<std::size_t> index(0, namespaces.size() - 1);
+
+    std::vector<quicr::Name> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names.push_back(name_in(namespaces[index(rng)], rng));
+
+    return names;
+}
+
+/**
+ * @brief Names within namespaces picked with a Zipf distribution, so that a
+ *        few namespaces receive most lookups.
+ */
+inline std::vector<quicr::Name> zipf_lookups(const std::vector<quicr::Namespace>& namespaces,
+                                             std::size_t count,
+                                             double skew = 0.99,
+                                             std::uint64_t seed = 2)
+{
+    rng_type rng(seed);
+    const zipf_distribution index(namespaces.size(), skew);
+
+    std::vector<quicr::Name> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names.push_back(name_in(namespaces[index(rng)], rng));
+
+    return names;
+}
+
+/**
+ * @brief Random names.
+ */
+inline std::vector<quicr::Name> random_names(std::size_t count, std::uint64_t seed = 1)
+{
+    rng_type rng(seed);
+    std::vector<quicr::Name> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names.push_back(random_name(rng));
+
+    return names;
+}
+
+/**
+ * @brief Consecutive names, like the object names of a publisher.
+ */
+inline std::vector<quicr::Name> sequential_names(std::size_t count,
+                                                 quicr::Name first = 0xA11CEE00F00001000000000000000000_name)
+{
+    std::vector<quicr::Name> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names.push_back(first++);
+
+    return names;
+}
+
+/**
+ * @brief Random names with between 1 and 128 significant bits, so that their
+ *        unpadded hexadecimal strings vary in length.
+ */
+inline std::vector<quicr::Name> mixed_length_names(std::size_t count, std::uint64_t seed = 1)
+{
+    rng_type rng(seed);
+    std::uniform_int_distribution<int> bits(1, quicr::Name::size_bits);
+
+    std::vector<quicr::Name> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names.push_back(random_name(rng) >> (quicr::Name::size_bits - bits(rng)));
+
+    return names;
+}
+
+/**
+ * @brief The hexadecimal strings of names.
+ *
+ * @param names The names to format.
+ * @param prefix Whether the strings start with 0x.
+ * @param padded Whether the strings keep the leading zeros of the names.
+ */
+inline std::vector<std::string> hex_strings(const std::vector<quicr::Name>& names, bool prefix, bool padded)
+{
+    std::vector<std::string> strings;
+    strings.reserve(names.size());
+    for (const auto& name : names)
+    {
+        std::string hex = std::string(name).substr(2);
+        if (!padded) hex.erase(0, std::min(hex.find_first_not_of('0'), hex.size() - 1));
+        strings.push_back(prefix ? "0x" + hex : hex);
+    }
+
+    return strings;
+}
+
+/**
+ * The number of bytes currently allocated through counting_allocator.
+ */
+inline std::size_t allocated_bytes = 0;
+
+/**
+ * @brief An allocator tracking the bytes allocated by a container, to report its memory per entry.
+ */
+template<class T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+
+    template<class U>
+    counting_allocator(const counting_allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        allocated_bytes += n * sizeof(T);
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        allocated_bytes -= n * sizeof(T);
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<class U>
+    bool operator==(const counting_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+} // namespace workload
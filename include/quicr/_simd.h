@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace quicr::detail
+{
+#if defined(__AVX512F__)
+/**
+ * @brief Operations on the 64 bit words of 8 names at once, with AVX-512.
+ */
+struct name_lanes
+{
+    using vector = __m512i;
+    static constexpr std::size_t size = 8;
+
+    template<int N>
+    static vector srli(vector v) noexcept
+    {
+        return _mm512_srli_epi64(v, N);
+    }
+
+    template<int N>
+    static vector slli(vector v) noexcept
+    {
+        return _mm512_slli_epi64(v, N);
+    }
+
+    static vector and_mask(vector v, std::uint64_t mask) noexcept
+    {
+        return _mm512_and_si512(v, _mm512_set1_epi64(static_cast<long long>(mask)));
+    }
+
+    static vector or_(vector a, vector b) noexcept { return _mm512_or_si512(a, b); }
+    static vector zero() noexcept { return _mm512_setzero_si512(); }
+
+    static vector load_words(const std::uint64_t* words) noexcept { return _mm512_loadu_si512(words); }
+    static void store_words(std::uint64_t* words, vector v) noexcept { _mm512_storeu_si512(words, v); }
+
+    /**
+     * @brief Loads 8 names of 2 words each, splitting them into their low and high words.
+     */
+    static void load_pairs(const std::uint64_t* words, vector& lo, vector& hi) noexcept
+    {
+        const vector a = _mm512_loadu_si512(words);
+        const vector b = _mm512_loadu_si512(words + size);
+        lo = _mm512_permutex2var_epi64(a, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), b);
+        hi = _mm512_permutex2var_epi64(a, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), b);
+    }
+
+    /**
+     * @brief Stores the low and high words of 8 names, interleaving them back into names.
+     */
+    static void store_pairs(std::uint64_t* words, vector lo, vector hi) noexcept
+    {
+        _mm512_storeu_si512(words, _mm512_permutex2var_epi64(lo, _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), hi));
+        _mm512_storeu_si512(words + size,
+                            _mm512_permutex2var_epi64(lo, _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), hi));
+    }
+
+    /**
+     * @brief Loads 8 unsigned values, zero extending them to 64 bits.
+     */
+    template<typename UInt_t>
+    static vector load(const UInt_t* values) noexcept
+    {
+        if constexpr (sizeof(UInt_t) == 8) return _mm512_loadu_si512(values);
+        if constexpr (sizeof(UInt_t) == 4)
+            return _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+        if constexpr (sizeof(UInt_t) == 2)
+            return _mm512_cvtepu16_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+        if constexpr (sizeof(UInt_t) == 1)
+            return _mm512_cvtepu8_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+    }
+
+    /**
+     * @brief Stores 8 unsigned values, truncating them from 64 bits.
+     */
+    template<typename UInt_t>
+    static void store(UInt_t* values, vector v) noexcept
+    {
+        if constexpr (sizeof(UInt_t) == 8) _mm512_storeu_si512(values, v);
+        if constexpr (sizeof(UInt_t) == 4)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), _mm512_cvtepi64_epi32(v));
+        if constexpr (sizeof(UInt_t) == 2)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm512_cvtepi64_epi16(v));
+        if constexpr (sizeof(UInt_t) == 1)
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm512_cvtepi64_epi8(v));
+    }
+};
+#elif defined(__AVX2__)
+/**
+ * @brief Operations on the 64 bit words of 4 names at once, with AVX2.
+ */
+struct name_lanes
+{
+    using vector = __m256i;
+    static constexpr std::size_t size = 4;
+
+    template<int N>
+    static vector srli(vector v) noexcept
+    {
+        return _mm256_srli_epi64(v, N);
+    }
+
+    template<int N>
+    static vector slli(vector v) noexcept
+    {
+        return _mm256_slli_epi64(v, N);
+    }
+
+    static vector and_mask(vector v, std::uint64_t mask) noexcept
+    {
+        return _mm256_and_si256(v, _mm256_set1_epi64x(static_cast<long long>(mask)));
+    }
+
+    static vector or_(vector a, vector b) noexcept { return _mm256_or_si256(a, b); }
+    static vector zero() noexcept { return _mm256_setzero_si256(); }
+
+    static vector load_words(const std::uint64_t* words) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words));
+    }
+
+    static void store_words(std::uint64_t* words, vector v) noexcept
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(words), v);
+    }
+
+    /**
+     * @brief Loads 4 names of 2 words each, splitting them into their low and high words.
+     */
+    static void load_pairs(const std::uint64_t* words, vector& lo, vector& hi) noexcept
+    {
+        const vector a = load_words(words);
+        const vector b = load_words(words + size);
+        lo = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xD8);
+        hi = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xD8);
+    }
+
+    /**
+     * @brief Stores the low and high words of 4 names, interleaving them back into names.
+     */
+    static void store_pairs(std::uint64_t* words, vector lo, vector hi) noexcept
+    {
+        const vector a = _mm256_unpacklo_epi64(lo, hi);
+        const vector b = _mm256_unpackhi_epi64(lo, hi);
+        store_words(words, _mm256_permute2x128_si256(a, b, 0x20));
+        store_words(words + size, _mm256_permute2x128_si256(a, b, 0x31));
+    }
+
+    /**
+     * @brief Loads 4 unsigned values, zero extending them to 64 bits.
+     */
+    template<typename UInt_t>
+    static vector load(const UInt_t* values) noexcept
+    {
+        if constexpr (sizeof(UInt_t) == 8) return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+        if constexpr (sizeof(UInt_t) == 4)
+            return _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+        if constexpr (sizeof(UInt_t) == 2)
+            return _mm256_cvtepu16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+        if constexpr (sizeof(UInt_t) == 1)
+        {
+            std::int32_t bytes;
+            std::memcpy(&bytes, values, sizeof(bytes));
+            return _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+        }
+    }
+
+    /**
+     * @brief Stores 4 unsigned values, truncating them from 64 bits.
+     */
+    template<typename UInt_t>
+    static void store(UInt_t* values, vector v) noexcept
+    {
+        if constexpr (sizeof(UInt_t) == 8)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), v);
+        }
+        else
+        {
+            // Gather the low 32 bits of each lane, then the low bytes of those for narrower types.
+            const __m128i low =
+              _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0)));
+            if constexpr (sizeof(UInt_t) == 4) _mm_storeu_si128(reinterpret_cast<__m128i*>(values), low);
+            if constexpr (sizeof(UInt_t) == 2)
+            {
+                const __m128i words =
+                  _mm_shuffle_epi8(low, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(values), words);
+            }
+            if constexpr (sizeof(UInt_t) == 1)
+            {
+                const std::int32_t bytes = _mm_cvtsi128_si32(
+                  _mm_shuffle_epi8(low, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)));
+                std::memcpy(values, &bytes, sizeof(bytes));
+            }
+        }
+    }
+};
+#endif
+} // namespace quicr::detail
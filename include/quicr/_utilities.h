@@ -28,6 +28,17 @@ constexpr void str_n_copy(char* dst, const char* src, std::size_t n)
 }
 #endif
 
+/**
+ * @brief Checks if a character is a valid hexadecimal digit.
+ *
+ * @param hex The character to check.
+ * @returns True if the character is in [0-9a-fA-F], false otherwise.
+ */
+constexpr bool is_hexchar(char hex) noexcept
+{
+    return ('0' <= hex && hex <= '9') || ('A' <= hex && hex <= 'F') || ('a' <= hex && hex <= 'f');
+}
+
 /**
  * @brief Converts a hexadecimal character to it's decimal value.
  *
@@ -109,6 +120,121 @@ constexpr UInt_t hex_to_unsigned(const char* hex) noexcept
 }
 #endif
 
+/**
+ * @brief Multiplies two 64 bit integers and folds the 128 bit product back
+ *        into 64 bits by XORing its high and low halves.
+ *
+ * @param a The first multiplicand.
+ * @param b The second multiplicand.
+ * @returns The folded product.
+ */
+constexpr std::uint64_t mul_fold(std::uint64_t a, std::uint64_t b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+    const uint128_t product = uint128_t(a) * b;
+    return std::uint64_t(product) ^ std::uint64_t(product >> 64);
+#else
+    const std::uint64_t a_lo = a & 0xFFFFFFFF;
+    const std::uint64_t a_hi = a >> 32;
+    const std::uint64_t b_lo = b & 0xFFFFFFFF;
+    const std::uint64_t b_hi = b >> 32;
+
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t lo_hi = a_lo * b_hi;
+    const std::uint64_t hi_hi = a_hi * b_hi;
+
+    const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+    const std::uint64_t hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    const std::uint64_t lo = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+    return lo ^ hi;
+#endif
+}
+
+/**
+ * @brief Counts the number of consecutive 0 bits, starting from the least significant bit.
+ *
+ * @param value The value to count. If value is 0, returns 64.
+ * @returns The number of trailing zero bits.
+ */
+constexpr int countr_zero(std::uint64_t value) noexcept
+{
+    if (value == 0) return 64;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#else
+    int count = 0;
+    while (!(value & 1))
+    {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Counts the number of consecutive 0 bits, starting from the most significant bit.
+ *
+ * @param value The value to count. If value is 0, returns 64.
+ * @returns The number of leading zero bits.
+ */
+constexpr int countl_zero(std::uint64_t value) noexcept
+{
+    if (value == 0) return 64;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int count = 0;
+    while (!(value & (std::uint64_t(1) << 63)))
+    {
+        value <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Counts the number of 1 bits.
+ *
+ * @param value The value to count.
+ * @returns The number of set bits.
+ */
+constexpr int popcount(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#else
+    int count = 0;
+    for (; value; value &= value - 1)
+        ++count;
+    return count;
+#endif
+}
+
+/**
+ * @brief Reverses the bytes of an integer.
+ *
+ * @param value The value to reverse.
+ * @returns The value with its bytes in reverse order.
+ */
+constexpr std::uint64_t byteswap(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#else
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+        result = (result << 8) | (value & 0xFF);
+        value >>= 8;
+    }
+    return result;
+#endif
+}
+
 /**
  * @brief Converts an unsigned integer to a hexadecimal string.
  *
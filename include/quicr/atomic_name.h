@@ -0,0 +1,340 @@
+#pragma once
+
+#include "name.h"
+
+#include <atomic>
+#include <cstdint>
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace quicr
+{
+namespace detail
+{
+#if (defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))) || (defined(_MSC_VER) && defined(_M_X64))
+/**
+ * @brief Storage for an atomic Name, updated with the 128 bit compare-and-swap instruction cmpxchg16b.
+ *
+ * @details Every operation is a locked instruction, and is therefore
+ *          sequentially consistent. Loads are also performed with
+ *          cmpxchg16b, since x86-64 has no guaranteed atomic 16 byte load.
+ */
+class atomic_name_storage
+{
+  public:
+    static constexpr bool is_always_lock_free = true;
+
+    constexpr explicit atomic_name_storage(Name name) noexcept
+      : _words{ std::uint64_t(name), std::uint64_t(name >> 64) }
+    {
+    }
+
+    Name load() const noexcept
+    {
+        std::uint64_t lo = 0;
+        std::uint64_t hi = 0;
+        cmpxchg16b(lo, hi, 0, 0);
+        return Name(hi, lo);
+    }
+
+    bool compare_exchange(Name& expected, Name desired) noexcept
+    {
+        std::uint64_t lo = std::uint64_t(expected);
+        std::uint64_t hi = std::uint64_t(expected >> 64);
+        if (cmpxchg16b(lo, hi, std::uint64_t(desired), std::uint64_t(desired >> 64))) return true;
+
+        expected = Name(hi, lo);
+        return false;
+    }
+
+    /**
+     * @brief A possibly torn read of the current value, only usable as the initial guess of a CAS loop.
+     */
+    Name guess() const noexcept
+    {
+#if defined(_MSC_VER)
+        return Name(static_cast<std::uint64_t>(__iso_volatile_load64(reinterpret_cast<const __int64*>(&_words[1]))),
+                    static_cast<std::uint64_t>(__iso_volatile_load64(reinterpret_cast<const __int64*>(&_words[0]))));
+#else
+        return Name(__atomic_load_n(&_words[1], __ATOMIC_RELAXED), __atomic_load_n(&_words[0], __ATOMIC_RELAXED));
+#endif
+    }
+
+  private:
+    /**
+     * @brief Compares the stored value with expected, replacing it with desired if equal.
+     *        Otherwise, expected is updated with the stored value.
+     */
+    bool cmpxchg16b(std::uint64_t& expected_lo,
+                    std::uint64_t& expected_hi,
+                    std::uint64_t desired_lo,
+                    std::uint64_t desired_hi) const noexcept
+    {
+#if defined(_MSC_VER)
+        __int64 comparand[2] = { static_cast<__int64>(expected_lo), static_cast<__int64>(expected_hi) };
+        const bool exchanged = _InterlockedCompareExchange128(reinterpret_cast<volatile __int64*>(_words),
+                                                              static_cast<__int64>(desired_hi),
+                                                              static_cast<__int64>(desired_lo),
+                                                              comparand);
+        expected_lo = static_cast<std::uint64_t>(comparand[0]);
+        expected_hi = static_cast<std::uint64_t>(comparand[1]);
+        return exchanged;
+#else
+        bool exchanged;
+        __asm__ __volatile__("lock cmpxchg16b %1\n\t"
+                             "sete %0"
+                             : "=q"(exchanged), "+m"(_words), "+a"(expected_lo), "+d"(expected_hi)
+                             : "b"(desired_lo), "c"(desired_hi)
+                             : "cc", "memory");
+        return exchanged;
+#endif
+    }
+
+    alignas(16) mutable std::uint64_t _words[2];
+};
+#else
+/**
+ * @brief Storage for an atomic Name, protected by a sequence lock.
+ *
+ * @details Used where no 128 bit compare-and-swap is available. Readers never
+ *          block writers, and only retry if a write happened concurrently,
+ *          while writers are serialized by spinning on the sequence number.
+ */
+class atomic_name_storage
+{
+  public:
+    static constexpr bool is_always_lock_free = false;
+
+    constexpr explicit atomic_name_storage(Name name) noexcept
+      : _seq{ 0 }, _lo{ std::uint64_t(name) }, _hi{ std::uint64_t(name >> 64) }
+    {
+    }
+
+    Name load() const noexcept
+    {
+        for (;;)
+        {
+            const std::uint64_t seq = _seq.load(std::memory_order_acquire);
+            if (seq & 1) continue;
+
+            const std::uint64_t lo = _lo.load(std::memory_order_relaxed);
+            const std::uint64_t hi = _hi.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (_seq.load(std::memory_order_relaxed) == seq) return Name(hi, lo);
+        }
+    }
+
+    bool compare_exchange(Name& expected, Name desired) noexcept
+    {
+        const std::uint64_t seq = lock();
+
+        const Name current(_hi.load(std::memory_order_relaxed), _lo.load(std::memory_order_relaxed));
+        const bool exchanged = current == expected;
+        if (exchanged)
+        {
+            _lo.store(std::uint64_t(desired), std::memory_order_relaxed);
+            _hi.store(std::uint64_t(desired >> 64), std::memory_order_relaxed);
+        }
+        else
+        {
+            expected = current;
+        }
+
+        _seq.store(seq + 2, std::memory_order_release);
+        return exchanged;
+    }
+
+    Name guess() const noexcept { return load(); }
+
+  private:
+    /**
+     * @brief Makes the sequence number odd, waiting for any other writer to finish first.
+     * @returns The even sequence number before locking.
+     */
+    std::uint64_t lock() noexcept
+    {
+        std::uint64_t seq = _seq.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (!(seq & 1) && _seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire))
+            {
+                std::atomic_thread_fence(std::memory_order_release);
+                return seq;
+            }
+
+            seq = _seq.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<std::uint64_t> _seq;
+    std::atomic<std::uint64_t> _lo;
+    std::atomic<std::uint64_t> _hi;
+};
+#endif
+} // namespace detail
+
+/**
+ * @brief An atomic Name.
+ *
+ * @details On x86-64 this is lock-free, using the 128 bit compare-and-swap
+ *          instruction cmpxchg16b for every operation. On other platforms it
+ *          falls back to a sequence lock, where loads never take a lock.
+ *          Beyond load, store and compare-and-swap, it provides the
+ *          read-modify-write operations needed to track the latest object
+ *          of a track, such as fetch_add and advance.
+ */
+class atomic_name
+{
+  public:
+    static constexpr bool is_always_lock_free = detail::atomic_name_storage::is_always_lock_free;
+
+    constexpr atomic_name() noexcept : _storage{ Name(std::uint64_t(0), std::uint64_t(0)) } {}
+    constexpr atomic_name(Name name) noexcept : _storage{ name } {}
+
+    atomic_name(const atomic_name&) = delete;
+    atomic_name& operator=(const atomic_name&) = delete;
+
+    bool is_lock_free() const noexcept { return is_always_lock_free; }
+
+    /*=======================================================================*/
+    // Load/Store
+    /*=======================================================================*/
+
+    Name load() const noexcept { return _storage.load(); }
+    operator Name() const noexcept { return load(); }
+
+    void store(Name name) noexcept { exchange(name); }
+
+    Name operator=(Name name) noexcept
+    {
+        store(name);
+        return name;
+    }
+
+    /**
+     * @brief Replaces the stored name.
+     * @returns The previously stored name.
+     */
+    Name exchange(Name name) noexcept
+    {
+        return update([&](const Name&) { return name; });
+    }
+
+    /**
+     * @brief Replaces the stored name with desired if it is equal to expected,
+     *        otherwise loads the stored name into expected.
+     * @returns True if the name was replaced.
+     */
+    bool compare_exchange_strong(Name& expected, Name desired) noexcept
+    {
+        return _storage.compare_exchange(expected, desired);
+    }
+
+    /**
+     * @brief Same as compare_exchange_strong, as cmpxchg16b never fails spuriously.
+     */
+    bool compare_exchange_weak(Name& expected, Name desired) noexcept
+    {
+        return _storage.compare_exchange(expected, desired);
+    }
+
+    /*=======================================================================*/
+    // Read-Modify-Write Operations
+    /*=======================================================================*/
+
+    /**
+     * @brief Adds value to the stored name, carrying into the high bits.
+     * @returns The previously stored name.
+     */
+    Name fetch_add(std::uint64_t value) noexcept
+    {
+        return update([&](const Name& name) { return name + value; });
+    }
+
+    /**
+     * @brief Subtracts value from the stored name, borrowing from the high bits.
+     * @returns The previously stored name.
+     */
+    Name fetch_sub(std::uint64_t value) noexcept
+    {
+        return update([&](const Name& name) { return name - value; });
+    }
+
+    /**
+     * @brief Adds value to only the lowest bits of the stored name, wrapping
+     *        around within them and leaving the other bits untouched.
+     *
+     * @param value The value to add.
+     * @param bits The number of low bits to add to, such as the width of an object id.
+     * @returns The previously stored name.
+     */
+    Name fetch_add(std::uint64_t value, std::uint16_t bits) noexcept
+    {
+        const Name one(std::uint64_t(0), std::uint64_t(1));
+        const Name mask = bits >= sizeof(Name) * 8 ? ~(one - 1) : (one << bits) - 1;
+        return update([&](const Name& name) { return (name & ~mask) | ((name + value) & mask); });
+    }
+
+    Name fetch_and(const Name& value) noexcept
+    {
+        return update([&](const Name& name) { return name & value; });
+    }
+
+    Name fetch_or(const Name& value) noexcept
+    {
+        return update([&](const Name& name) { return name | value; });
+    }
+
+    Name fetch_xor(const Name& value) noexcept
+    {
+        return update([&](const Name& name) { return name ^ value; });
+    }
+
+    /**
+     * @brief Stores the greater of the stored name and name.
+     * @details The stored name is compared with name only once a compare-and-swap
+     *          confirms it, as the initial guess may be torn. When name is not
+     *          greater, the stored name is swapped with itself.
+     * @returns The previously stored name.
+     */
+    Name fetch_max(Name name) noexcept
+    {
+        return update([&](const Name& stored) { return stored < name ? name : stored; });
+    }
+
+    /**
+     * @brief Stores the lesser of the stored name and name.
+     * @details Same as fetch_max, keeping the lesser name.
+     * @returns The previously stored name.
+     */
+    Name fetch_min(Name name) noexcept
+    {
+        return update([&](const Name& stored) { return name < stored ? name : stored; });
+    }
+
+    /**
+     * @brief Advances the stored name to name, only if name is greater. Keeps
+     *        the stored name monotonically increasing across threads.
+     * @returns True if the stored name was advanced.
+     */
+    bool advance(Name name) noexcept { return fetch_max(name) < name; }
+
+  private:
+    /**
+     * @brief Atomically replaces the stored name with op(stored name).
+     * @returns The previously stored name.
+     */
+    template<class Op>
+    Name update(Op&& op) noexcept
+    {
+        Name expected = _storage.guess();
+        while (!_storage.compare_exchange(expected, op(expected)))
+            ;
+        return expected;
+    }
+
+    detail::atomic_name_storage _storage;
+};
+} // namespace quicr
@@ -0,0 +1,440 @@
+#pragma once
+
+#include "_utilities.h"
+#include "name.h"
+#include "namespace.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace quicr
+{
+namespace detail
+{
+/**
+ * @brief Finds the position of the rank-th (0-indexed) set bit of a word.
+ */
+inline int select_in_word(std::uint64_t word, std::uint64_t rank) noexcept
+{
+#if defined(__BMI2__)
+    return utility::countr_zero(_pdep_u64(std::uint64_t(1) << rank, word));
+#else
+    for (; rank; --rank)
+        word &= word - 1;
+    return utility::countr_zero(word);
+#endif
+}
+} // namespace detail
+
+/**
+ * @brief An immutable, compressed set of sorted Names.
+ *
+ * @details Names are split into blocks of up to block_size names, where every
+ *          name of a block is within 64 bits of the block's first name. Each
+ *          block stores its first name in full, and the offsets of its names
+ *          from it with Elias-Fano encoding: the low bits of every offset are
+ *          packed verbatim, and the high bits are stored as a unary coded
+ *          bit vector. Sequential object ids compress to just over 2 bits
+ *          per name, and offsets with an average gap of g take roughly
+ *          2 + log2(g) bits.
+ *
+ *          Lookups binary search the first names of the blocks, then only
+ *          decode the names of one block near the searched name, without
+ *          decompressing anything else.
+ */
+class elias_fano_name_set
+{
+    struct block
+    {
+        std::uint64_t first_rank;
+        std::uint64_t upper_offset;
+        std::uint64_t lower_offset;
+        std::uint32_t max_high;
+        std::uint16_t count;
+        std::uint8_t low_bits;
+    };
+
+  public:
+    static constexpr std::size_t block_size = 256;
+
+    using key_type = Name;
+    using value_type = Name;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     * @brief Forward iterator decoding names one at a time.
+     */
+    class const_iterator
+    {
+        friend class elias_fano_name_set;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Name;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Name;
+
+        const_iterator() noexcept = default;
+
+        Name operator*() const noexcept { return _set->value(_block, _index, _pos); }
+
+        const_iterator& operator++() noexcept
+        {
+            ++_rank;
+            if (++_index < _set->_blocks[_block].count)
+            {
+                _pos = _set->select<true>(_pos + 1, 0);
+            }
+            else if (++_block < _set->_blocks.size())
+            {
+                _index = 0;
+                _pos = _set->select<true>(_set->_blocks[_block].upper_offset, 0);
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto it = *this;
+            ++*this;
+            return it;
+        }
+
+        /**
+         * @brief The number of names before the iterator.
+         */
+        size_type rank() const noexcept { return _rank; }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept
+        {
+            return a._rank == b._rank;
+        }
+
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) noexcept { return !(a == b); }
+
+      private:
+        const_iterator(const elias_fano_name_set* set,
+                       std::size_t block,
+                       std::size_t index,
+                       std::uint64_t pos,
+                       size_type rank) noexcept
+          : _set{ set }, _block{ block }, _index{ index }, _pos{ pos }, _rank{ rank }
+        {
+        }
+
+        const elias_fano_name_set* _set = nullptr;
+        std::size_t _block = 0;
+        std::size_t _index = 0;
+        std::uint64_t _pos = 0;
+        size_type _rank = 0;
+    };
+
+    using iterator = const_iterator;
+
+    elias_fano_name_set() = default;
+
+    /**
+     * @brief Builds the set from sorted names, such as the output of radix_sort_unique.
+     *
+     * @param first The beginning of the names.
+     * @param last The end of the names.
+     * @throws std::invalid_argument If the names are not sorted and unique.
+     */
+    template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    elias_fano_name_set(InputIt first, InputIt last)
+    {
+        std::vector<std::uint64_t> offsets;
+        offsets.reserve(block_size);
+
+        Name base(std::uint64_t(0), std::uint64_t(0));
+        Name previous = base;
+        for (; first != last; ++first)
+        {
+            const Name name = *first;
+            if (!offsets.empty())
+            {
+                if (name <= previous) throw std::invalid_argument("Names must be sorted and unique");
+
+                const Name offset = name - base;
+                if (offsets.size() < block_size && std::uint64_t(offset >> 64) == 0)
+                {
+                    offsets.push_back(std::uint64_t(offset));
+                    previous = name;
+                    continue;
+                }
+
+                append_block(base, offsets);
+            }
+
+            base = previous = name;
+            offsets.assign(1, 0);
+        }
+
+        if (!offsets.empty()) append_block(base, offsets);
+
+        // Padding, so that reads may always load the word after the last.
+        _upper.push_back(0);
+        _lower.push_back(0);
+        _bases.shrink_to_fit();
+        _blocks.shrink_to_fit();
+        _upper.shrink_to_fit();
+        _lower.shrink_to_fit();
+    }
+
+    elias_fano_name_set(std::initializer_list<Name> names) : elias_fano_name_set(names.begin(), names.end()) {}
+
+    /*=======================================================================*/
+    // Iterators
+    /*=======================================================================*/
+
+    const_iterator begin() const noexcept
+    {
+        if (empty()) return end();
+        return const_iterator(this, 0, 0, select<true>(0, 0), 0);
+    }
+
+    const_iterator end() const noexcept { return const_iterator(this, _blocks.size(), 0, 0, _size); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /*=======================================================================*/
+    // Capacity
+    /*=======================================================================*/
+
+    bool empty() const noexcept { return _size == 0; }
+    size_type size() const noexcept { return _size; }
+
+    /**
+     * @brief The number of bytes used by the encoded names and block index.
+     */
+    size_type memory_usage() const noexcept
+    {
+        return _bases.capacity() * sizeof(Name) + _blocks.capacity() * sizeof(block) +
+               (_upper.capacity() + _lower.capacity()) * sizeof(std::uint64_t);
+    }
+
+    /*=======================================================================*/
+    // Lookup
+    /*=======================================================================*/
+
+    /**
+     * @brief Finds the first name not less than the given name.
+     */
+    const_iterator lower_bound(const Name& name) const noexcept
+    {
+        const auto next = std::upper_bound(_bases.begin(), _bases.end(), name);
+        if (next == _bases.begin()) return begin();
+
+        const std::size_t b = static_cast<std::size_t>(next - _bases.begin()) - 1;
+        const Name offset = name - _bases[b];
+        if (std::uint64_t(offset >> 64) == 0)
+        {
+            auto it = lower_bound_in_block(b, std::uint64_t(offset));
+            if (it._index < _blocks[b].count) return it;
+        }
+
+        return block_begin(b + 1);
+    }
+
+    /**
+     * @brief Finds the first name greater than the given name.
+     */
+    const_iterator upper_bound(const Name& name) const noexcept
+    {
+        auto it = lower_bound(name);
+        if (it != end() && *it == name) ++it;
+        return it;
+    }
+
+    const_iterator find(const Name& name) const noexcept
+    {
+        auto it = lower_bound(name);
+        return it != end() && *it == name ? it : end();
+    }
+
+    bool contains(const Name& name) const noexcept { return find(name) != end(); }
+    size_type count(const Name& name) const noexcept { return contains(name); }
+
+    /**
+     * @brief The least name in the set not less than the given name.
+     * @returns The successor, or std::nullopt if every name is less than the given name.
+     */
+    std::optional<Name> successor(const Name& name) const noexcept
+    {
+        auto it = lower_bound(name);
+        if (it == end()) return std::nullopt;
+        return *it;
+    }
+
+    /**
+     * @brief The number of names in the set less than the given name.
+     */
+    size_type rank(const Name& name) const noexcept { return lower_bound(name).rank(); }
+
+    /**
+     * @brief The name at the given position in sorted order.
+     * @throws std::out_of_range If rank is not less than size().
+     */
+    Name select(size_type rank) const
+    {
+        if (rank >= _size) throw std::out_of_range("Rank is outside of the elias_fano_name_set");
+
+        const auto next = std::upper_bound(
+          _blocks.begin(), _blocks.end(), rank, [](size_type r, const block& b) { return r < b.first_rank; });
+        const std::size_t b = static_cast<std::size_t>(next - _blocks.begin()) - 1;
+        const std::size_t index = rank - _blocks[b].first_rank;
+        return value(b, index, select<true>(_blocks[b].upper_offset, index));
+    }
+
+    /**
+     * @brief Finds the range of names within a namespace.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const Namespace& ns) const noexcept
+    {
+        const Name all_bits(~std::uint64_t(0), ~std::uint64_t(0));
+        const Name last = ns.name() | ~all_bits.bits(sizeof(Name) * 8 - ns.length(), ns.length());
+        return { lower_bound(ns.name()), upper_bound(last) };
+    }
+
+  private:
+    void append_block(const Name& base, const std::vector<std::uint64_t>& offsets)
+    {
+        const std::uint64_t count = offsets.size();
+        const std::uint64_t universe = offsets.back();
+
+        std::uint8_t low_bits = 0;
+        if (universe / count > 0) low_bits = static_cast<std::uint8_t>(63 - utility::countl_zero(universe / count));
+
+        block info;
+        info.first_rank = _size;
+        info.upper_offset = _upper_bits;
+        info.lower_offset = _lower_bits;
+        info.max_high = static_cast<std::uint32_t>(universe >> low_bits);
+        info.count = static_cast<std::uint16_t>(count);
+        info.low_bits = low_bits;
+
+        _upper_bits += info.max_high + count;
+        _upper.resize((_upper_bits + 63) / 64, 0);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            const std::uint64_t pos = info.upper_offset + (offsets[i] >> low_bits) + i;
+            _upper[pos / 64] |= std::uint64_t(1) << (pos % 64);
+        }
+
+        if (low_bits)
+        {
+            const std::uint64_t low_mask = ~std::uint64_t(0) >> (64 - low_bits);
+            _lower_bits += count * low_bits;
+            _lower.resize((_lower_bits + 63) / 64 + 1, 0);
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                const std::uint64_t pos = info.lower_offset + i * low_bits;
+                const std::uint64_t low = offsets[i] & low_mask;
+                _lower[pos / 64] |= low << (pos % 64);
+                if (pos % 64 + low_bits > 64) _lower[pos / 64 + 1] |= low >> (64 - pos % 64);
+            }
+            _lower.resize((_lower_bits + 63) / 64);
+        }
+
+        _bases.push_back(base);
+        _blocks.push_back(info);
+        _size += count;
+    }
+
+    /**
+     * @brief Finds the position of the rank-th set (or unset) bit of the upper bits, starting from start.
+     */
+    template<bool One>
+    std::uint64_t select(std::uint64_t start, std::uint64_t rank) const noexcept
+    {
+        std::size_t w = start / 64;
+        std::uint64_t word = (One ? _upper[w] : ~_upper[w]) & (~std::uint64_t(0) << (start % 64));
+        for (;;)
+        {
+            const std::uint64_t count = static_cast<std::uint64_t>(utility::popcount(word));
+            if (rank < count) return w * 64 + static_cast<std::uint64_t>(detail::select_in_word(word, rank));
+
+            rank -= count;
+            ++w;
+            word = One ? _upper[w] : ~_upper[w];
+        }
+    }
+
+    /**
+     * @brief Decodes the name at index of a block, whose upper bit is at pos.
+     */
+    Name value(std::size_t b, std::size_t index, std::uint64_t pos) const noexcept
+    {
+        const block& info = _blocks[b];
+        const std::uint64_t high = pos - info.upper_offset - index;
+        if (info.low_bits == 0) return _bases[b] + high;
+
+        const std::uint64_t low_pos = info.lower_offset + index * info.low_bits;
+        std::uint64_t low = _lower[low_pos / 64] >> (low_pos % 64);
+        if (low_pos % 64 + info.low_bits > 64) low |= _lower[low_pos / 64 + 1] << (64 - low_pos % 64);
+        low &= ~std::uint64_t(0) >> (64 - info.low_bits);
+
+        return _bases[b] + ((high << info.low_bits) | low);
+    }
+
+    const_iterator block_begin(std::size_t b) const noexcept
+    {
+        if (b >= _blocks.size()) return end();
+        return const_iterator(this, b, 0, select<true>(_blocks[b].upper_offset, 0), _blocks[b].first_rank);
+    }
+
+    /**
+     * @brief Finds the first name of a block whose offset is not less than the given offset.
+     * @returns An iterator whose index is the block's count if there is none.
+     */
+    const_iterator lower_bound_in_block(std::size_t b, std::uint64_t offset) const noexcept
+    {
+        const block& info = _blocks[b];
+        const std::uint64_t high = offset >> info.low_bits;
+        if (high > info.max_high) return const_iterator(this, b, info.count, 0, info.first_rank + info.count);
+
+        // Skip every name with lower high bits: they are the set bits before the high-th unset bit.
+        std::size_t index = 0;
+        std::uint64_t pos = info.upper_offset;
+        if (high > 0)
+        {
+            const std::uint64_t zero = select<false>(info.upper_offset, high - 1);
+            index = static_cast<std::size_t>(zero - info.upper_offset - (high - 1));
+            pos = zero + 1;
+        }
+
+        const_iterator it(this, b, index, 0, info.first_rank + index);
+        if (index == info.count) return it;
+
+        const Name target = _bases[b] + offset;
+        it._pos = select<true>(pos, 0);
+        while (it._index < info.count && *it < target)
+        {
+            ++it._index;
+            ++it._rank;
+            if (it._index < info.count) it._pos = select<true>(it._pos + 1, 0);
+        }
+        return it;
+    }
+
+    std::vector<Name> _bases;
+    std::vector<block> _blocks;
+    std::vector<std::uint64_t> _upper;
+    std::vector<std::uint64_t> _lower;
+    std::uint64_t _upper_bits = 0;
+    std::uint64_t _lower_bits = 0;
+    size_type _size = 0;
+};
+} // namespace quicr
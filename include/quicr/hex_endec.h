@@ -1,5 +1,6 @@
 #pragma once
 
+#include "_simd.h"
 #include "_utilities.h"
 #include "name.h"
 
@@ -7,6 +8,9 @@
 #include <array>
 #include <cstdint>
 #include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #if __cplusplus >= 202002L
 #include <concepts>
@@ -31,6 +35,9 @@ namespace quicr
  * Describes a 64 bit hex value, distributed into 3 sections 32bit, 24bit, and
  * 8bit respectively.
  *
+ * Names are encoded into and decoded from a BasicName<Size>, or a
+ * BasicName<64> when Size is smaller than 64 bits.
+ *
  * @tparam Size The maximum size in bits of the Hex string
  * @tparam Dist The distribution of bits for each value passed.
  */
@@ -38,46 +45,87 @@ template<std::uint16_t Size, uint16_t... Dist>
 class HexEndec
 {
     static_assert((Size & (Size - 1)) == 0, "Size must be a power of 2");
-    static_assert(Size <= sizeof(quicr::Name) * 8, "Size must not exceed sizeof(quicr::Name) * 8");
 
   public:
+    /**
+     * The name type values are encoded into, of at least Size bits.
+     */
+    using name_type = BasicName<(Size < 64 ? 64 : Size)>;
+
+    /**
+     * The name type hex strings are parsed into, so that strings formatted
+     * from a Name decode with narrower layouts too.
+     */
+    using parse_type = BasicName<(Size < 128 ? 128 : Size)>;
+
     constexpr HexEndec() noexcept { static_assert(Size == (Dist + ...), "Total bits must be equal to Size"); }
 
+    /**
+     * @brief The number of bits of a value in the distribution.
+     *
+     * @param index The index of the value in Dist.
+     * @returns The number of bits of the value.
+     */
+    static constexpr std::uint16_t Width(std::size_t index)
+    {
+        constexpr std::uint16_t distribution[] = { Dist... };
+        if (index >= sizeof...(Dist)) throw std::out_of_range("Index is outside of the distribution of bits");
+
+        return distribution[index];
+    }
+
+    /**
+     * @brief The position of the least significant bit of a value in the distribution.
+     *
+     * @param index The index of the value in Dist.
+     * @returns The offset of the value in bits, where 0 is the least significant bit.
+     */
+    static constexpr std::uint16_t Offset(std::size_t index)
+    {
+        constexpr std::uint16_t distribution[] = { Dist... };
+        if (index >= sizeof...(Dist)) throw std::out_of_range("Index is outside of the distribution of bits");
+
+        std::uint16_t offset = Size;
+        for (std::size_t i = 0; i <= index; ++i)
+            offset -= distribution[i];
+
+        return offset;
+    }
+
     /**
      * @brief Encodes the last Dist bits of values in order according to distribution
-     *        of Dist and builds a hex string that is the size in bits of Size.
+     *        of Dist into a name, without going through a hex string.
      *
      * @tparam UInt_ts The unsigned integer types to be passed.
-     * @param values The unsigned values to be encoded into the hex string.
+     * @param values The unsigned values to be encoded into the name.
      *
-     * @returns Hex string containing the provided values distributed according
-     *          to Dist in order.
+     * @returns Name containing the provided values distributed according to
+     *          Dist in order, which is a constant expression if the values are.
      */
 #if __cplusplus >= 202002L
     template<std::unsigned_integral... UInt_ts>
 #else
     template<typename... UInt_ts, typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
 #endif
-    static inline std::string Encode(UInt_ts... values)
+    static constexpr name_type EncodeName(UInt_ts... values)
     {
         static_assert(Size == (Dist + ...), "Total bits cannot exceed specified size");
         static_assert(sizeof...(Dist) == sizeof...(UInt_ts), "Number of values should match distribution of bits");
 
-        std::array<std::uint16_t, sizeof...(Dist)> distribution{ Dist... };
-        std::array<std::uint64_t, sizeof...(UInt_ts)> vals{ values... };
-#if __cplusplus >= 202002L
-        return Encode(distribution, std::span<std::uint64_t>(vals));
-#else
-        return Encode(distribution, vals);
-#endif
+        const std::uint64_t vals[] = { values... };
+        name_type bits{};
+        for (std::size_t i = 0; i < sizeof...(Dist); ++i)
+            bits |= (name_type{} | (vals[i] & ValueMask(Width(i)))) << Offset(i);
+
+        return bits;
     }
 
 #if __cplusplus >= 202002L
     template<std::unsigned_integral... UInt_ts>
-    static inline std::string Encode(std::span<std::uint16_t> distribution, UInt_ts... values)
+    static constexpr name_type EncodeName(std::span<std::uint16_t> distribution, UInt_ts... values)
 #else
     template<typename... UInt_ts, typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
-    static inline std::string Encode(std::vector<std::uint16_t> distribution, UInt_ts... values)
+    static inline name_type EncodeName(std::vector<std::uint16_t> distribution, UInt_ts... values)
 #endif
     {
         if (Size < std::accumulate(distribution.begin(), distribution.end(), 0))
@@ -85,34 +133,75 @@ class HexEndec
 
         std::array<std::uint64_t, sizeof...(UInt_ts)> vals{ values... };
 #if __cplusplus >= 202002L
-        return Encode(distribution, std::span<std::uint64_t>(vals));
+        return EncodeName(distribution, std::span<std::uint64_t>(vals));
 #else
-        return Encode(distribution, vals);
+        return EncodeName(distribution, vals);
 #endif
     }
 
 #if __cplusplus >= 202002L
-    static inline std::string Encode(std::span<std::uint16_t> distribution, std::span<std::uint64_t> values)
+    static constexpr name_type EncodeName(std::span<std::uint16_t> distribution, std::span<std::uint64_t> values)
 #else
-    template<std::size_t D_N, std::size_t V_N>
-    static inline std::string Encode(std::array<std::uint16_t, D_N> distribution, std::array<std::uint64_t, V_N> values)
+    template<typename Distribution, std::size_t V_N>
+    static constexpr name_type EncodeName(const Distribution& distribution, std::array<std::uint64_t, V_N> values)
 #endif
     {
         if (distribution.size() != values.size())
             throw std::invalid_argument("Number of values should match distribution of bits");
 
-        quicr::Name bits = 0x0_name;
+        name_type bits{};
         for (size_t i = 0; i < values.size(); ++i)
         {
-            const auto& value = values[i];
-            const auto& dist = distribution[i];
+            const auto dist = distribution[i];
             bits <<= dist;
-            bits |= (dist >= sizeof(uint64_t) * 8) ? value : (value & ~(~0x0ull << dist));
-        };
+            bits |= values[i] & ValueMask(dist);
+        }
+
+        return bits;
+    }
+
+    /**
+     * @brief Encodes the last Dist bits of values in order according to distribution
+     *        of Dist and builds a hex string that is the size in bits of Size.
+     *
+     * @details Formats the name built by EncodeName, which should be preferred
+     *          when the result is only converted back into a name.
+     *
+     * @tparam UInt_ts The unsigned integer types to be passed.
+     * @param values The unsigned values to be encoded into the hex string.
+     *
+     * @returns Hex string containing the provided values distributed according
+     *          to Dist in order.
+     */
+#if __cplusplus >= 202002L
+    template<std::unsigned_integral... UInt_ts>
+#else
+    template<typename... UInt_ts, typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
+#endif
+    static inline std::string Encode(UInt_ts... values)
+    {
+        return EncodeName(values...);
+    }
 
-        if constexpr (Size == sizeof(quicr::Name) * 8) return bits;
+#if __cplusplus >= 202002L
+    template<std::unsigned_integral... UInt_ts>
+    static inline std::string Encode(std::span<std::uint16_t> distribution, UInt_ts... values)
+#else
+    template<typename... UInt_ts, typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
+    static inline std::string Encode(std::vector<std::uint16_t> distribution, UInt_ts... values)
+#endif
+    {
+        return EncodeName(distribution, values...);
+    }
 
-        return "0x" + utility::unsigned_to_hex(bits.bits<std::uint64_t>(0, Size));
+#if __cplusplus >= 202002L
+    static inline std::string Encode(std::span<std::uint16_t> distribution, std::span<std::uint64_t> values)
+#else
+    template<std::size_t D_N, std::size_t V_N>
+    static inline std::string Encode(std::array<std::uint16_t, D_N> distribution, std::array<std::uint64_t, V_N> values)
+#endif
+    {
+        return EncodeName(distribution, values);
     }
 
     /**
@@ -130,13 +219,13 @@ class HexEndec
     template<std::unsigned_integral UInt_t = std::uint64_t>
     static constexpr std::array<UInt_t, sizeof...(Dist)> Decode(std::string_view hex)
     {
-        return Decode<UInt_t>(quicr::Name(hex));
+        return Decode<UInt_t>(parse_type(hex));
     }
 #else
     template<typename UInt_t = std::uint64_t, typename std::enable_if_t<std::is_unsigned_v<UInt_t>, bool> = true>
     static constexpr std::array<UInt_t, sizeof...(Dist)> Decode(const char* hex)
     {
-        return Decode<UInt_t>(quicr::Name(hex));
+        return Decode<UInt_t>(parse_type(hex));
     }
 #endif
 
@@ -145,20 +234,167 @@ class HexEndec
 #else
     template<typename UInt_t = std::uint64_t, typename std::enable_if_t<std::is_unsigned_v<UInt_t>, bool> = true>
 #endif
-    static constexpr std::array<UInt_t, sizeof...(Dist)> Decode(quicr::Name name)
+    static constexpr std::array<UInt_t, sizeof...(Dist)> Decode(const name_type& name) noexcept
     {
         static_assert(Size >= (Dist + ...), "Total bits cannot exceed specified size");
 
-        std::array<std::uint16_t, sizeof...(Dist)> distribution{ Dist... };
-        return Decode<sizeof...(Dist), UInt_t>(distribution, name);
+        return DecodeAll<UInt_t>(name, std::make_index_sequence<sizeof...(Dist)>{});
     }
 
+    /**
+     * @brief Decodes a name wider than name_type, such as a Name, from its
+     *        least significant bits.
+     *
+     * @tparam UInt_t The unsigned integer type to return.
+     * @param name The name to decode, whose bits above name_type are ignored.
+     *
+     * @returns Values decoded from the name corresponding in order to the size of Dist.
+     */
+#if __cplusplus >= 202002L
+    template<std::unsigned_integral UInt_t = std::uint64_t, std::size_t Bits>
+        requires(Bits > name_type::size_bits)
+#else
+    template<typename UInt_t = std::uint64_t,
+             std::size_t Bits,
+             typename std::enable_if_t<std::is_unsigned_v<UInt_t> && (Bits > name_type::size_bits), bool> = true>
+#endif
+    static constexpr std::array<UInt_t, sizeof...(Dist)> Decode(const BasicName<Bits>& name) noexcept
+    {
+        return Decode<UInt_t>(name_type(name));
+    }
+
+    /**
+     * @brief Decodes a single value of the distribution from a name.
+     *
+     * @details The offset and width of the value are constants, so this
+     *          compiles down to a shift and a mask of the words of the name
+     *          holding the value, combining two words when it straddles them.
+     *
+     * @tparam I The index of the value in Dist.
+     * @tparam UInt_t The unsigned integer type to return.
+     * @param name The name to decode.
+     *
+     * @returns The value at index I of the distribution.
+     */
+#if __cplusplus >= 202002L
+    template<std::size_t I, std::unsigned_integral UInt_t = std::uint64_t>
+#else
+    template<std::size_t I,
+             typename UInt_t = std::uint64_t,
+             typename std::enable_if_t<std::is_unsigned_v<UInt_t>, bool> = true>
+#endif
+    static constexpr UInt_t Decode(const name_type& name) noexcept
+    {
+        static_assert(I < sizeof...(Dist), "Index is outside of the distribution of bits");
+        static_assert(Width(I) <= sizeof(std::uint64_t) * 8, "Values wider than 64 bits cannot be decoded");
+
+        constexpr std::uint16_t offset = Offset(I);
+        constexpr std::uint64_t mask = ValueMask(Width(I));
+        return static_cast<UInt_t>(std::uint64_t(name >> offset) & mask);
+    }
+
+    /**
+     * @brief Decodes the values of many names, into one array per value of the distribution.
+     *
+     * @details Where AVX2 or AVX-512 is enabled at compile time, names of up to
+     *          128 bits are decoded a vector of names at a time, extracting
+     *          each value from the words of all names in the vector with the
+     *          same constant shifts and mask. The remaining names, and all
+     *          names on other targets, are decoded one at a time.
+     *
+     * @tparam UInt_ts The unsigned integer types of the values, one per value in Dist.
+     * @param names The names to decode.
+     * @param count The number of names.
+     * @param values The output arrays in order of Dist, each holding count values.
+     */
+#if __cplusplus >= 202002L
+    template<std::unsigned_integral... UInt_ts>
+#else
+    template<typename... UInt_ts, typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
+#endif
+    static void DecodeBatch(const name_type* names, std::size_t count, UInt_ts*... values) noexcept
+    {
+        static_assert(sizeof...(Dist) == sizeof...(UInt_ts),
+                      "Number of value arrays should match distribution of bits");
+
+        std::size_t i = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+        if constexpr (name_type::size_bits <= 128)
+        {
+            for (; i + detail::name_lanes::size <= count; i += detail::name_lanes::size)
+                DecodeLanes(names + i, std::make_index_sequence<sizeof...(Dist)>{}, (values + i)...);
+        }
+#endif
+        for (; i < count; ++i)
+            DecodeInto(names[i], std::make_index_sequence<sizeof...(Dist)>{}, (values + i)...);
+    }
+
+    /**
+     * @brief Encodes the values of many names, from one array per value of the distribution.
+     *
+     * @details The counterpart of DecodeBatch, keeping the last Dist bits of
+     *          each value. The names are the first parameter so that the value
+     *          arrays can follow as a parameter pack.
+     *
+     * @tparam UInt_ts The unsigned integer types of the values, one per value in Dist.
+     * @param names The output names.
+     * @param count The number of names.
+     * @param values The arrays of values in order of Dist, each holding count values.
+     */
+#if __cplusplus >= 202002L
+    template<std::unsigned_integral... UInt_ts>
+#else
+    template<typename... UInt_ts, typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
+#endif
+    static void EncodeBatch(name_type* names, std::size_t count, const UInt_ts*... values) noexcept
+    {
+        static_assert(sizeof...(Dist) == sizeof...(UInt_ts),
+                      "Number of value arrays should match distribution of bits");
+
+        std::size_t i = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+        if constexpr (name_type::size_bits <= 128)
+        {
+            for (; i + detail::name_lanes::size <= count; i += detail::name_lanes::size)
+                EncodeLanes(names + i, std::make_index_sequence<sizeof...(Dist)>{}, (values + i)...);
+        }
+#endif
+        for (; i < count; ++i)
+            names[i] = EncodeName(values[i]...);
+    }
+
+#if __cplusplus >= 202002L
+    /**
+     * @throws std::invalid_argument If an array of values is smaller than names.
+     */
+    template<std::unsigned_integral... UInt_ts>
+    static void DecodeBatch(std::span<const name_type> names, std::span<UInt_ts>... values)
+    {
+        if (((values.size() < names.size()) || ...))
+            throw std::invalid_argument("Arrays of values cannot be smaller than the names");
+
+        DecodeBatch(names.data(), names.size(), values.data()...);
+    }
+
+    /**
+     * @throws std::invalid_argument If an array of values is smaller than names.
+     */
+    template<std::unsigned_integral... UInt_ts>
+    static void EncodeBatch(std::span<name_type> names, std::span<const UInt_ts>... values)
+    {
+        if (((values.size() < names.size()) || ...))
+            throw std::invalid_argument("Arrays of values cannot be smaller than the names");
+
+        EncodeBatch(names.data(), names.size(), values.data()...);
+    }
+#endif
+
 #if __cplusplus >= 202002L
     template<std::size_t N, std::unsigned_integral UInt_t = std::uint64_t>
-    static constexpr std::array<UInt_t, N> Decode(std::span<std::uint16_t> distribution, quicr::Name name)
+    static constexpr std::array<UInt_t, N> Decode(std::span<std::uint16_t> distribution, name_type name)
 #else
     template<std::size_t N, typename UInt_t = std::uint64_t, typename std::enable_if_t<std::is_unsigned_v<UInt_t>, bool> = true>
-    static constexpr std::array<UInt_t, N> Decode(std::array<std::uint16_t, N> distribution, quicr::Name name)
+    static constexpr std::array<UInt_t, N> Decode(std::array<std::uint16_t, N> distribution, name_type name)
 #endif
     {
         const auto dist_size = distribution.size();
@@ -167,13 +403,33 @@ class HexEndec
         for (size_t i = 0; i < dist_size; ++i)
         {
             const auto dist = distribution[i];
-            result[i] = name.bits<UInt_t>(Size - dist, dist);
+            result[i] = name.template bits<UInt_t>(Size - dist, dist);
             name <<= dist;
         }
 
         return result;
     }
 
+    /**
+     * @brief Decodes a name wider than name_type, such as a Name, from its
+     *        least significant bits, according to a distribution of bits.
+     */
+#if __cplusplus >= 202002L
+    template<std::size_t N, std::unsigned_integral UInt_t = std::uint64_t, std::size_t Bits>
+        requires(Bits > name_type::size_bits)
+    static constexpr std::array<UInt_t, N> Decode(std::span<std::uint16_t> distribution, const BasicName<Bits>& name)
+#else
+    template<std::size_t N,
+             typename UInt_t = std::uint64_t,
+             std::size_t Bits,
+             typename std::enable_if_t<std::is_unsigned_v<UInt_t> && (Bits > name_type::size_bits), bool> = true>
+    static constexpr std::array<UInt_t, N> Decode(std::array<std::uint16_t, N> distribution,
+                                                  const BasicName<Bits>& name)
+#endif
+    {
+        return Decode<N, UInt_t>(distribution, name_type(name));
+    }
+
 #if __cplusplus >= 202002L
     template<std::unsigned_integral UInt_t = std::uint64_t>
     static inline std::vector<UInt_t> Decode(std::span<std::uint16_t> distribution, std::string_view hex)
@@ -182,15 +438,15 @@ class HexEndec
     static inline std::vector<UInt_t> Decode(std::vector<std::uint16_t> distribution, const char* hex)
 #endif
     {
-        return Decode(distribution, quicr::Name(hex));
+        return Decode<UInt_t>(distribution, parse_type(hex));
     }
 
 #if __cplusplus >= 202002L
     template<std::unsigned_integral UInt_t = std::uint64_t>
-    static inline std::vector<UInt_t> Decode(std::span<std::uint16_t> distribution, quicr::Name name)
+    static inline std::vector<UInt_t> Decode(std::span<std::uint16_t> distribution, name_type name)
 #else
     template<typename UInt_t = std::uint64_t, typename std::enable_if_t<std::is_unsigned_v<UInt_t>, bool> = true>
-    static inline std::vector<UInt_t> Decode(std::vector<std::uint16_t> distribution, quicr::Name name)
+    static inline std::vector<UInt_t> Decode(std::vector<std::uint16_t> distribution, name_type name)
 #endif
     {
         const auto dist_size = distribution.size();
@@ -198,11 +454,139 @@ class HexEndec
         for (size_t i = 0; i < dist_size; ++i)
         {
             const auto dist = distribution[i];
-            result[i] = name.bits<UInt_t>(Size - dist, dist);
+            result[i] = name.template bits<UInt_t>(Size - dist, dist);
             name <<= dist;
         }
 
         return result;
     }
+
+    /**
+     * @brief Decodes a name wider than name_type, such as a Name, from its
+     *        least significant bits, according to a distribution of bits.
+     */
+#if __cplusplus >= 202002L
+    template<std::unsigned_integral UInt_t = std::uint64_t, std::size_t Bits>
+        requires(Bits > name_type::size_bits)
+    static inline std::vector<UInt_t> Decode(std::span<std::uint16_t> distribution, const BasicName<Bits>& name)
+#else
+    template<typename UInt_t = std::uint64_t,
+             std::size_t Bits,
+             typename std::enable_if_t<std::is_unsigned_v<UInt_t> && (Bits > name_type::size_bits), bool> = true>
+    static inline std::vector<UInt_t> Decode(std::vector<std::uint16_t> distribution, const BasicName<Bits>& name)
+#endif
+    {
+        return Decode<UInt_t>(distribution, name_type(name));
+    }
+
+  private:
+    template<typename UInt_t, std::size_t... I>
+    static constexpr std::array<UInt_t, sizeof...(Dist)> DecodeAll(const name_type& name,
+                                                                   std::index_sequence<I...>) noexcept
+    {
+        return { Decode<I, UInt_t>(name)... };
+    }
+
+    template<std::size_t... I, typename... UInt_ts>
+    static constexpr void DecodeInto(const name_type& name, std::index_sequence<I...>, UInt_ts*... values) noexcept
+    {
+        ((*values = Decode<I, UInt_ts>(name)), ...);
+    }
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+    using lanes = detail::name_lanes;
+
+    static void LoadLanes(const name_type* names, typename lanes::vector& lo, typename lanes::vector& hi) noexcept
+    {
+        static_assert(sizeof(name_type) == name_type::size_bits / 8 && std::is_standard_layout_v<name_type>,
+                      "Names must be laid out as their words");
+
+        const auto* words = reinterpret_cast<const std::uint64_t*>(names);
+        if constexpr (name_type::size_bits == 64)
+        {
+            lo = lanes::load_words(words);
+            hi = lanes::zero();
+        }
+        else
+        {
+            lanes::load_pairs(words, lo, hi);
+        }
+    }
+
+    static void StoreLanes(name_type* names, typename lanes::vector lo, typename lanes::vector hi) noexcept
+    {
+        auto* words = reinterpret_cast<std::uint64_t*>(names);
+        if constexpr (name_type::size_bits == 64)
+            lanes::store_words(words, lo);
+        else
+            lanes::store_pairs(words, lo, hi);
+    }
+
+    template<std::size_t I>
+    static typename lanes::vector ExtractLane(typename lanes::vector lo, typename lanes::vector hi) noexcept
+    {
+        constexpr int offset = Offset(I);
+        constexpr int width = Width(I);
+
+        typename lanes::vector v;
+        if constexpr (offset >= 64)
+            v = lanes::template srli<offset - 64>(hi);
+        else if constexpr (offset + width <= 64)
+            v = lanes::template srli<offset>(lo);
+        else
+            v = lanes::or_(lanes::template srli<offset>(lo), lanes::template slli<64 - offset>(hi));
+
+        if constexpr (width < 64) v = lanes::and_mask(v, ValueMask(width));
+        return v;
+    }
+
+    template<std::size_t I>
+    static void InsertLane(typename lanes::vector& lo, typename lanes::vector& hi, typename lanes::vector v) noexcept
+    {
+        constexpr int offset = Offset(I);
+        constexpr int width = Width(I);
+
+        if constexpr (width < 64) v = lanes::and_mask(v, ValueMask(width));
+
+        if constexpr (offset >= 64)
+        {
+            hi = lanes::or_(hi, lanes::template slli<offset - 64>(v));
+        }
+        else if constexpr (offset + width <= 64)
+        {
+            lo = lanes::or_(lo, lanes::template slli<offset>(v));
+        }
+        else
+        {
+            lo = lanes::or_(lo, lanes::template slli<offset>(v));
+            hi = lanes::or_(hi, lanes::template srli<64 - offset>(v));
+        }
+    }
+
+    template<std::size_t... I, typename... UInt_ts>
+    static void DecodeLanes(const name_type* names, std::index_sequence<I...>, UInt_ts*... values) noexcept
+    {
+        typename lanes::vector lo, hi;
+        LoadLanes(names, lo, hi);
+        (lanes::store(values, ExtractLane<I>(lo, hi)), ...);
+    }
+
+    template<std::size_t... I, typename... UInt_ts>
+    static void EncodeLanes(name_type* names, std::index_sequence<I...>, const UInt_ts*... values) noexcept
+    {
+        typename lanes::vector lo = lanes::zero();
+        typename lanes::vector hi = lanes::zero();
+        (InsertLane<I>(lo, hi, lanes::load(values)), ...);
+        StoreLanes(names, lo, hi);
+    }
+#endif
+
+    /**
+     * @brief The mask of the low bits of a value of the given number of bits.
+     */
+    static constexpr std::uint64_t ValueMask(std::uint16_t width) noexcept
+    {
+        return width >= sizeof(std::uint64_t) * 8 ? ~std::uint64_t(0) : ~(~std::uint64_t(0) << width);
+    }
 };
 } // namespace quicr
@@ -2,150 +2,226 @@
 
 #include "_utilities.h"
 
+#include <charconv>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <istream>
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 #if __cplusplus >= 202002L
 #include <concepts>
 #include <span>
-#include <string_view>
 #endif
 
 namespace quicr
 {
+template<std::size_t Bits>
+class BasicName;
+
+/**
+ * @brief Checks if a type is a BasicName of any width.
+ */
+template<typename T>
+struct is_basic_name : std::false_type
+{
+};
+
+template<std::size_t Bits>
+struct is_basic_name<BasicName<Bits>> : std::true_type
+{
+};
+
+template<typename T>
+constexpr bool is_basic_name_v = is_basic_name<T>::value;
+
 #if __cplusplus >= 202002L
 template<typename T>
-concept UnsignedOrName = std::unsigned_integral<T> || std::is_same_v<T, class Name>;
+concept UnsignedOrName = std::unsigned_integral<T> || is_basic_name_v<T>;
 #endif
 
 /**
- * @brief Unsigned 128 bit number which can be created from strings or byte arrays.
+ * @brief The result of parsing a value from a string without throwing.
  *
- * @details A Name is defined to be 128 bits, and can almost be used fully as
- *          an integer with arithmetic and logical operators (excluding
- *          multiplication and division operators). It can be constructed from a
- *          hexadecimal string or a byte array.
+ * @tparam T The parsed type.
  */
-class Name
+template<typename T>
+struct parse_result
 {
-    using uint_t = std::uint64_t;
+    T value;
+    std::errc ec;
 
-  private:
     /**
-     * @brief Private constructor for creating a name from 2 unsigned integers.
-     *
-     * @param hi The high bits of the name.
-     * @param lo The low bits of the name.
+     * Returns true if the parse succeeded.
      */
-    constexpr explicit Name(uint_t hi, uint_t lo) noexcept : _lo{ lo }, _hi{ hi } {}
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+/**
+ * @brief Unsigned number of Bits bits which can be created from strings or byte arrays.
+ *
+ * @details A BasicName can almost be used fully as an integer with arithmetic
+ *          and logical operators (excluding multiplication and division
+ *          operators). It can be constructed from a hexadecimal string or a
+ *          byte array. It is stored as Bits / 64 words, least significant
+ *          first, so that a BasicName<64> fits in a single register, and a
+ *          BasicName<128> is laid out as its low and high 64 bit halves.
+ *
+ * @tparam Bits The number of bits of the name, a non-zero multiple of 64.
+ */
+template<std::size_t Bits>
+class BasicName
+{
+    static_assert(Bits > 0 && Bits % 64 == 0, "Bits must be a non-zero multiple of 64");
+
+    template<std::size_t>
+    friend class BasicName;
+
+    using uint_t = std::uint64_t;
+    static constexpr std::size_t word_bits = sizeof(uint_t) * 8;
+    static constexpr std::size_t word_count = Bits / word_bits;
 
   public:
-    Name() noexcept = default;
-    constexpr Name(const Name& other) noexcept = default;
-    constexpr Name(Name&& other) noexcept = default;
+    /**
+     * The number of bits of the name.
+     */
+    static constexpr std::size_t size_bits = Bits;
 
+    BasicName() noexcept = default;
+    constexpr BasicName(const BasicName& other) noexcept = default;
+    constexpr BasicName(BasicName&& other) noexcept = default;
+
+    /**
+     * @brief Constructs a name from its 64 bit words, most significant first.
+     *
+     * @details A 128 bit Name is thus constructed from its halves as Name(hi, lo).
+     *
+     * @param words The Bits / 64 words of the name.
+     */
 #if __cplusplus >= 202002L
-    constexpr Name(std::string_view hex_value)
+    template<std::integral... Words>
+        requires(sizeof...(Words) == word_count)
+#else
+    template<typename... Words,
+             typename std::enable_if_t<sizeof...(Words) == word_count && (std::is_integral_v<Words> && ...), bool> =
+               true>
+#endif
+    constexpr explicit BasicName(Words... words) noexcept : _words{}
     {
-        if (hex_value.starts_with("0x")) hex_value.remove_prefix(2);
+        const uint_t values[] = { static_cast<uint_t>(words)... };
+        for (std::size_t i = 0; i < word_count; ++i)
+            _words[i] = values[word_count - 1 - i];
+    }
 
-        if (hex_value.length() > sizeof(Name) * 2)
-            throw std::invalid_argument("Hex string cannot be longer than " + std::to_string(sizeof(Name) * 2) +
-                                        " bytes");
+    /**
+     * @brief Converts a name of another width, zero extending or truncating the most significant bits.
+     *
+     * @param other The name to convert.
+     */
+    template<std::size_t OtherBits>
+    constexpr explicit BasicName(const BasicName<OtherBits>& other) noexcept : _words{}
+    {
+        for (std::size_t i = 0; i < word_count && i < BasicName<OtherBits>::word_count; ++i)
+            _words[i] = other._words[i];
+    }
 
-        if (hex_value.length() > sizeof(Name))
-        {
-            _hi = utility::hex_to_unsigned<uint_t>(hex_value.substr(0, hex_value.length() - sizeof(Name)));
-            _lo = utility::hex_to_unsigned<uint_t>(hex_value.substr(hex_value.length() - sizeof(Name), sizeof(Name)));
-        }
-        else
-        {
-            _hi = 0;
-            _lo = utility::hex_to_unsigned<uint_t>(hex_value.substr(0, hex_value.length()));
-        }
+    /**
+     * @brief Constructs a name from a hexadecimal string, with or without 0x prefix.
+     *
+     * @param hex_value The hexadecimal string of at most Bits / 4 digits.
+     * @throws std::invalid_argument If the string is not a valid hexadecimal name.
+     */
+#if __cplusplus >= 202002L
+    constexpr BasicName(std::string_view hex_value) : _words{}
+    {
+        const char* last = hex_value.data() + hex_value.size();
+        const auto result = from_chars(hex_value.data(), last, *this);
+        if (result.ec != std::errc{} || result.ptr != last) throw_parse_error(result.ec);
     }
 #else
-    constexpr Name(const char* hex_value)
-        : _lo{0}, _hi{0}
+    constexpr BasicName(const char* hex_value) : _words{}
     {
-        if (hex_value[0] == '0' && hex_value[1] == 'x') hex_value = hex_value + 2;
-
-        const std::size_t length = utility::str_length(hex_value);
-
-        if (length > sizeof(Name) * 2)
-            throw std::invalid_argument("Hex string cannot be longer than " + std::to_string(sizeof(Name) * 2) +
-                                        " bytes");
-
-        if (length > sizeof(Name))
-        {
-            char first_half[sizeof(Name) + 1] = "";
-            char last_half[sizeof(Name) + 1] = "";
-            utility::str_n_copy(first_half, hex_value, length - sizeof(Name));
-            utility::str_n_copy(last_half, hex_value + length - sizeof(Name), sizeof(Name));
-
-            _hi = utility::hex_to_unsigned<uint_t>(first_half);
-            _lo = utility::hex_to_unsigned<uint_t>(last_half);
-        }
-        else
-        {
-            char hex[sizeof(Name) + 1] = "";
-            utility::str_n_copy(hex, hex_value, length);
-
-            _hi = 0;
-            _lo = utility::hex_to_unsigned<uint_t>(hex);
-        }
+        const char* last = hex_value + utility::str_length(hex_value);
+        const auto result = from_chars(hex_value, last, *this);
+        if (result.ec != std::errc{} || result.ptr != last) throw_parse_error(result.ec);
     }
 #endif
 
     /**
-     * @brief Constructs a Name from a byte array pointer.
+     * @brief Constructs a name from a byte array pointer.
      *
      * @param data The byte array pointer to read from.
      * @param size The length of the byte array pointer. Must NOT be greater.
      *
      * Note: The ordering of the byte array MUST conform to the endianness of the machine.
      */
-    Name(const std::uint8_t* data, std::size_t size) : _lo{ 0 }, _hi{ 0 }
+    BasicName(const std::uint8_t* data, std::size_t size) : _words{}
     {
         if (!data) throw std::invalid_argument("Byte array data must not be null");
 
-        if (size > sizeof(Name))
+        if (size > sizeof(BasicName))
         {
             throw std::invalid_argument("Byte array size (" + std::to_string(size) + ") cannot exceed size of Name (" +
-                                        std::to_string(sizeof(Name)) + ")");
+                                        std::to_string(sizeof(BasicName)) + ")");
         }
 
-        if (size > sizeof(uint_t))
-        {
-            std::memcpy(&_hi, data + sizeof(uint_t), size - sizeof(uint_t));
-            std::memcpy(&_lo, data, sizeof(uint_t));
-        }
-        else
-            std::memcpy(&_lo, data, size);
+        std::memcpy(_words, data, size);
     }
 
 #if __cplusplus >= 202002L
     /**
-     * @brief Constructs a Name from a byte range.
+     * @brief Constructs a name from a byte range.
      *
      * @param data The byte range to read from.
      */
-    Name(std::span<std::uint8_t> data) : Name(data.data(), data.size()) {}
+    BasicName(std::span<std::uint8_t> data) : BasicName(data.data(), data.size()) {}
 #endif
+    /*=======================================================================*/
+    // Parsing
+    /*=======================================================================*/
+
+    /**
+     * @brief Parses a hexadecimal string into a name, without throwing.
+     *
+     * @param hex_value The hexadecimal string, with or without 0x prefix, which
+     *                  must consist only of at most Bits / 4 hexadecimal digits.
+     * @returns The parsed name, with std::errc::invalid_argument if the string
+     *          contains non-hexadecimal characters or no digits, or
+     *          std::errc::result_out_of_range if it has too many digits.
+     */
+    static constexpr parse_result<BasicName> parse(std::string_view hex_value) noexcept;
+
+    /**
+     * @brief Parses the longest hexadecimal prefix of [first, last) into a name, in the style of std::from_chars.
+     *
+     * @param first The beginning of the string, optionally starting with 0x.
+     * @param last The end of the string.
+     * @param value The parsed name. Only modified on success.
+     * @returns The pointer to the first unparsed character, and the error
+     *          code, which is std::errc::invalid_argument if there were no
+     *          hexadecimal digits, or std::errc::result_out_of_range if
+     *          there were more digits than fit in the name.
+     */
+    template<std::size_t B>
+    friend constexpr std::from_chars_result from_chars(const char* first,
+                                                       const char* last,
+                                                       BasicName<B>& value) noexcept;
+
     /*=======================================================================*/
     // Assignment Operators
     /*=======================================================================*/
 
-    constexpr Name& operator=(const Name& other) noexcept = default;
-    constexpr Name& operator=(Name&& other) noexcept = default;
+    constexpr BasicName& operator=(const BasicName& other) noexcept = default;
+    constexpr BasicName& operator=(BasicName&& other) noexcept = default;
 #if __cplusplus >= 202002L
-    constexpr Name& operator=(std::string_view hex) { return *this = Name(hex); }
+    constexpr BasicName& operator=(std::string_view hex) { return *this = BasicName(hex); }
 #else
-    constexpr Name& operator=(const char* hex) { return *this = Name(hex); }
+    constexpr BasicName& operator=(const char* hex) { return *this = BasicName(hex); }
 #endif
 
     /*=======================================================================*/
@@ -153,63 +229,98 @@ class Name
     /*=======================================================================*/
 
     /**
-     * Returns the hexadecimal string representation of the Name, with 0x prefix.
+     * Returns the hexadecimal string representation of the name, with 0x prefix.
      */
     operator std::string() const noexcept
     {
-        return "0x" + utility::unsigned_to_hex(_hi) + utility::unsigned_to_hex(_lo);
+        std::string hex = "0x";
+        for (std::size_t i = word_count; i-- > 0;)
+            hex += utility::unsigned_to_hex(_words[i]);
+
+        return hex;
     }
 
-    explicit constexpr operator std::uint8_t() const noexcept { return static_cast<std::uint8_t>(_lo); }
-    explicit constexpr operator std::uint16_t() const noexcept { return static_cast<std::uint16_t>(_lo); }
-    explicit constexpr operator std::uint32_t() const noexcept { return static_cast<std::uint32_t>(_lo); }
-    explicit constexpr operator std::uint64_t() const noexcept { return _lo; }
+    explicit constexpr operator std::uint8_t() const noexcept { return static_cast<std::uint8_t>(_words[0]); }
+    explicit constexpr operator std::uint16_t() const noexcept { return static_cast<std::uint16_t>(_words[0]); }
+    explicit constexpr operator std::uint32_t() const noexcept { return static_cast<std::uint32_t>(_words[0]); }
+    explicit constexpr operator std::uint64_t() const noexcept { return _words[0]; }
 
     /*=======================================================================*/
     // Arithmetic Operators
     /*=======================================================================*/
 
-    constexpr Name& operator+=(uint_t value) noexcept { return *this = Name(_hi + !!(_lo + value < _lo), _lo + value); }
-    constexpr Name& operator+=(Name value) noexcept
+    constexpr BasicName& operator+=(uint_t value) noexcept
+    {
+        _words[0] += value;
+        uint_t carry = _words[0] < value;
+        for (std::size_t i = 1; i < word_count; ++i)
+        {
+            _words[i] += carry;
+            carry &= _words[i] == 0;
+        }
+
+        return *this;
+    }
+
+    constexpr BasicName& operator+=(const BasicName& value) noexcept
     {
-        *this += value._lo;
-        _hi += value._hi;
+        uint_t carry = 0;
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            const uint_t sum = _words[i] + value._words[i];
+            const uint_t result = sum + carry;
+            carry = (sum < _words[i]) | (result < sum);
+            _words[i] = result;
+        }
 
         return *this;
     }
 
-    constexpr Name& operator-=(uint_t value) noexcept { return *this = Name(_hi - !!(_lo - value > _lo), _lo - value); }
-    constexpr Name& operator-=(Name value) noexcept
+    constexpr BasicName& operator-=(uint_t value) noexcept
     {
-        if (_hi - value._hi > _hi)
+        uint_t borrow = _words[0] < value;
+        _words[0] -= value;
+        for (std::size_t i = 1; i < word_count; ++i)
         {
-            _hi = 0;
-            --_lo;
+            const uint_t word = _words[i];
+            _words[i] -= borrow;
+            borrow &= word == 0;
         }
-        else { _hi -= value._hi; }
 
-        *this -= value._lo;
+        return *this;
+    }
+
+    constexpr BasicName& operator-=(const BasicName& value) noexcept
+    {
+        uint_t borrow = 0;
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            const uint_t difference = _words[i] - value._words[i];
+            const uint_t result = difference - borrow;
+            borrow = (difference > _words[i]) | (result > difference);
+            _words[i] = result;
+        }
 
         return *this;
     }
 
-    constexpr Name operator+(uint_t value) const noexcept { return Name(*this) += value; }
-    constexpr Name operator+(Name value) const noexcept { return Name(*this) += value; }
-    constexpr Name operator-(uint_t value) const noexcept { return Name(*this) -= value; }
-    constexpr Name operator-(Name value) const noexcept { return Name(*this) -= value; }
+    constexpr BasicName operator+(uint_t value) const noexcept { return BasicName(*this) += value; }
+    constexpr BasicName operator+(const BasicName& value) const noexcept { return BasicName(*this) += value; }
+    constexpr BasicName operator-(uint_t value) const noexcept { return BasicName(*this) -= value; }
+    constexpr BasicName operator-(const BasicName& value) const noexcept { return BasicName(*this) -= value; }
 
-    constexpr Name& operator++() noexcept { return *this += 1; }
-    constexpr Name operator++(int) noexcept
+    constexpr BasicName& operator++() noexcept { return *this += 1; }
+    constexpr BasicName operator++(int) noexcept
     {
-        Name name(*this);
+        BasicName name(*this);
         ++(*this);
         return name;
     }
 
-    constexpr Name& operator--() noexcept { return *this -= 1; }
-    constexpr Name operator--(int) noexcept
+    constexpr BasicName& operator--() noexcept { return *this -= 1; }
+    constexpr BasicName operator--(int) noexcept
     {
-        Name name(*this);
+        BasicName name(*this);
         --(*this);
         return name;
     }
@@ -218,129 +329,214 @@ class Name
     // Logical Arithmetic Operators
     /*=======================================================================*/
 
-    constexpr Name operator&(uint_t value) const noexcept { return Name(_hi, _lo & value); }
-    constexpr Name operator&(const Name& other) const noexcept { return Name(_hi & other._hi, _lo & other._lo); }
-    constexpr Name operator|(uint_t value) const noexcept { return Name(_hi, _lo | value); }
-    constexpr Name operator|(const Name& other) const noexcept { return Name(_hi | other._hi, _lo | other._lo); }
-    constexpr Name operator^(const Name& other) const noexcept { return Name(_hi ^ other._hi, _lo ^ other._lo); }
-    constexpr Name operator~() const noexcept { return Name(~_hi, ~_lo); }
+    constexpr BasicName& operator&=(uint_t value) noexcept
+    {
+        _words[0] &= value;
+        return *this;
+    }
 
-    constexpr Name& operator&=(uint_t value) noexcept { return *this = *this & value; }
-    constexpr Name& operator&=(const Name& other) noexcept { return *this = *this & other; }
-    constexpr Name& operator|=(uint_t value) noexcept { return *this = *this | value; }
-    constexpr Name& operator|=(const Name& other) noexcept { return *this = *this | other; }
-    constexpr Name& operator^=(const Name& other) noexcept { return *this = *this ^ other; }
+    constexpr BasicName& operator&=(const BasicName& other) noexcept
+    {
+        for (std::size_t i = 0; i < word_count; ++i)
+            _words[i] &= other._words[i];
+        return *this;
+    }
 
-    constexpr Name& operator>>=(uint16_t value) noexcept
+    constexpr BasicName& operator|=(uint_t value) noexcept
     {
-        if (value == 0) return *this;
+        _words[0] |= value;
+        return *this;
+    }
 
-        if (value < sizeof(uint_t) * 8)
-        {
-            _lo = (_lo >> value) | (_hi << (sizeof(uint_t) * 8 - value));
-            _hi = _hi >> value;
-        }
-        else
-        {
-            _lo = _hi >> (value - sizeof(uint_t) * 8);
-            _hi = 0;
-        }
+    constexpr BasicName& operator|=(const BasicName& other) noexcept
+    {
+        for (std::size_t i = 0; i < word_count; ++i)
+            _words[i] |= other._words[i];
+        return *this;
+    }
 
+    constexpr BasicName& operator^=(const BasicName& other) noexcept
+    {
+        for (std::size_t i = 0; i < word_count; ++i)
+            _words[i] ^= other._words[i];
         return *this;
     }
 
-    constexpr Name& operator<<=(uint16_t value) noexcept
+    constexpr BasicName operator&(uint_t value) const noexcept { return BasicName(*this) &= value; }
+    constexpr BasicName operator&(const BasicName& other) const noexcept { return BasicName(*this) &= other; }
+    constexpr BasicName operator|(uint_t value) const noexcept { return BasicName(*this) |= value; }
+    constexpr BasicName operator|(const BasicName& other) const noexcept { return BasicName(*this) |= other; }
+    constexpr BasicName operator^(const BasicName& other) const noexcept { return BasicName(*this) ^= other; }
+    constexpr BasicName operator~() const noexcept
     {
-        if (value == 0) return *this;
+        BasicName name(*this);
+        for (std::size_t i = 0; i < word_count; ++i)
+            name._words[i] = ~name._words[i];
+        return name;
+    }
 
-        if (value < sizeof(uint_t) * 8)
+    constexpr BasicName& operator>>=(uint16_t value) noexcept
+    {
+        if (value >= Bits) return *this = BasicName{};
+
+        // Shifting the carried word left by 1 first keeps the shift below 64 when bit_shift is 0.
+        const std::size_t word_shift = value / word_bits;
+        const std::size_t bit_shift = value % word_bits;
+        for (std::size_t i = 0; i < word_count; ++i)
         {
-            _hi = (_hi << value) | (_lo >> (sizeof(uint_t) * 8 - value));
-            _lo = _lo << value;
+            const uint_t word = i + word_shift < word_count ? _words[i + word_shift] : 0;
+            const uint_t carry = i + word_shift + 1 < word_count ? _words[i + word_shift + 1] : 0;
+            _words[i] = (word >> bit_shift) | ((carry << 1) << (word_bits - 1 - bit_shift));
         }
-        else
+
+        return *this;
+    }
+
+    constexpr BasicName& operator<<=(uint16_t value) noexcept
+    {
+        if (value >= Bits) return *this = BasicName{};
+
+        const std::size_t word_shift = value / word_bits;
+        const std::size_t bit_shift = value % word_bits;
+        for (std::size_t i = word_count; i-- > 0;)
         {
-            _hi = _lo << (value - sizeof(uint_t) * 8);
-            _lo = 0;
+            const uint_t word = i >= word_shift ? _words[i - word_shift] : 0;
+            const uint_t carry = i >= word_shift + 1 ? _words[i - word_shift - 1] : 0;
+            _words[i] = (word << bit_shift) | ((carry >> 1) >> (word_bits - 1 - bit_shift));
         }
 
         return *this;
     }
 
-    constexpr Name operator>>(uint16_t value) const noexcept { return Name(*this) >>= value; }
-    constexpr Name operator<<(uint16_t value) const noexcept { return Name(*this) <<= value; }
+    constexpr BasicName operator>>(uint16_t value) const noexcept { return BasicName(*this) >>= value; }
+    constexpr BasicName operator<<(uint16_t value) const noexcept { return BasicName(*this) <<= value; }
 
     /*=======================================================================*/
     // Comparison Operators
     /*=======================================================================*/
 
-    friend constexpr bool operator>(const Name& a, const Name& b) noexcept
+    friend constexpr bool operator<(const BasicName& a, const BasicName& b) noexcept
     {
-        if (a._hi > b._hi) return true;
-        if (b._hi > a._hi) return false;
-        return a._lo > b._lo;
+        for (std::size_t i = word_count - 1; i > 0; --i)
+        {
+            if (a._words[i] != b._words[i]) return a._words[i] < b._words[i];
+        }
+
+        return a._words[0] < b._words[0];
     }
 
-    friend constexpr bool operator<(const Name& a, const Name& b) noexcept
+    friend constexpr bool operator==(const BasicName& a, const BasicName& b) noexcept
     {
-        if (a._hi < b._hi) return true;
-        if (b._hi < a._hi) return false;
-        return a._lo < b._lo;
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            if (a._words[i] != b._words[i]) return false;
+        }
+
+        return true;
     }
 
-    friend constexpr bool operator==(const Name& a, const Name& b) noexcept { return a._hi == b._hi && a._lo == b._lo; }
-    friend constexpr bool operator!=(const Name& a, const Name& b) noexcept { return !(a == b); }
-    friend constexpr bool operator>=(const Name& a, const Name& b) noexcept { return !(a < b); }
-    friend constexpr bool operator<=(const Name& a, const Name& b) noexcept { return !(a > b); }
+    friend constexpr bool operator>(const BasicName& a, const BasicName& b) noexcept { return b < a; }
+    friend constexpr bool operator!=(const BasicName& a, const BasicName& b) noexcept { return !(a == b); }
+    friend constexpr bool operator>=(const BasicName& a, const BasicName& b) noexcept { return !(a < b); }
+    friend constexpr bool operator<=(const BasicName& a, const BasicName& b) noexcept { return !(b < a); }
 
     /*=======================================================================*/
     // Access Operators
     /*=======================================================================*/
 
     /**
-     * @brief Access the byte at the given index of the Name.
+     * @brief Access the byte at the given index of the name.
      *
-     * @param index The index in the range [0, 16) to access,
+     * @param index The index in the range [0, Bits / 8) to access,
      * @returns The byte at the given index.
      */
     constexpr std::uint8_t operator[](std::size_t index) const
     {
-        if (index >= sizeof(Name)) throw std::out_of_range("Cannot access index outside of max size of quicr::Name");
+        if (index >= sizeof(BasicName))
+            throw std::out_of_range("Cannot access index outside of max size of quicr::Name");
 
-        if (index < sizeof(uint_t)) return (_lo >> (index * 8)) & 0xFF;
-        return (_hi >> ((index - sizeof(uint_t)) * 8)) & 0xFF;
+        return (_words[index / sizeof(uint_t)] >> (index % sizeof(uint_t) * 8)) & 0xFF;
     }
 
     /**
-     * @brief Returns a Name with only the requested bits, shifted to the right.
+     * @brief Returns the requested bits, shifted to the right.
+     *
+     * @details When T is the name type itself, the bits are not shifted into
+     *          the lower bits, instead only highlighting the bits that were
+     *          requested, and zeroing the rest out, effectively creating a mask.
      *
      * @param from The starting bit to access from. 0 is the least significant bit.
-     * @param length The number of bits to access. If length == 0, returns 1 bit.
+     * @param length The number of bits to access. If length == 0, returns 0.
      * @returns The requested bits.
+     * @throws std::domain_error If T is an integer and length is greater than 64.
      */
 #if __cplusplus >= 202002L
-    template<UnsignedOrName T = Name>
+    template<UnsignedOrName T = BasicName>
     constexpr T bits(std::uint16_t from, std::uint16_t length = 1) const
 #else
-    template<typename T = Name, typename std::enable_if_t<std::is_integral_v<T> || std::is_same_v<T, Name>, bool> = true>
+    template<typename T = BasicName,
+             typename std::enable_if_t<std::is_integral_v<T> || is_basic_name_v<T>, bool> = true>
     constexpr T bits(std::uint16_t from, std::uint16_t length = 1) const
 #endif
     {
-        if (length == 0) return 0;
+        if constexpr (is_basic_name_v<T>)
+        {
+            static_assert(std::is_same_v<T, BasicName>, "Bits of a name can only be masked into the same name type");
+
+            BasicName name(*this);
+            for (std::size_t i = 0; i < word_count; ++i)
+                name._words[i] &= word_mask(i, from, length);
 
-        if (length > sizeof(uint_t) * 8)
-            throw std::domain_error("length is greater than 64 bits, did you mean to use Name?");
+            return name;
+        }
+        else
+        {
+            if (length == 0) return 0;
+
+            if (length > word_bits)
+                throw std::domain_error("length is greater than 64 bits, did you mean to use Name?");
 
-        return T((*this & (((Name(uint_t(0), uint_t(1)) << length) - 1) << from)) >> from);
+            return T((*this >> from)._words[0] & word_mask(0, 0, length));
+        }
     }
 
+    /*=======================================================================*/
+    // Bit Operations
+    /*=======================================================================*/
+
+    /**
+     * @brief Counts the consecutive 0 bits, starting from the most significant bit.
+     * @returns The number of leading zero bits, or Bits if name is 0.
+     */
+    template<std::size_t B>
+    friend constexpr int countl_zero(const BasicName<B>& name) noexcept;
+
+    /**
+     * @brief Counts the consecutive 0 bits, starting from the least significant bit.
+     * @returns The number of trailing zero bits, or Bits if name is 0.
+     */
+    template<std::size_t B>
+    friend constexpr int countr_zero(const BasicName<B>& name) noexcept;
+
+    /**
+     * @brief Counts the 1 bits of a name.
+     */
+    template<std::size_t B>
+    friend constexpr int popcount(const BasicName<B>& name) noexcept;
+
+    /**
+     * @brief Reverses the bytes of a name.
+     */
+    template<std::size_t B>
+    friend constexpr BasicName<B> byteswap(const BasicName<B>& name) noexcept;
+
     /*=======================================================================*/
     // Stream Operators
     /*=======================================================================*/
 
-    friend std::ostream& operator<<(std::ostream& os, const Name& name) { return os << std::string(name); }
+    friend std::ostream& operator<<(std::ostream& os, const BasicName& name) { return os << std::string(name); }
 
-    friend std::istream& operator>>(std::istream& is, Name& name)
+    friend std::istream& operator>>(std::istream& is, BasicName& name)
     {
         std::string hex;
         is >> hex;
@@ -349,31 +545,212 @@ class Name
     }
 
   private:
-    uint_t _lo;
-    uint_t _hi;
+    /**
+     * @brief The part of the mask of [from, from + length) that falls within a word.
+     *
+     * @param index The index of the word, where 0 is the least significant.
+     * @param from The starting bit of the mask.
+     * @param length The number of bits of the mask.
+     */
+    static constexpr uint_t word_mask(std::size_t index, std::size_t from, std::size_t length) noexcept
+    {
+        const std::size_t word_begin = index * word_bits;
+        const std::size_t begin = from > word_begin ? from : word_begin;
+        const std::size_t end = from + length < word_begin + word_bits ? from + length : word_begin + word_bits;
+        if (begin >= end) return 0;
+
+        const std::size_t width = end - begin;
+        return (width == word_bits ? ~uint_t(0) : (uint_t(1) << width) - 1) << (begin - word_begin);
+    }
+
+    [[noreturn]] static void throw_parse_error(std::errc ec)
+    {
+        if (ec == std::errc::result_out_of_range)
+            throw std::invalid_argument("Hex string cannot be longer than " + std::to_string(sizeof(BasicName) * 2) +
+                                        " bytes");
+
+        throw std::invalid_argument("Hex string must only contain hexadecimal digits");
+    }
+
+  private:
+    uint_t _words[word_count];
 };
 
 /**
- * @brief Full specialization returning Name, but creates a mask.
- *
- * @details Unlike the uint versions, this one does not shift into the lower
- *          bits, instead only highlighting the bits the were requested, and
- *          zeroing the rest out, effectively creating a mask.
- *
- * @param from The starting bit to access from. 0 is the least significant bit.
- * @param length The number of bits to access. If length == 0, returns 1 bit.
- * @returns A Name with the requested bits.
+ * @brief Unsigned 128 bit name, the default width of names.
  */
-template<>
-constexpr Name Name::bits<Name>(std::uint16_t from, std::uint16_t length) const
+using Name = BasicName<128>;
+
+template<std::size_t Bits>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, BasicName<Bits>& value) noexcept
 {
-    if (length == 0) return Name(uint_t(0), uint_t(0));
-    if (length == sizeof(Name) * 8) return *this;
+    using uint_t = typename BasicName<Bits>::uint_t;
+    constexpr std::size_t word_bits = BasicName<Bits>::word_bits;
+    constexpr std::size_t word_count = BasicName<Bits>::word_count;
+
+    const char* it = first;
+    if (last - it >= 2 && it[0] == '0' && it[1] == 'x') it += 2;
 
-    return *this & (((Name(uint_t(0), uint_t(1)) << length) - 1) << from);
+    const char* digits = it;
+    uint_t words[word_count] = {};
+    for (; it != last && utility::is_hexchar(*it); ++it)
+    {
+        for (std::size_t i = word_count - 1; i > 0; --i)
+            words[i] = (words[i] << 4) | (words[i - 1] >> (word_bits - 4));
+        words[0] = (words[0] << 4) | utility::hexchar_to_unsigned<uint_t>(*it);
+    }
+
+    if (it == digits) return { first, std::errc::invalid_argument };
+    if (std::size_t(it - digits) > sizeof(BasicName<Bits>) * 2) return { it, std::errc::result_out_of_range };
+
+    for (std::size_t i = 0; i < word_count; ++i)
+        value._words[i] = words[i];
+    return { it, std::errc{} };
+}
+
+template<std::size_t Bits>
+constexpr parse_result<BasicName<Bits>> BasicName<Bits>::parse(std::string_view hex_value) noexcept
+{
+    parse_result<BasicName> result{ BasicName{}, std::errc{} };
+
+    const char* last = hex_value.data() + hex_value.size();
+    const auto [ptr, ec] = from_chars(hex_value.data(), last, result.value);
+    if (ec != std::errc{})
+        result.ec = ec;
+    else if (ptr != last)
+        result.ec = std::errc::invalid_argument;
+
+    return result;
+}
+
+template<std::size_t Bits>
+constexpr int countl_zero(const BasicName<Bits>& name) noexcept
+{
+    int count = 0;
+    for (std::size_t i = BasicName<Bits>::word_count; i-- > 0;)
+    {
+        if (name._words[i]) return count + utility::countl_zero(name._words[i]);
+        count += BasicName<Bits>::word_bits;
+    }
+
+    return count;
+}
+
+template<std::size_t Bits>
+constexpr int countr_zero(const BasicName<Bits>& name) noexcept
+{
+    int count = 0;
+    for (std::size_t i = 0; i < BasicName<Bits>::word_count; ++i)
+    {
+        if (name._words[i]) return count + utility::countr_zero(name._words[i]);
+        count += BasicName<Bits>::word_bits;
+    }
+
+    return count;
+}
+
+template<std::size_t Bits>
+constexpr int popcount(const BasicName<Bits>& name) noexcept
+{
+    int count = 0;
+    for (std::size_t i = 0; i < BasicName<Bits>::word_count; ++i)
+        count += utility::popcount(name._words[i]);
+
+    return count;
+}
+
+/**
+ * @brief The number of leading bits two names have in common.
+ * @returns The length of the common prefix, or Bits if the names are equal.
+ */
+template<std::size_t Bits>
+constexpr int common_prefix_length(const BasicName<Bits>& a, const BasicName<Bits>& b) noexcept
+{
+    return countl_zero(a ^ b);
+}
+
+/**
+ * @brief The position of the most significant bit where two names differ.
+ * @returns The bit position, where 0 is the least significant bit, or -1 if the names are equal.
+ */
+template<std::size_t Bits>
+constexpr int highest_differing_bit(const BasicName<Bits>& a, const BasicName<Bits>& b) noexcept
+{
+    return static_cast<int>(Bits) - 1 - common_prefix_length(a, b);
+}
+
+/**
+ * @brief Rotates the bits of a name left, wrapping the high bits around to the low bits.
+ * @param shift The number of bits to rotate by, modulo Bits.
+ */
+template<std::size_t Bits>
+constexpr BasicName<Bits> rotl(const BasicName<Bits>& name, unsigned shift) noexcept
+{
+    shift %= Bits;
+    if (shift == 0) return name;
+
+    return (name << static_cast<std::uint16_t>(shift)) | (name >> static_cast<std::uint16_t>(Bits - shift));
+}
+
+/**
+ * @brief Rotates the bits of a name right, wrapping the low bits around to the high bits.
+ * @param shift The number of bits to rotate by, modulo Bits.
+ */
+template<std::size_t Bits>
+constexpr BasicName<Bits> rotr(const BasicName<Bits>& name, unsigned shift) noexcept
+{
+    return rotl(name, static_cast<unsigned>(Bits - shift % Bits));
+}
+
+template<std::size_t Bits>
+constexpr BasicName<Bits> byteswap(const BasicName<Bits>& name) noexcept
+{
+    constexpr std::size_t word_count = BasicName<Bits>::word_count;
+
+    BasicName<Bits> result(name);
+    for (std::size_t i = 0; i < word_count; ++i)
+        result._words[i] = utility::byteswap(name._words[word_count - 1 - i]);
+
+    return result;
 }
 } // namespace quicr
 
+namespace std
+{
+/**
+ * @brief Hash specialization for names.
+ *
+ * @details Folds pairs of 64 bit words of the name through a 128 bit multiply,
+ *          so that names differing only in their low bits (e.g. sequential
+ *          object ids) still spread over every bit of the result.
+ */
+template<std::size_t Bits>
+struct hash<quicr::BasicName<Bits>>
+{
+    constexpr std::size_t operator()(const quicr::BasicName<Bits>& name) const noexcept
+    {
+        const std::uint64_t lo = std::uint64_t(name);
+        if constexpr (Bits == 64)
+        {
+            const std::uint64_t h = quicr::utility::mul_fold(lo ^ 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull);
+            return static_cast<std::size_t>(quicr::utility::mul_fold(h, 0x8ebc6af09c88c6e3ull));
+        }
+        else
+        {
+            const std::uint64_t hi = std::uint64_t(name >> 64);
+            std::uint64_t h = quicr::utility::mul_fold(lo ^ 0xa0761d6478bd642full, hi ^ 0xe7037ed1a0b428dbull);
+            for (std::uint16_t shift = 128; shift < Bits; shift += 128)
+            {
+                const std::uint64_t next_lo = std::uint64_t(name >> shift);
+                const std::uint64_t next_hi = std::uint64_t(name >> (shift + 64));
+                h = quicr::utility::mul_fold(h ^ next_lo ^ 0xa0761d6478bd642full, next_hi ^ 0xe7037ed1a0b428dbull);
+            }
+            return static_cast<std::size_t>(quicr::utility::mul_fold(h, 0x8ebc6af09c88c6e3ull));
+        }
+    }
+};
+} // namespace std
+
 /**
  * @brief Constructs a name from a literal hexadecimal string
  *
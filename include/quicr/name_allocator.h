@@ -0,0 +1,181 @@
+#pragma once
+
+#include "hex_endec.h"
+#include "name.h"
+#include "namespace.h"
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace quicr
+{
+/**
+ * @brief Allocates unique Names within a Namespace, from many threads at once.
+ *
+ * @details Names are built by writing a counter into a range of the
+ *          namespace's insignificant bits, such as the object id field of a
+ *          name layout. The counter is shared by all threads, but is only
+ *          touched once per block of names: each thread takes its own
+ *          local_allocator, which reserves a block of counter values with a
+ *          single atomic increment and then hands out names from it without
+ *          any synchronization. Names are unique across all threads, and are
+ *          increasing within a single local_allocator.
+ *
+ * Example:
+ *   quicr::name_allocator allocator(ns, quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>{}, 5);
+ *
+ *   // On each publisher thread
+ *   auto local = allocator.local();
+ *   quicr::Name name = local.next();
+ */
+class name_allocator
+{
+  public:
+    static constexpr std::uint64_t default_block_size = 1024;
+
+    /**
+     * @brief Hands out names from blocks reserved from a shared name_allocator.
+     *        Must only be used by one thread at a time.
+     */
+    class local_allocator
+    {
+      public:
+        explicit local_allocator(name_allocator& allocator) noexcept : _allocator{ &allocator } {}
+
+        /**
+         * @brief Allocates the next name.
+         * @returns The name, or std::nullopt if the namespace is exhausted.
+         */
+        std::optional<Name> try_next() noexcept
+        {
+            if (_remaining == 0 && !_allocator->reserve(_counter, _remaining)) return std::nullopt;
+
+            --_remaining;
+            return _allocator->make_name(_counter++);
+        }
+
+        /**
+         * @brief Allocates the next name.
+         * @returns The newly allocated name.
+         * @throws std::out_of_range If the namespace is exhausted.
+         */
+        Name next()
+        {
+            if (auto name = try_next()) return *name;
+            throw std::out_of_range("Namespace " + std::string(_allocator->_namespace) + " is exhausted");
+        }
+
+        /**
+         * @brief The number of names left in the currently reserved block.
+         */
+        std::uint64_t remaining() const noexcept { return _remaining; }
+
+      private:
+        name_allocator* _allocator;
+        std::uint64_t _counter = 0;
+        std::uint64_t _remaining = 0;
+    };
+
+    /**
+     * @brief Constructs an allocator writing its counter to the given bits of the namespace.
+     *
+     * @param ns The namespace to allocate names in.
+     * @param offset The least significant bit of the counter in the name.
+     * @param width The number of bits of the counter, in the range [1, 64].
+     * @param block_size The number of names reserved by a local_allocator at once.
+     * @throws std::invalid_argument If the counter does not fit in the
+     *         insignificant bits of the namespace, or block_size is 0.
+     */
+    name_allocator(const Namespace& ns,
+                   std::uint16_t offset,
+                   std::uint16_t width,
+                   std::uint64_t block_size = default_block_size)
+      : _namespace{ ns }, _offset{ offset }, _block_size{ block_size }
+    {
+        if (width == 0 || width > sizeof(std::uint64_t) * 8)
+            throw std::invalid_argument("Counter width must be in the range [1, 64]");
+
+        if (offset + width > sizeof(Name) * 8 - ns.length())
+            throw std::invalid_argument("Counter bits must be within the insignificant bits of the namespace");
+
+        if (block_size == 0) throw std::invalid_argument("Block size must not be 0");
+
+        _last = width == sizeof(std::uint64_t) * 8 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+        _last_block = _last / block_size;
+    }
+
+    /**
+     * @brief Constructs an allocator counting in one field of a HexEndec layout.
+     *
+     * @param ns The namespace to allocate names in.
+     * @param layout The layout of the names.
+     * @param field The index of the field to count in, such as the object id.
+     * @param block_size The number of names reserved by a local_allocator at once.
+     */
+    template<std::uint16_t Size, std::uint16_t... Dist>
+    name_allocator(const Namespace& ns,
+                   HexEndec<Size, Dist...> layout,
+                   std::size_t field,
+                   std::uint64_t block_size = default_block_size)
+      : name_allocator(ns, layout.Offset(field), layout.Width(field), block_size)
+    {
+    }
+
+    name_allocator(const name_allocator&) = delete;
+    name_allocator& operator=(const name_allocator&) = delete;
+
+    /**
+     * @brief Creates a new allocator for the calling thread.
+     */
+    local_allocator local() noexcept { return local_allocator(*this); }
+
+    /**
+     * @brief The namespace names are allocated in.
+     */
+    const Namespace& get_namespace() const noexcept { return _namespace; }
+
+    /**
+     * @brief Checks if every block of the namespace has been reserved.
+     */
+    bool exhausted() const noexcept { return _next_block.load(std::memory_order_relaxed) > _last_block; }
+
+  private:
+    /**
+     * @brief Reserves the next block of counter values.
+     *
+     * @param first The first counter value of the block.
+     * @param count The number of counter values in the block.
+     * @returns False if every block has already been reserved.
+     */
+    bool reserve(std::uint64_t& first, std::uint64_t& count) noexcept
+    {
+        const std::uint64_t block = _next_block.fetch_add(1, std::memory_order_relaxed);
+        if (block > _last_block) return false;
+
+        first = block * _block_size;
+        count = _last - first >= _block_size - 1 ? _block_size : _last - first + 1;
+        return true;
+    }
+
+    Name make_name(std::uint64_t counter) const noexcept
+    {
+        return _namespace.name() | (Name(std::uint64_t(0), counter) << _offset);
+    }
+
+    const Namespace _namespace;
+    const std::uint16_t _offset;
+    const std::uint64_t _block_size;
+    std::uint64_t _last;
+
+    /**
+     * The index of the last block, rather than the number of blocks, which
+     * does not fit in 64 bits with a 64 bit counter and blocks of 1.
+     */
+    std::uint64_t _last_block;
+
+    alignas(64) std::atomic<std::uint64_t> _next_block{ 0 };
+};
+} // namespace quicr
@@ -0,0 +1,1248 @@
+#pragma once
+
+#include "_utilities.h"
+#include "name.h"
+#include "namespace.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#endif
+
+namespace quicr
+{
+namespace detail
+{
+constexpr std::size_t art_key_size = sizeof(Name);
+
+/**
+ * @brief The bytes of a name from the most significant, the order in which the tree branches on them.
+ */
+using art_key = std::array<std::uint8_t, art_key_size>;
+
+inline art_key make_art_key(const Name& name) noexcept
+{
+    art_key key;
+    const std::uint64_t hi = std::uint64_t(name >> 64);
+    const std::uint64_t lo = std::uint64_t(name);
+    for (std::size_t i = 0; i < sizeof(std::uint64_t); ++i)
+    {
+        key[i] = static_cast<std::uint8_t>(hi >> (56 - 8 * i));
+        key[i + sizeof(std::uint64_t)] = static_cast<std::uint8_t>(lo >> (56 - 8 * i));
+    }
+    return key;
+}
+
+/**
+ * @brief A child in the tree: an inner node, a leaf tagged by its lowest bit, or 0 for none.
+ */
+using art_ref = std::uintptr_t;
+
+constexpr bool art_is_leaf(art_ref ref) noexcept
+{
+    return ref & 1;
+}
+
+enum class art_type : std::uint8_t
+{
+    node4,
+    node16,
+    node48,
+    node256
+};
+
+/**
+ * @brief The header of an inner node.
+ *
+ * @details The prefix holds all the bytes compressed into the node, which is
+ *          at most 15 as every node branches on at least one byte of a key.
+ */
+struct art_node
+{
+    explicit art_node(art_type t) noexcept : type{ t } {}
+
+    art_type type;
+    std::uint8_t prefix_length = 0;
+    std::uint16_t count = 0;
+    std::uint8_t prefix[art_key_size - 1] = {};
+};
+
+/**
+ * @brief An inner node of up to 4 children, with their sorted key bytes.
+ */
+struct art_node4 : art_node
+{
+    static constexpr std::uint16_t capacity = 4;
+
+    art_node4() noexcept : art_node{ art_type::node4 } {}
+
+    std::uint8_t keys[capacity] = {};
+    art_ref children[capacity] = {};
+};
+
+/**
+ * @brief An inner node of up to 16 children, with their sorted key bytes searched all at once.
+ */
+struct art_node16 : art_node
+{
+    static constexpr std::uint16_t capacity = 16;
+
+    art_node16() noexcept : art_node{ art_type::node16 } {}
+
+    std::uint8_t keys[capacity] = {};
+    art_ref children[capacity] = {};
+};
+
+/**
+ * @brief An inner node of up to 48 children, indexed by key byte, where index 0 means no child.
+ */
+struct art_node48 : art_node
+{
+    static constexpr std::uint16_t capacity = 48;
+
+    art_node48() noexcept : art_node{ art_type::node48 } {}
+
+    std::uint8_t index[256] = {};
+    art_ref children[capacity] = {};
+};
+
+/**
+ * @brief An inner node with a child for every key byte.
+ */
+struct art_node256 : art_node
+{
+    static constexpr std::uint16_t capacity = 256;
+
+    art_node256() noexcept : art_node{ art_type::node256 } {}
+
+    art_ref children[capacity] = {};
+};
+
+/**
+ * @brief The position of byte in the keys of a Node16, or -1 if it is not found.
+ */
+inline int art_find_index(const art_node16& node, std::uint8_t byte) noexcept
+{
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(node.keys));
+    const __m128i equal = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal)) & ((1u << node.count) - 1);
+    return mask ? utility::countr_zero(mask) : -1;
+#else
+    for (unsigned i = 0; i < node.count; ++i)
+    {
+        if (node.keys[i] == byte) return static_cast<int>(i);
+    }
+    return -1;
+#endif
+}
+
+/**
+ * @brief The position of the first key of a Node16 that is not less than byte.
+ */
+inline unsigned art_lower_index(const art_node16& node, std::uint8_t byte) noexcept
+{
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    // SSE2 only compares signed bytes, so flip the sign bits of both sides to compare them unsigned.
+    const __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(node.keys)), flip);
+    const __m128i less = _mm_cmplt_epi8(keys, _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), flip));
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(less)) & ((1u << node.count) - 1);
+    return static_cast<unsigned>(utility::popcount(mask));
+#else
+    unsigned i = 0;
+    while (i < node.count && node.keys[i] < byte)
+        ++i;
+    return i;
+#endif
+}
+
+/**
+ * @brief The child of a node for a key byte.
+ * @returns A pointer to the child, or nullptr if the node has no child for byte.
+ */
+inline art_ref* art_find_child(art_node* node, std::uint8_t byte) noexcept
+{
+    switch (node->type)
+    {
+        case art_type::node4:
+        {
+            auto* n = static_cast<art_node4*>(node);
+            for (unsigned i = 0; i < n->count; ++i)
+            {
+                if (n->keys[i] == byte) return &n->children[i];
+            }
+            return nullptr;
+        }
+        case art_type::node16:
+        {
+            auto* n = static_cast<art_node16*>(node);
+            const int i = art_find_index(*n, byte);
+            return i < 0 ? nullptr : &n->children[i];
+        }
+        case art_type::node48:
+        {
+            auto* n = static_cast<art_node48*>(node);
+            return n->index[byte] ? &n->children[n->index[byte] - 1] : nullptr;
+        }
+        default:
+        {
+            auto* n = static_cast<art_node256*>(node);
+            return n->children[byte] ? &n->children[byte] : nullptr;
+        }
+    }
+}
+
+/**
+ * @brief A child of a node with its key byte, where a byte of 256 means no child.
+ */
+struct art_child
+{
+    unsigned byte;
+    art_ref ref;
+};
+
+/**
+ * @brief An inner node on the path of an iterator to its leaf, with the key byte of the child taken.
+ */
+struct art_frame
+{
+    const art_node* node;
+    unsigned byte;
+};
+
+/**
+ * @brief The child of a node with the smallest key byte not less than from.
+ */
+inline art_child art_next_child(const art_node* node, unsigned from) noexcept
+{
+    constexpr art_child none{ 256, 0 };
+    if (from > 255) return none;
+
+    switch (node->type)
+    {
+        case art_type::node4:
+        {
+            const auto* n = static_cast<const art_node4*>(node);
+            for (unsigned i = 0; i < n->count; ++i)
+            {
+                if (n->keys[i] >= from) return { n->keys[i], n->children[i] };
+            }
+            return none;
+        }
+        case art_type::node16:
+        {
+            const auto* n = static_cast<const art_node16*>(node);
+            const unsigned i = art_lower_index(*n, static_cast<std::uint8_t>(from));
+            return i < n->count ? art_child{ n->keys[i], n->children[i] } : none;
+        }
+        case art_type::node48:
+        {
+            const auto* n = static_cast<const art_node48*>(node);
+            for (unsigned b = from; b < 256; ++b)
+            {
+                if (n->index[b]) return { b, n->children[n->index[b] - 1] };
+            }
+            return none;
+        }
+        default:
+        {
+            const auto* n = static_cast<const art_node256*>(node);
+            for (unsigned b = from; b < 256; ++b)
+            {
+                if (n->children[b]) return { b, n->children[b] };
+            }
+            return none;
+        }
+    }
+}
+
+/**
+ * @brief Inserts a child into the sorted keys of a Node4 or Node16 that is not full.
+ */
+template<class Node>
+void art_insert_sorted(Node& node, unsigned pos, std::uint8_t byte, art_ref child) noexcept
+{
+    std::memmove(node.keys + pos + 1, node.keys + pos, node.count - pos);
+    std::memmove(node.children + pos + 1, node.children + pos, (node.count - pos) * sizeof(art_ref));
+    node.keys[pos] = byte;
+    node.children[pos] = child;
+    ++node.count;
+}
+
+template<class Node>
+void art_erase_sorted(Node& node, unsigned pos) noexcept
+{
+    std::memmove(node.keys + pos, node.keys + pos + 1, node.count - pos - 1);
+    std::memmove(node.children + pos, node.children + pos + 1, (node.count - pos - 1) * sizeof(art_ref));
+    --node.count;
+}
+
+inline void art_copy_header(art_node& dst, const art_node& src) noexcept
+{
+    dst.prefix_length = src.prefix_length;
+    dst.count = src.count;
+    std::memcpy(dst.prefix, src.prefix, sizeof(dst.prefix));
+}
+} // namespace detail
+
+/**
+ * @brief An ordered map keyed by Name, as an adaptive radix tree over the bytes of names.
+ *
+ * @details The tree branches on the bytes of names from the most significant,
+ *          so that it keeps names in order. Inner nodes grow from 4 to 16, 48
+ *          and 256 children as needed, and shrink back as children are
+ *          erased, so that sparse and dense levels both stay compact. Runs of
+ *          bytes shared by all names below a node are compressed into the
+ *          node, and a name alone below a node is stored as a leaf at once.
+ *          A lookup thus costs one step per distinct byte rather than a
+ *          comparison per level of a binary tree, and dense sequential names
+ *          share their nodes of 256 children.
+ *
+ *          Inserting or erasing invalidates all iterators.
+ *
+ * @tparam T The mapped type.
+ * @tparam Allocator The allocator type, rebound to allocate both nodes and values.
+ */
+template<class T, class Allocator = std::allocator<std::pair<const Name, T>>>
+class name_art_map
+{
+    using art_ref = detail::art_ref;
+
+  public:
+    using key_type = Name;
+    using mapped_type = T;
+    using value_type = std::pair<const Name, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type = Allocator;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    static_assert(alignof(value_type) > 1, "Leaves are tagged in the lowest bit of their address");
+
+    template<bool Const>
+    class basic_iterator
+    {
+        friend class name_art_map;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename name_art_map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+        basic_iterator() noexcept = default;
+
+        template<bool C = Const, typename std::enable_if_t<C, bool> = true>
+        basic_iterator(const basic_iterator<false>& other) noexcept
+          : _stack{ other._stack }, _depth{ other._depth }, _leaf{ other._leaf }
+        {
+        }
+
+        reference operator*() const noexcept { return *_leaf; }
+        pointer operator->() const noexcept { return _leaf; }
+
+        basic_iterator& operator++() noexcept
+        {
+            advance();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            basic_iterator it(*this);
+            advance();
+            return it;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a._leaf == b._leaf; }
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) noexcept { return a._leaf != b._leaf; }
+
+      private:
+        void push(const detail::art_node* node, unsigned byte) noexcept { _stack[_depth++] = { node, byte }; }
+
+        void descend_leftmost(art_ref ref) noexcept
+        {
+            while (!detail::art_is_leaf(ref))
+            {
+                const auto* node = reinterpret_cast<const detail::art_node*>(ref);
+                const detail::art_child child = detail::art_next_child(node, 0);
+                push(node, child.byte);
+                ref = child.ref;
+            }
+            _leaf = reinterpret_cast<pointer>(ref & ~art_ref(1));
+        }
+
+        void advance() noexcept
+        {
+            while (_depth > 0)
+            {
+                detail::art_frame& top = _stack[_depth - 1];
+                const detail::art_child child = detail::art_next_child(top.node, top.byte + 1);
+                if (child.ref)
+                {
+                    top.byte = child.byte;
+                    descend_leftmost(child.ref);
+                    return;
+                }
+                --_depth;
+            }
+            _leaf = nullptr;
+        }
+
+        std::array<detail::art_frame, detail::art_key_size> _stack;
+        std::size_t _depth = 0;
+        pointer _leaf = nullptr;
+
+        template<bool>
+        friend class basic_iterator;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    name_art_map() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+    explicit name_art_map(const Allocator& alloc) noexcept : _alloc{ alloc } {}
+
+    template<class InputIt>
+    name_art_map(InputIt first, InputIt last, const Allocator& alloc = Allocator()) : _alloc{ alloc }
+    {
+        insert(first, last);
+    }
+
+    name_art_map(std::initializer_list<value_type> values, const Allocator& alloc = Allocator()) : _alloc{ alloc }
+    {
+        insert(values);
+    }
+
+    name_art_map(const name_art_map& other)
+      : _alloc{ std::allocator_traits<Allocator>::select_on_container_copy_construction(other._alloc) }
+    {
+        if (other._root) _root = clone(other._root);
+        _size = other._size;
+    }
+
+    name_art_map(name_art_map&& other) noexcept
+      : _root{ std::exchange(other._root, 0) }
+      , _size{ std::exchange(other._size, 0) }
+      , _alloc{ std::move(other._alloc) }
+    {
+    }
+
+    ~name_art_map() { clear(); }
+
+    name_art_map& operator=(const name_art_map& other)
+    {
+        if (this != &other)
+        {
+            name_art_map copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    name_art_map& operator=(name_art_map&& other) noexcept
+    {
+        name_art_map moved(std::move(other));
+        swap(moved);
+        return *this;
+    }
+
+    /*=======================================================================*/
+    // Iterators
+    /*=======================================================================*/
+
+    iterator begin() noexcept
+    {
+        iterator it;
+        if (_root) it.descend_leftmost(_root);
+        return it;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        const_iterator it;
+        if (_root) it.descend_leftmost(_root);
+        return it;
+    }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return {}; }
+    const_iterator end() const noexcept { return {}; }
+    const_iterator cend() const noexcept { return {}; }
+
+    /*=======================================================================*/
+    // Capacity
+    /*=======================================================================*/
+
+    bool empty() const noexcept { return _size == 0; }
+    size_type size() const noexcept { return _size; }
+    allocator_type get_allocator() const { return _alloc; }
+
+    /*=======================================================================*/
+    // Modifiers
+    /*=======================================================================*/
+
+    void clear() noexcept
+    {
+        if (_root) destroy_tree(_root);
+        _root = 0;
+        _size = 0;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(value.first, std::move(value.second)); }
+
+    template<class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            emplace_leaf(nullptr, first->first, first->second);
+    }
+
+    void insert(std::initializer_list<value_type> values) { insert(values.begin(), values.end()); }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const Name& key, Args&&... args)
+    {
+        iterator it;
+        const bool inserted = emplace_leaf(&it, key, std::forward<Args>(args)...).second;
+        return { it, inserted };
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const Name& key, M&& value)
+    {
+        iterator it;
+        const auto [leaf, inserted] = emplace_leaf(&it, key, std::forward<M>(value));
+        if (!inserted) leaf->second = std::forward<M>(value);
+        return { it, inserted };
+    }
+
+    T& operator[](const Name& key) { return emplace_leaf(nullptr, key).first->second; }
+
+    T& at(const Name& key)
+    {
+        value_type* leaf = find_leaf(key);
+        if (!leaf) throw std::out_of_range("Name not found in name_art_map");
+        return leaf->second;
+    }
+
+    const T& at(const Name& key) const
+    {
+        const value_type* leaf = find_leaf(key);
+        if (!leaf) throw std::out_of_range("Name not found in name_art_map");
+        return leaf->second;
+    }
+
+    /**
+     * @brief Erases the entry at pos.
+     *
+     * @details The leaf is unlinked from the parent on the path of pos, and
+     *          the path of the following entry is patched where that parent
+     *          shrinks or collapses into its last child, without walking the
+     *          tree again from the root.
+     *
+     * @returns The iterator to the entry following the erased one.
+     */
+    iterator erase(const_iterator pos)
+    {
+        iterator next;
+        next._stack = pos._stack;
+        next._depth = pos._depth;
+        next._leaf = const_cast<value_type*>(pos._leaf);
+        next.advance();
+
+        if (pos._depth == 0)
+        {
+            unlink_leaf(nullptr, 0, const_cast<value_type*>(pos._leaf));
+            return next;
+        }
+
+        const std::size_t top = pos._depth - 1;
+        const detail::art_frame& parent = pos._stack[top];
+        art_ref* slot = &_root;
+        if (top > 0)
+        {
+            const detail::art_frame& above = pos._stack[top - 1];
+            slot = detail::art_find_child(const_cast<node*>(above.node), static_cast<std::uint8_t>(above.byte));
+        }
+
+        const bool shares_parent = next._depth > top && next._stack[top].node == parent.node;
+        const art_ref parent_ref = *slot;
+        unlink_leaf(slot, static_cast<std::uint8_t>(parent.byte), const_cast<value_type*>(pos._leaf));
+        if (!shares_parent || *slot == parent_ref) return next;
+
+        // A Node4 left with one child is replaced by it, which drops the parent from the path.
+        const bool collapsed = detail::art_is_leaf(*slot) ||
+                               (next._depth > top + 1 && *slot == ref_of(const_cast<node*>(next._stack[top + 1].node)));
+        if (collapsed)
+        {
+            std::copy(next._stack.begin() + top + 1, next._stack.begin() + next._depth, next._stack.begin() + top);
+            --next._depth;
+        }
+        else
+        {
+            next._stack[top].node = node_of(*slot);
+        }
+        return next;
+    }
+
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    size_type erase(const Name& key) noexcept { return erase_leaf(key) ? 1 : 0; }
+
+    void swap(name_art_map& other) noexcept
+    {
+        using std::swap;
+        swap(_root, other._root);
+        swap(_size, other._size);
+        swap(_alloc, other._alloc);
+    }
+
+    friend void swap(name_art_map& a, name_art_map& b) noexcept { a.swap(b); }
+
+    /*=======================================================================*/
+    // Lookup
+    /*=======================================================================*/
+
+    iterator find(const Name& key) noexcept { return find_path<iterator>(*this, key); }
+    const_iterator find(const Name& key) const noexcept { return find_path<const_iterator>(*this, key); }
+
+    bool contains(const Name& key) const noexcept { return find_leaf(key) != nullptr; }
+    size_type count(const Name& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    /**
+     * @brief The first entry whose name is not less than key.
+     */
+    iterator lower_bound(const Name& key) noexcept { return lower_bound_path<iterator>(*this, key); }
+    const_iterator lower_bound(const Name& key) const noexcept { return lower_bound_path<const_iterator>(*this, key); }
+
+    /**
+     * @brief The first entry whose name is greater than key.
+     */
+    iterator upper_bound(const Name& key) noexcept { return key == ~Name{} ? end() : lower_bound(key + 1); }
+    const_iterator upper_bound(const Name& key) const noexcept { return key == ~Name{} ? end() : lower_bound(key + 1); }
+
+    /**
+     * @brief The entries whose names are within a namespace, in order.
+     */
+    std::pair<iterator, iterator> equal_range(const Namespace& ns) noexcept
+    {
+        return { lower_bound(ns.name()), upper_bound(ns.name() | (~Name{} >> ns.length())) };
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const Namespace& ns) const noexcept
+    {
+        return { lower_bound(ns.name()), upper_bound(ns.name() | (~Name{} >> ns.length())) };
+    }
+
+  private:
+    using node = detail::art_node;
+    using node4 = detail::art_node4;
+    using node16 = detail::art_node16;
+    using node48 = detail::art_node48;
+    using node256 = detail::art_node256;
+
+    template<class U>
+    using rebind_alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+    static node* node_of(art_ref ref) noexcept { return reinterpret_cast<node*>(ref); }
+    static value_type* leaf_of(art_ref ref) noexcept { return reinterpret_cast<value_type*>(ref & ~art_ref(1)); }
+    static art_ref ref_of(node* n) noexcept { return reinterpret_cast<art_ref>(n); }
+    static art_ref ref_of(value_type* leaf) noexcept { return reinterpret_cast<art_ref>(leaf) | 1; }
+
+    static bool prefix_matches(const node& n, const detail::art_key& key, std::size_t depth) noexcept
+    {
+        return std::memcmp(n.prefix, key.data() + depth, n.prefix_length) == 0;
+    }
+
+    template<class U, class... Args>
+    U* create(Args&&... args)
+    {
+        using traits = std::allocator_traits<rebind_alloc<U>>;
+        rebind_alloc<U> alloc(_alloc);
+        U* p = traits::allocate(alloc, 1);
+        try
+        {
+            traits::construct(alloc, p, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            traits::deallocate(alloc, p, 1);
+            throw;
+        }
+        return p;
+    }
+
+    template<class U>
+    void destroy(U* p) noexcept
+    {
+        using traits = std::allocator_traits<rebind_alloc<U>>;
+        rebind_alloc<U> alloc(_alloc);
+        traits::destroy(alloc, p);
+        traits::deallocate(alloc, p, 1);
+    }
+
+    template<class... Args>
+    value_type* make_leaf(const Name& key, Args&&... args)
+    {
+        return create<value_type>(
+          std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    void destroy_node(node* n) noexcept
+    {
+        switch (n->type)
+        {
+            case detail::art_type::node4:
+                return destroy(static_cast<node4*>(n));
+            case detail::art_type::node16:
+                return destroy(static_cast<node16*>(n));
+            case detail::art_type::node48:
+                return destroy(static_cast<node48*>(n));
+            default:
+                return destroy(static_cast<node256*>(n));
+        }
+    }
+
+    /**
+     * @brief Destroys a subtree, skipping the null children of a subtree only partially cloned.
+     */
+    void destroy_tree(art_ref ref) noexcept
+    {
+        if (detail::art_is_leaf(ref)) return destroy(leaf_of(ref));
+
+        node* n = node_of(ref);
+        for (unsigned from = 0;;)
+        {
+            const detail::art_child child = detail::art_next_child(n, from);
+            if (child.byte > 255) break;
+            if (child.ref) destroy_tree(child.ref);
+            from = child.byte + 1;
+        }
+        destroy_node(n);
+    }
+
+    template<class Node>
+    art_ref clone_node(const Node& src, std::size_t children)
+    {
+        Node* copy = create<Node>(src);
+        std::fill(copy->children, copy->children + children, art_ref(0));
+        try
+        {
+            for (std::size_t i = 0; i < children; ++i)
+            {
+                if (src.children[i]) copy->children[i] = clone(src.children[i]);
+            }
+        }
+        catch (...)
+        {
+            destroy_tree(ref_of(copy));
+            throw;
+        }
+        return ref_of(copy);
+    }
+
+    art_ref clone(art_ref ref)
+    {
+        if (detail::art_is_leaf(ref)) return ref_of(create<value_type>(*leaf_of(ref)));
+
+        const node* n = node_of(ref);
+        switch (n->type)
+        {
+            case detail::art_type::node4:
+                return clone_node(*static_cast<const node4*>(n), n->count);
+            case detail::art_type::node16:
+                return clone_node(*static_cast<const node16*>(n), n->count);
+            case detail::art_type::node48:
+                return clone_node(*static_cast<const node48*>(n), n->count);
+            default:
+                return clone_node(*static_cast<const node256*>(n), node256::capacity);
+        }
+    }
+
+    value_type* find_leaf(const Name& name) const noexcept
+    {
+        const detail::art_key key = detail::make_art_key(name);
+        art_ref ref = _root;
+        for (std::size_t depth = 0; ref;)
+        {
+            if (detail::art_is_leaf(ref))
+            {
+                value_type* leaf = leaf_of(ref);
+                return leaf->first == name ? leaf : nullptr;
+            }
+
+            node* n = node_of(ref);
+            if (!prefix_matches(*n, key, depth)) return nullptr;
+            depth += n->prefix_length;
+
+            const art_ref* child = detail::art_find_child(n, key[depth++]);
+            if (!child) return nullptr;
+            ref = *child;
+        }
+        return nullptr;
+    }
+
+    template<class It, class Map>
+    static It find_path(Map& map, const Name& name) noexcept
+    {
+        const detail::art_key key = detail::make_art_key(name);
+        It it;
+        art_ref ref = map._root;
+        for (std::size_t depth = 0; ref;)
+        {
+            if (detail::art_is_leaf(ref))
+            {
+                if (leaf_of(ref)->first != name) break;
+                it._leaf = leaf_of(ref);
+                return it;
+            }
+
+            node* n = node_of(ref);
+            if (!prefix_matches(*n, key, depth)) break;
+            depth += n->prefix_length;
+
+            const art_ref* child = detail::art_find_child(n, key[depth]);
+            if (!child) break;
+            it.push(n, key[depth++]);
+            ref = *child;
+        }
+        return It{};
+    }
+
+    template<class It, class Map>
+    static It lower_bound_path(Map& map, const Name& name) noexcept
+    {
+        const detail::art_key key = detail::make_art_key(name);
+        It it;
+        art_ref ref = map._root;
+        if (!ref) return it;
+
+        for (std::size_t depth = 0;;)
+        {
+            if (detail::art_is_leaf(ref))
+            {
+                if (leaf_of(ref)->first < name)
+                    it.advance();
+                else
+                    it._leaf = leaf_of(ref);
+                return it;
+            }
+
+            // A prefix greater than the key puts the whole subtree after it, and a smaller one before it.
+            node* n = node_of(ref);
+            const int order = std::memcmp(n->prefix, key.data() + depth, n->prefix_length);
+            if (order > 0)
+            {
+                it.descend_leftmost(ref);
+                return it;
+            }
+            if (order < 0)
+            {
+                it.advance();
+                return it;
+            }
+            depth += n->prefix_length;
+
+            const detail::art_child child = detail::art_next_child(n, key[depth]);
+            if (!child.ref)
+            {
+                it.advance();
+                return it;
+            }
+
+            it.push(n, child.byte);
+            if (child.byte > key[depth])
+            {
+                it.descend_leftmost(child.ref);
+                return it;
+            }
+            ref = child.ref;
+            ++depth;
+        }
+    }
+
+    /**
+     * @brief Finds the leaf of name, or inserts a leaf constructed from args.
+     * @param path If not null, set to the iterator to the leaf, built on the way down.
+     * @returns The leaf, and whether it was newly inserted.
+     */
+    template<class... Args>
+    std::pair<value_type*, bool> emplace_leaf(iterator* path, const Name& name, Args&&... args)
+    {
+        const auto found = [path](value_type* leaf, bool inserted) {
+            if (path) path->_leaf = leaf;
+            return std::pair<value_type*, bool>{ leaf, inserted };
+        };
+
+        const detail::art_key key = detail::make_art_key(name);
+        art_ref* slot = &_root;
+        for (std::size_t depth = 0;;)
+        {
+            if (!*slot)
+            {
+                value_type* leaf = make_leaf(name, std::forward<Args>(args)...);
+                *slot = ref_of(leaf);
+                ++_size;
+                return found(leaf, true);
+            }
+
+            if (detail::art_is_leaf(*slot))
+            {
+                value_type* existing = leaf_of(*slot);
+                if (existing->first == name) return found(existing, false);
+
+                // Both names share the bytes before depth, split them under a node of their other common bytes.
+                const detail::art_key other = detail::make_art_key(existing->first);
+                std::size_t common = depth;
+                while (other[common] == key[common])
+                    ++common;
+
+                value_type* leaf = make_leaf(name, std::forward<Args>(args)...);
+                node4* parent;
+                try
+                {
+                    parent = create<node4>();
+                }
+                catch (...)
+                {
+                    destroy(leaf);
+                    throw;
+                }
+
+                parent->prefix_length = static_cast<std::uint8_t>(common - depth);
+                std::memcpy(parent->prefix, key.data() + depth, common - depth);
+                add_sorted(*parent, other[common], *slot);
+                add_sorted(*parent, key[common], ref_of(leaf));
+                *slot = ref_of(parent);
+                ++_size;
+                if (path) path->push(parent, key[common]);
+                return found(leaf, true);
+            }
+
+            node* n = node_of(*slot);
+            std::size_t matched = 0;
+            while (matched < n->prefix_length && n->prefix[matched] == key[depth + matched])
+                ++matched;
+
+            if (matched < n->prefix_length)
+            {
+                // The name leaves the prefix of the node, split the prefix under a new node.
+                value_type* leaf = make_leaf(name, std::forward<Args>(args)...);
+                node4* parent;
+                try
+                {
+                    parent = create<node4>();
+                }
+                catch (...)
+                {
+                    destroy(leaf);
+                    throw;
+                }
+
+                parent->prefix_length = static_cast<std::uint8_t>(matched);
+                std::memcpy(parent->prefix, n->prefix, matched);
+                const std::uint8_t node_byte = n->prefix[matched];
+                n->prefix_length = static_cast<std::uint8_t>(n->prefix_length - matched - 1);
+                std::memmove(n->prefix, n->prefix + matched + 1, n->prefix_length);
+
+                add_sorted(*parent, node_byte, *slot);
+                add_sorted(*parent, key[depth + matched], ref_of(leaf));
+                *slot = ref_of(parent);
+                ++_size;
+                if (path) path->push(parent, key[depth + matched]);
+                return found(leaf, true);
+            }
+
+            depth += n->prefix_length;
+            art_ref* child = detail::art_find_child(n, key[depth]);
+            if (!child)
+            {
+                value_type* leaf = make_leaf(name, std::forward<Args>(args)...);
+                try
+                {
+                    add_child(*slot, key[depth], ref_of(leaf));
+                }
+                catch (...)
+                {
+                    destroy(leaf);
+                    throw;
+                }
+                ++_size;
+                if (path) path->push(node_of(*slot), key[depth]);
+                return found(leaf, true);
+            }
+
+            if (path) path->push(n, key[depth]);
+            slot = child;
+            ++depth;
+        }
+    }
+
+    template<class Node>
+    static void add_sorted(Node& n, std::uint8_t byte, art_ref child) noexcept
+    {
+        unsigned pos = 0;
+        while (pos < n.count && n.keys[pos] < byte)
+            ++pos;
+        detail::art_insert_sorted(n, pos, byte, child);
+    }
+
+    /**
+     * @brief Adds a child to the node at slot, growing the node into the next larger type when it is full.
+     */
+    void add_child(art_ref& slot, std::uint8_t byte, art_ref child)
+    {
+        node* n = node_of(slot);
+        switch (n->type)
+        {
+            case detail::art_type::node4:
+            {
+                auto* n4 = static_cast<node4*>(n);
+                if (n4->count < node4::capacity) return add_sorted(*n4, byte, child);
+
+                auto* grown = create<node16>();
+                detail::art_copy_header(*grown, *n4);
+                std::copy(n4->keys, n4->keys + n4->count, grown->keys);
+                std::copy(n4->children, n4->children + n4->count, grown->children);
+                detail::art_insert_sorted(*grown, detail::art_lower_index(*grown, byte), byte, child);
+                slot = ref_of(grown);
+                return destroy(n4);
+            }
+            case detail::art_type::node16:
+            {
+                auto* n16 = static_cast<node16*>(n);
+                if (n16->count < node16::capacity)
+                    return detail::art_insert_sorted(*n16, detail::art_lower_index(*n16, byte), byte, child);
+
+                auto* grown = create<node48>();
+                detail::art_copy_header(*grown, *n16);
+                for (unsigned i = 0; i < n16->count; ++i)
+                {
+                    grown->index[n16->keys[i]] = static_cast<std::uint8_t>(i + 1);
+                    grown->children[i] = n16->children[i];
+                }
+                grown->index[byte] = static_cast<std::uint8_t>(grown->count + 1);
+                grown->children[grown->count++] = child;
+                slot = ref_of(grown);
+                return destroy(n16);
+            }
+            case detail::art_type::node48:
+            {
+                // Children of a Node48 are kept dense, so the next free one is at count.
+                auto* n48 = static_cast<node48*>(n);
+                if (n48->count < node48::capacity)
+                {
+                    n48->index[byte] = static_cast<std::uint8_t>(n48->count + 1);
+                    n48->children[n48->count++] = child;
+                    return;
+                }
+
+                auto* grown = create<node256>();
+                detail::art_copy_header(*grown, *n48);
+                for (unsigned b = 0; b < 256; ++b)
+                {
+                    if (n48->index[b]) grown->children[b] = n48->children[n48->index[b] - 1];
+                }
+                grown->children[byte] = child;
+                ++grown->count;
+                slot = ref_of(grown);
+                return destroy(n48);
+            }
+            default:
+            {
+                auto* n256 = static_cast<node256*>(n);
+                n256->children[byte] = child;
+                ++n256->count;
+                return;
+            }
+        }
+    }
+
+    bool erase_leaf(const Name& name) noexcept
+    {
+        const detail::art_key key = detail::make_art_key(name);
+        art_ref* slot = &_root;
+        art_ref* parent = nullptr;
+        std::uint8_t parent_byte = 0;
+        for (std::size_t depth = 0; *slot;)
+        {
+            if (detail::art_is_leaf(*slot))
+            {
+                value_type* leaf = leaf_of(*slot);
+                if (leaf->first != name) return false;
+
+                unlink_leaf(parent, parent_byte, leaf);
+                return true;
+            }
+
+            node* n = node_of(*slot);
+            if (!prefix_matches(*n, key, depth)) return false;
+            depth += n->prefix_length;
+
+            art_ref* child = detail::art_find_child(n, key[depth]);
+            if (!child) return false;
+
+            parent = slot;
+            parent_byte = key[depth++];
+            slot = child;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Removes a leaf from the node at parent under byte, or from the root if parent is null, and destroys it.
+     */
+    void unlink_leaf(art_ref* parent, std::uint8_t byte, value_type* leaf) noexcept
+    {
+        if (parent)
+            remove_child(*parent, byte);
+        else
+            _root = 0;
+
+        destroy(leaf);
+        --_size;
+    }
+
+    /**
+     * @brief Removes a child from the node at slot, shrinking the node into the next smaller type when it is sparse.
+     *
+     * @details Nodes shrink at fewer children than they grow at, so that
+     *          alternating inserts and erases do not resize them every time.
+     *          A Node4 left with a single child is replaced by it, merging
+     *          its prefix into the child.
+     */
+    void remove_child(art_ref& slot, std::uint8_t byte) noexcept
+    {
+        node* n = node_of(slot);
+        switch (n->type)
+        {
+            case detail::art_type::node4:
+            {
+                auto* n4 = static_cast<node4*>(n);
+                unsigned pos = 0;
+                while (n4->keys[pos] != byte)
+                    ++pos;
+                detail::art_erase_sorted(*n4, pos);
+                if (n4->count > 1) return;
+
+                const art_ref only = n4->children[0];
+                if (!detail::art_is_leaf(only))
+                {
+                    node* child = node_of(only);
+                    const std::size_t merged = n4->prefix_length + 1u;
+                    std::memmove(child->prefix + merged, child->prefix, child->prefix_length);
+                    std::memcpy(child->prefix, n4->prefix, n4->prefix_length);
+                    child->prefix[n4->prefix_length] = n4->keys[0];
+                    child->prefix_length = static_cast<std::uint8_t>(child->prefix_length + merged);
+                }
+                slot = only;
+                return destroy(n4);
+            }
+            case detail::art_type::node16:
+            {
+                auto* n16 = static_cast<node16*>(n);
+                detail::art_erase_sorted(*n16, static_cast<unsigned>(detail::art_find_index(*n16, byte)));
+                if (n16->count > node4::capacity - 1) return;
+
+                node4* shrunk = try_create<node4>();
+                if (!shrunk) return;
+
+                detail::art_copy_header(*shrunk, *n16);
+                std::copy(n16->keys, n16->keys + n16->count, shrunk->keys);
+                std::copy(n16->children, n16->children + n16->count, shrunk->children);
+                slot = ref_of(shrunk);
+                return destroy(n16);
+            }
+            case detail::art_type::node48:
+            {
+                auto* n48 = static_cast<node48*>(n);
+                const unsigned pos = n48->index[byte] - 1u;
+                const unsigned last = n48->count - 1u;
+                n48->index[byte] = 0;
+                if (pos != last)
+                {
+                    n48->children[pos] = n48->children[last];
+                    for (unsigned b = 0; b < 256; ++b)
+                    {
+                        if (n48->index[b] == last + 1) n48->index[b] = static_cast<std::uint8_t>(pos + 1);
+                    }
+                }
+                n48->children[last] = 0;
+                --n48->count;
+                if (n48->count > node16::capacity - 4) return;
+
+                node16* shrunk = try_create<node16>();
+                if (!shrunk) return;
+
+                detail::art_copy_header(*shrunk, *n48);
+                unsigned i = 0;
+                for (unsigned b = 0; b < 256; ++b)
+                {
+                    if (!n48->index[b]) continue;
+                    shrunk->keys[i] = static_cast<std::uint8_t>(b);
+                    shrunk->children[i++] = n48->children[n48->index[b] - 1];
+                }
+                slot = ref_of(shrunk);
+                return destroy(n48);
+            }
+            default:
+            {
+                auto* n256 = static_cast<node256*>(n);
+                n256->children[byte] = 0;
+                --n256->count;
+                if (n256->count > node48::capacity - 12) return;
+
+                node48* shrunk = try_create<node48>();
+                if (!shrunk) return;
+
+                detail::art_copy_header(*shrunk, *n256);
+                unsigned i = 0;
+                for (unsigned b = 0; b < 256; ++b)
+                {
+                    if (!n256->children[b]) continue;
+                    shrunk->index[b] = static_cast<std::uint8_t>(i + 1);
+                    shrunk->children[i++] = n256->children[b];
+                }
+                slot = ref_of(shrunk);
+                return destroy(n256);
+            }
+        }
+    }
+
+    /**
+     * @brief Creates a smaller node when erasing, where running out of memory only keeps the larger node.
+     */
+    template<class Node>
+    Node* try_create() noexcept
+    {
+        try
+        {
+            return create<Node>();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+  private:
+    art_ref _root = 0;
+    size_type _size = 0;
+    Allocator _alloc;
+};
+} // namespace quicr
@@ -0,0 +1,575 @@
+#pragma once
+
+#include "name.h"
+#include "namespace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace quicr
+{
+/**
+ * @brief The default size charged for a cached object, its sizeof.
+ */
+struct object_size
+{
+    template<class T>
+    constexpr std::size_t operator()(const T&) const noexcept
+    {
+        return sizeof(T);
+    }
+};
+
+namespace detail
+{
+/**
+ * @brief A block of sorted names in the index of a name_cache, with the slot of the object of each name.
+ */
+struct name_cache_block
+{
+    static constexpr std::uint32_t capacity = 64;
+
+    std::uint32_t size = 0;
+    Name keys[capacity];
+    std::uint32_t slots[capacity];
+
+    std::uint32_t lower_bound(const Name& name) const noexcept
+    {
+        return static_cast<std::uint32_t>(std::lower_bound(keys, keys + size, name) - keys);
+    }
+
+    std::uint32_t upper_bound(std::uint32_t from, const Name& name) const noexcept
+    {
+        return static_cast<std::uint32_t>(std::upper_bound(keys + from, keys + size, name) - keys);
+    }
+
+    void insert(std::uint32_t pos, const Name& name, std::uint32_t slot) noexcept
+    {
+        std::move_backward(keys + pos, keys + size, keys + size + 1);
+        std::move_backward(slots + pos, slots + size, slots + size + 1);
+        keys[pos] = name;
+        slots[pos] = slot;
+        ++size;
+    }
+
+    void erase(std::uint32_t first, std::uint32_t last) noexcept
+    {
+        std::move(keys + last, keys + size, keys + first);
+        std::move(slots + last, slots + size, slots + first);
+        size -= last - first;
+    }
+};
+} // namespace detail
+
+/**
+ * @brief A cache of objects keyed by Name, ordered by name, with a memory budget.
+ *
+ * @details Names are indexed in sorted blocks of up to 64 names, found by a
+ *          binary search over the first name of every block, rather than in a
+ *          tree with a node per entry. Range fetches thus scan contiguous
+ *          names, and names appended in increasing order, such as the objects
+ *          of a track, fill blocks completely. Objects live in a separate slab
+ *          of slots, which are reused once evicted.
+ *
+ *          Each object is charged a size by SizeOf, and once the sum of the
+ *          sizes exceeds the budget, the least recently used objects are
+ *          evicted. Objects can also be evicted by age, from the time they
+ *          were put, or all at once within a namespace.
+ *
+ *          Pointers returned by get and peek are invalidated by put.
+ *
+ * @tparam T The type of the objects.
+ * @tparam SizeOf The functor giving the size charged for an object against the budget.
+ * @tparam Clock The clock stamping objects when they are put.
+ */
+template<class T, class SizeOf = object_size, class Clock = std::chrono::steady_clock>
+class name_cache
+{
+    using block = detail::name_cache_block;
+    static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+  public:
+    using key_type = Name;
+    using mapped_type = T;
+    using size_type = std::size_t;
+    using time_point = typename Clock::time_point;
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param budget The maximum sum of the sizes of the cached objects.
+     * @param size_of The functor giving the size of an object.
+     */
+    explicit name_cache(std::size_t budget = std::numeric_limits<std::size_t>::max(), SizeOf size_of = SizeOf())
+      : _budget{ budget }, _size_of{ std::move(size_of) }
+    {
+    }
+
+    name_cache(const name_cache& other)
+      : _firsts{ other._firsts }
+      , _entries{ other._entries }
+      , _free{ other._free }
+      , _lru{ other._lru }
+      , _age{ other._age }
+      , _used{ other._used }
+      , _budget{ other._budget }
+      , _size_of{ other._size_of }
+    {
+        _blocks.reserve(other._blocks.size());
+        for (const auto& b : other._blocks)
+            _blocks.push_back(std::make_unique<block>(*b));
+    }
+
+    name_cache(name_cache&& other) noexcept = default;
+
+    name_cache& operator=(const name_cache& other)
+    {
+        if (this != &other)
+        {
+            name_cache copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    name_cache& operator=(name_cache&& other) noexcept = default;
+
+    /*=======================================================================*/
+    // Capacity
+    /*=======================================================================*/
+
+    bool empty() const noexcept { return size() == 0; }
+    size_type size() const noexcept { return _entries.size() - _free.size(); }
+
+    /**
+     * @brief The sum of the sizes of the cached objects.
+     */
+    std::size_t memory_used() const noexcept { return _used; }
+
+    std::size_t budget() const noexcept { return _budget; }
+
+    /**
+     * @brief Changes the budget, evicting the least recently used objects until the cache fits in it.
+     * @param budget The maximum sum of the sizes of the cached objects.
+     */
+    void set_budget(std::size_t budget)
+    {
+        _budget = budget;
+        evict_to_budget();
+    }
+
+    /*=======================================================================*/
+    // Modifiers
+    /*=======================================================================*/
+
+    /**
+     * @brief Caches an object, replacing any object of the same name.
+     *
+     * @details The object becomes the most recently used, and is stamped with
+     *          the current time of the clock. Least recently used objects are
+     *          then evicted until the cache fits in its budget.
+     *
+     * @param name The name of the object.
+     * @param value The object.
+     * @returns True if the object is cached, false if its size alone exceeds the budget.
+     */
+    bool put(const Name& name, T value)
+    {
+        const std::size_t charge = _size_of(std::as_const(value));
+        std::uint32_t slot = find_slot(name);
+
+        if (charge > _budget)
+        {
+            if (slot != npos) erase(name);
+            return false;
+        }
+
+        if (slot != npos)
+        {
+            unlink(_lru, &entry::lru, slot);
+            unlink(_age, &entry::age, slot);
+            _used -= _entries[slot].charge;
+        }
+        else
+        {
+            slot = allocate_slot(name);
+            index_insert(name, slot);
+        }
+
+        entry& e = _entries[slot];
+        e.value = std::move(value);
+        e.charge = charge;
+        e.stamp = Clock::now();
+        link_front(_lru, &entry::lru, slot);
+        link_front(_age, &entry::age, slot);
+        _used += charge;
+
+        evict_to_budget();
+        return true;
+    }
+
+    /**
+     * @brief Evicts the object of a name.
+     * @returns True if an object was evicted.
+     */
+    bool erase(const Name& name)
+    {
+        if (_blocks.empty()) return false;
+
+        const std::size_t index = block_of(name);
+        const std::uint32_t pos = _blocks[index]->lower_bound(name);
+        if (pos == _blocks[index]->size || _blocks[index]->keys[pos] != name) return false;
+
+        release_slot(_blocks[index]->slots[pos]);
+        index_erase(index, pos);
+        return true;
+    }
+
+    /**
+     * @brief Evicts all objects with names in [first, last].
+     * @returns The number of objects evicted.
+     */
+    std::size_t erase(const Name& first, const Name& last)
+    {
+        if (_blocks.empty() || last < first) return 0;
+
+        const std::size_t first_block = block_of(first);
+        std::size_t index = first_block;
+        std::uint32_t pos = _blocks[index]->lower_bound(first);
+        std::size_t erased = 0;
+
+        for (;; ++index, pos = 0)
+        {
+            block& b = *_blocks[index];
+            const std::uint32_t size = b.size;
+            const std::uint32_t end = b.upper_bound(pos, last);
+            for (std::uint32_t i = pos; i < end; ++i)
+                release_slot(b.slots[i]);
+
+            erased += end - pos;
+            b.erase(pos, end);
+            if (b.size && pos == 0) _firsts[index] = b.keys[0];
+            if (end < size || index + 1 == _blocks.size()) break;
+        }
+
+        // Drop the blocks emptied on the way, which are all between the first and last blocks visited.
+        std::size_t kept = first_block;
+        for (std::size_t i = first_block; i <= index; ++i)
+        {
+            if (_blocks[i]->size == 0) continue;
+            _blocks[kept] = std::move(_blocks[i]);
+            _firsts[kept++] = _firsts[i];
+        }
+        _blocks.erase(_blocks.begin() + kept, _blocks.begin() + index + 1);
+        _firsts.erase(_firsts.begin() + kept, _firsts.begin() + index + 1);
+
+        return erased;
+    }
+
+    /**
+     * @brief Evicts all objects with names within a namespace.
+     * @returns The number of objects evicted.
+     */
+    std::size_t erase(const Namespace& ns) { return erase(ns.name(), last_name(ns)); }
+
+    /**
+     * @brief Evicts all objects put before a given time.
+     * @param cutoff The time before which objects are evicted.
+     * @returns The number of objects evicted.
+     */
+    std::size_t evict_older_than(time_point cutoff)
+    {
+        std::size_t evicted = 0;
+        for (; _age.tail != npos && _entries[_age.tail].stamp < cutoff; ++evicted)
+            evict(_age.tail);
+
+        return evicted;
+    }
+
+    void clear() noexcept
+    {
+        _firsts.clear();
+        _blocks.clear();
+        _entries.clear();
+        _free.clear();
+        _lru = {};
+        _age = {};
+        _used = 0;
+    }
+
+    /*=======================================================================*/
+    // Lookup
+    /*=======================================================================*/
+
+    /**
+     * @brief Gets the object of a name, making it the most recently used.
+     * @returns A pointer to the object, or nullptr if it is not cached.
+     */
+    T* get(const Name& name) noexcept
+    {
+        const std::uint32_t slot = find_slot(name);
+        if (slot == npos) return nullptr;
+
+        unlink(_lru, &entry::lru, slot);
+        link_front(_lru, &entry::lru, slot);
+        return &*_entries[slot].value;
+    }
+
+    /**
+     * @brief Gets the object of a name, without changing how recently it was used.
+     * @returns A pointer to the object, or nullptr if it is not cached.
+     */
+    const T* peek(const Name& name) const noexcept
+    {
+        const std::uint32_t slot = find_slot(name);
+        return slot == npos ? nullptr : &*_entries[slot].value;
+    }
+
+    bool contains(const Name& name) const noexcept { return find_slot(name) != npos; }
+
+    /**
+     * @brief Visits the objects with names in [first, last] in order of name,
+     *        without changing how recently they were used.
+     *
+     * @param first The first name of the range.
+     * @param last The last name of the range, included.
+     * @param fn The function called with the name and object of each object in the range.
+     * @returns The number of objects visited.
+     */
+    template<class Fn>
+    std::size_t range(const Name& first, const Name& last, Fn&& fn) const
+    {
+        if (_blocks.empty() || last < first) return 0;
+
+        std::size_t count = 0;
+        std::size_t index = block_of(first);
+        for (std::uint32_t pos = _blocks[index]->lower_bound(first); index < _blocks.size(); ++index, pos = 0)
+        {
+            const block& b = *_blocks[index];
+            for (; pos < b.size; ++pos, ++count)
+            {
+                if (last < b.keys[pos]) return count;
+                fn(b.keys[pos], std::as_const(*_entries[b.slots[pos]].value));
+            }
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Visits the objects with names within a namespace in order of name,
+     *        without changing how recently they were used.
+     *
+     * @param ns The namespace of the objects.
+     * @param fn The function called with the name and object of each object in the namespace.
+     * @returns The number of objects visited.
+     */
+    template<class Fn>
+    std::size_t range(const Namespace& ns, Fn&& fn) const
+    {
+        return range(ns.name(), last_name(ns), std::forward<Fn>(fn));
+    }
+
+  private:
+    struct links
+    {
+        std::uint32_t prev = npos;
+        std::uint32_t next = npos;
+    };
+
+    struct list
+    {
+        std::uint32_t head = npos;
+        std::uint32_t tail = npos;
+    };
+
+    struct entry
+    {
+        Name name;
+        std::optional<T> value;
+        std::size_t charge = 0;
+        time_point stamp{};
+        links lru;
+        links age;
+    };
+
+    static Name last_name(const Namespace& ns) noexcept { return ns.name() | (~Name{} >> ns.length()); }
+
+    /**
+     * @brief The block that holds name if it is cached: the last block whose first name is not greater, or block 0.
+     */
+    std::size_t block_of(const Name& name) const noexcept
+    {
+        const auto it = std::upper_bound(_firsts.begin(), _firsts.end(), name);
+        return it == _firsts.begin() ? 0 : static_cast<std::size_t>(it - _firsts.begin()) - 1;
+    }
+
+    std::uint32_t find_slot(const Name& name) const noexcept
+    {
+        if (_blocks.empty()) return npos;
+
+        const block& b = *_blocks[block_of(name)];
+        const std::uint32_t pos = b.lower_bound(name);
+        return pos < b.size && b.keys[pos] == name ? b.slots[pos] : npos;
+    }
+
+    void index_insert(const Name& name, std::uint32_t slot)
+    {
+        if (_blocks.empty())
+        {
+            _blocks.push_back(std::make_unique<block>());
+            _firsts.push_back(name);
+        }
+
+        std::size_t index = block_of(name);
+        block* b = _blocks[index].get();
+        std::uint32_t pos = b->lower_bound(name);
+
+        if (b->size == block::capacity)
+        {
+            auto next = std::make_unique<block>();
+            if (pos == b->size && index + 1 == _blocks.size())
+            {
+                // Names appended past the last block start a new one, so that increasing names fill blocks.
+                pos = 0;
+            }
+            else
+            {
+                constexpr std::uint32_t half = block::capacity / 2;
+                std::copy(b->keys + half, b->keys + block::capacity, next->keys);
+                std::copy(b->slots + half, b->slots + block::capacity, next->slots);
+                next->size = block::capacity - half;
+                b->size = half;
+
+                if (pos <= half)
+                {
+                    _blocks.insert(_blocks.begin() + index + 1, std::move(next));
+                    _firsts.insert(_firsts.begin() + index + 1, _blocks[index + 1]->keys[0]);
+                    b->insert(pos, name, slot);
+                    if (pos == 0) _firsts[index] = name;
+                    return;
+                }
+
+                pos -= half;
+            }
+
+            _firsts.insert(_firsts.begin() + index + 1, pos == 0 ? name : next->keys[0]);
+            _blocks.insert(_blocks.begin() + index + 1, std::move(next));
+            _blocks[index + 1]->insert(pos, name, slot);
+            return;
+        }
+
+        b->insert(pos, name, slot);
+        if (pos == 0) _firsts[index] = name;
+    }
+
+    void index_erase(std::size_t index, std::uint32_t pos) noexcept
+    {
+        block& b = *_blocks[index];
+        b.erase(pos, pos + 1);
+
+        if (b.size == 0)
+        {
+            _blocks.erase(_blocks.begin() + index);
+            _firsts.erase(_firsts.begin() + index);
+        }
+        else if (pos == 0)
+        {
+            _firsts[index] = b.keys[0];
+        }
+    }
+
+    std::uint32_t allocate_slot(const Name& name)
+    {
+        std::uint32_t slot;
+        if (!_free.empty())
+        {
+            slot = _free.back();
+            _free.pop_back();
+        }
+        else
+        {
+            if (_entries.size() == npos) throw std::length_error("name_cache cannot hold more objects");
+            slot = static_cast<std::uint32_t>(_entries.size());
+            _entries.emplace_back();
+        }
+
+        _entries[slot].name = name;
+        return slot;
+    }
+
+    /**
+     * @brief Frees the slot of an object, leaving its name in the index.
+     */
+    void release_slot(std::uint32_t slot) noexcept
+    {
+        entry& e = _entries[slot];
+        unlink(_lru, &entry::lru, slot);
+        unlink(_age, &entry::age, slot);
+        _used -= e.charge;
+        e.value.reset();
+        e.charge = 0;
+        _free.push_back(slot);
+    }
+
+    void evict(std::uint32_t slot) noexcept
+    {
+        const Name name = _entries[slot].name;
+        const std::size_t index = block_of(name);
+        index_erase(index, _blocks[index]->lower_bound(name));
+        release_slot(slot);
+    }
+
+    void evict_to_budget() noexcept
+    {
+        while (_used > _budget && _lru.tail != npos)
+            evict(_lru.tail);
+    }
+
+    void link_front(list& l, links entry::*member, std::uint32_t slot) noexcept
+    {
+        links& node = _entries[slot].*member;
+        node.prev = npos;
+        node.next = l.head;
+        if (l.head != npos)
+            (_entries[l.head].*member).prev = slot;
+        else
+            l.tail = slot;
+        l.head = slot;
+    }
+
+    void unlink(list& l, links entry::*member, std::uint32_t slot) noexcept
+    {
+        links& node = _entries[slot].*member;
+        if (node.prev != npos)
+            (_entries[node.prev].*member).next = node.next;
+        else
+            l.head = node.next;
+
+        if (node.next != npos)
+            (_entries[node.next].*member).prev = node.prev;
+        else
+            l.tail = node.prev;
+
+        node = links{};
+    }
+
+  private:
+    std::vector<Name> _firsts;
+    std::vector<std::unique_ptr<block>> _blocks;
+    std::vector<entry> _entries;
+    std::vector<std::uint32_t> _free;
+    list _lru;
+    list _age;
+    std::size_t _used = 0;
+    std::size_t _budget;
+    SizeOf _size_of;
+};
+} // namespace quicr
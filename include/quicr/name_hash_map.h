@@ -0,0 +1,682 @@
+#pragma once
+
+#include "_utilities.h"
+#include "name.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#endif
+
+namespace quicr
+{
+namespace detail
+{
+/**
+ * @brief Control byte of a table slot.
+ *
+ * @details Full slots store the 7 low bits of their hash, so the sign bit is
+ *          only set for the empty and deleted states.
+ */
+using ctrl_t = std::int8_t;
+constexpr ctrl_t ctrl_empty = -128;
+constexpr ctrl_t ctrl_deleted = -2;
+
+constexpr bool is_full(ctrl_t ctrl) noexcept
+{
+    return ctrl >= 0;
+}
+
+/**
+ * @brief A group of 16 control bytes which can be matched against in parallel.
+ *
+ * @details Uses SSE2 when available, and otherwise falls back to a scalar
+ *          loop. Every match returns a bitmask where bit i is set if the
+ *          control byte i of the group matched.
+ */
+class ctrl_group
+{
+  public:
+    static constexpr std::size_t width = 16;
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    explicit ctrl_group(const ctrl_t* pos) noexcept
+      : _ctrl{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)) }
+    {
+    }
+
+    std::uint32_t match(ctrl_t hash) const noexcept
+    {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(hash))));
+    }
+
+    std::uint32_t match_empty() const noexcept { return match(ctrl_empty); }
+
+    std::uint32_t match_empty_or_deleted() const noexcept
+    {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_ctrl));
+    }
+
+  private:
+    __m128i _ctrl;
+#else
+    explicit ctrl_group(const ctrl_t* pos) noexcept { std::memcpy(_ctrl, pos, width); }
+
+    std::uint32_t match(ctrl_t hash) const noexcept
+    {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < width; ++i)
+            mask |= std::uint32_t(_ctrl[i] == hash) << i;
+        return mask;
+    }
+
+    std::uint32_t match_empty() const noexcept { return match(ctrl_empty); }
+
+    std::uint32_t match_empty_or_deleted() const noexcept
+    {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < width; ++i)
+            mask |= std::uint32_t(_ctrl[i] < 0) << i;
+        return mask;
+    }
+
+  private:
+    ctrl_t _ctrl[width];
+#endif
+};
+
+/**
+ * @brief Open addressing hash table keyed by Name, with Swiss table style group probing.
+ *
+ * @details Values are stored inline in a flat slot array, next to a parallel
+ *          array of control bytes. Lookups hash the key once, then probe whole
+ *          groups of 16 control bytes at a time, only comparing keys for slots
+ *          whose control byte matches 7 bits of the hash. The table grows by
+ *          doubling once it is 7/8 full.
+ *
+ * @tparam Policy Describes the stored value type and how to get its key.
+ * @tparam Hash The hasher for Name.
+ * @tparam KeyEqual The equality comparator for Name.
+ * @tparam Allocator The allocator type of the stored values.
+ */
+template<class Policy, class Hash, class KeyEqual, class Allocator>
+class name_hash_table
+{
+    using value_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<typename Policy::value_type>;
+    using value_traits = std::allocator_traits<value_alloc_t>;
+    using ctrl_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<ctrl_t>;
+    using ctrl_traits = std::allocator_traits<ctrl_alloc_t>;
+
+  public:
+    using key_type = Name;
+    using value_type = typename Policy::value_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    template<bool Const>
+    class basic_iterator
+    {
+        friend class name_hash_table;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Policy::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+        basic_iterator() noexcept = default;
+
+        template<bool C = Const, typename std::enable_if_t<C, bool> = true>
+        basic_iterator(const basic_iterator<false>& other) noexcept : _ctrl{ other._ctrl }, _slot{ other._slot }, _end{ other._end }
+        {
+        }
+
+        reference operator*() const noexcept { return *_slot; }
+        pointer operator->() const noexcept { return _slot; }
+
+        basic_iterator& operator++() noexcept
+        {
+            ++_ctrl;
+            ++_slot;
+            skip_empty();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            basic_iterator it(*this);
+            ++(*this);
+            return it;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a._slot == b._slot; }
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) noexcept { return a._slot != b._slot; }
+
+      private:
+        basic_iterator(const ctrl_t* ctrl, pointer slot, const ctrl_t* end) noexcept
+          : _ctrl{ ctrl }, _slot{ slot }, _end{ end }
+        {
+        }
+
+        void skip_empty() noexcept
+        {
+            while (_ctrl != _end && !is_full(*_ctrl))
+            {
+                ++_ctrl;
+                ++_slot;
+            }
+        }
+
+        const ctrl_t* _ctrl = nullptr;
+        pointer _slot = nullptr;
+        const ctrl_t* _end = nullptr;
+
+        template<bool>
+        friend class basic_iterator;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    name_hash_table() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    explicit name_hash_table(size_type bucket_count,
+                             const Hash& hash = Hash(),
+                             const KeyEqual& equal = KeyEqual(),
+                             const Allocator& alloc = Allocator())
+      : _hash{ hash }, _equal{ equal }, _alloc{ alloc }
+    {
+        reserve(bucket_count);
+    }
+
+    name_hash_table(std::initializer_list<value_type> values) : name_hash_table(values.size())
+    {
+        for (const auto& value : values)
+            insert(value);
+    }
+
+    name_hash_table(const name_hash_table& other)
+      : _hash{ other._hash }
+      , _equal{ other._equal }
+      , _alloc{ value_traits::select_on_container_copy_construction(other._alloc) }
+    {
+        reserve(other._size);
+        for (const auto& value : other)
+            insert(value);
+    }
+
+    name_hash_table(name_hash_table&& other) noexcept
+      : _ctrl{ std::exchange(other._ctrl, nullptr) }
+      , _slots{ std::exchange(other._slots, nullptr) }
+      , _capacity{ std::exchange(other._capacity, 0) }
+      , _size{ std::exchange(other._size, 0) }
+      , _growth_left{ std::exchange(other._growth_left, 0) }
+      , _hash{ std::move(other._hash) }
+      , _equal{ std::move(other._equal) }
+      , _alloc{ std::move(other._alloc) }
+    {
+    }
+
+    ~name_hash_table() { destroy(); }
+
+    name_hash_table& operator=(const name_hash_table& other)
+    {
+        if (this != &other)
+        {
+            name_hash_table copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    name_hash_table& operator=(name_hash_table&& other) noexcept
+    {
+        name_hash_table moved(std::move(other));
+        swap(moved);
+        return *this;
+    }
+
+    /*=======================================================================*/
+    // Iterators
+    /*=======================================================================*/
+
+    iterator begin() noexcept
+    {
+        iterator it(_ctrl, _slots, _ctrl + _capacity);
+        it.skip_empty();
+        return it;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        const_iterator it(_ctrl, _slots, _ctrl + _capacity);
+        it.skip_empty();
+        return it;
+    }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return { _ctrl + _capacity, _slots + _capacity, _ctrl + _capacity }; }
+    const_iterator end() const noexcept { return { _ctrl + _capacity, _slots + _capacity, _ctrl + _capacity }; }
+    const_iterator cend() const noexcept { return end(); }
+
+    /*=======================================================================*/
+    // Capacity
+    /*=======================================================================*/
+
+    bool empty() const noexcept { return _size == 0; }
+    size_type size() const noexcept { return _size; }
+    size_type bucket_count() const noexcept { return _capacity; }
+    float load_factor() const noexcept { return _capacity ? float(_size) / float(_capacity) : 0.0f; }
+    static constexpr float max_load_factor() noexcept { return 7.0f / 8.0f; }
+
+    hasher hash_function() const { return _hash; }
+    key_equal key_eq() const { return _equal; }
+    allocator_type get_allocator() const { return allocator_type(_alloc); }
+
+    /**
+     * @brief Reserves enough room for at least count values without rehashing.
+     * @param count The number of values to reserve room for.
+     */
+    void reserve(size_type count)
+    {
+        size_type capacity = ctrl_group::width;
+        while (max_growth(capacity) < count)
+            capacity *= 2;
+
+        if (capacity > _capacity) resize(capacity);
+    }
+
+    /**
+     * @brief Rehashes the table to have at least count slots, dropping all tombstones.
+     * @param count The minimum number of slots.
+     */
+    void rehash(size_type count)
+    {
+        size_type capacity = ctrl_group::width;
+        while (capacity < count || max_growth(capacity) < _size)
+            capacity *= 2;
+
+        resize(capacity);
+    }
+
+    /*=======================================================================*/
+    // Modifiers
+    /*=======================================================================*/
+
+    void clear() noexcept
+    {
+        if (!_capacity) return;
+
+        for (size_type i = 0; i < _capacity; ++i)
+        {
+            if (is_full(_ctrl[i])) value_traits::destroy(_alloc, _slots + i);
+        }
+
+        std::memset(_ctrl, ctrl_empty, _capacity);
+        _size = 0;
+        _growth_left = max_growth(_capacity);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return emplace_key(Policy::key(value), value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        const Name key = Policy::key(value);
+        return emplace_key(key, std::move(value));
+    }
+
+    template<class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+        return insert(std::move(value));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        const size_type index = static_cast<size_type>(pos._ctrl - _ctrl);
+        iterator next(_ctrl + index, _slots + index, _ctrl + _capacity);
+        ++next;
+
+        erase_at(index);
+        return next;
+    }
+
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    size_type erase(const Name& key)
+    {
+        const size_type index = find_index(key);
+        if (index == _capacity) return 0;
+
+        erase_at(index);
+        return 1;
+    }
+
+    void swap(name_hash_table& other) noexcept
+    {
+        using std::swap;
+        swap(_ctrl, other._ctrl);
+        swap(_slots, other._slots);
+        swap(_capacity, other._capacity);
+        swap(_size, other._size);
+        swap(_growth_left, other._growth_left);
+        swap(_hash, other._hash);
+        swap(_equal, other._equal);
+        swap(_alloc, other._alloc);
+    }
+
+    friend void swap(name_hash_table& a, name_hash_table& b) noexcept { a.swap(b); }
+
+    /*=======================================================================*/
+    // Lookup
+    /*=======================================================================*/
+
+    iterator find(const Name& key) noexcept
+    {
+        const size_type index = find_index(key);
+        return { _ctrl + index, _slots + index, _ctrl + _capacity };
+    }
+
+    const_iterator find(const Name& key) const noexcept
+    {
+        const size_type index = find_index(key);
+        return { _ctrl + index, _slots + index, _ctrl + _capacity };
+    }
+
+    bool contains(const Name& key) const noexcept { return find_index(key) != _capacity; }
+    size_type count(const Name& key) const noexcept { return contains(key) ? 1 : 0; }
+
+  protected:
+    /**
+     * @brief Finds the slot of key, or constructs a new value from args in a free slot.
+     * @returns The iterator to the value, and whether it was newly inserted.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> emplace_key(const Name& key, Args&&... args)
+    {
+        const std::size_t hash = _hash(key);
+        size_type index = find_index(key, hash);
+        if (index != _capacity) return { { _ctrl + index, _slots + index, _ctrl + _capacity }, false };
+
+        if (_growth_left == 0)
+        {
+            // Drop tombstones in place if they make up most of the used slots, otherwise grow.
+            resize(_size * 2 > max_growth(_capacity) || _capacity == 0 ? std::max(_capacity * 2, ctrl_group::width)
+                                                                       : _capacity);
+        }
+
+        index = find_first_non_full(hash);
+        value_traits::construct(_alloc, _slots + index, std::forward<Args>(args)...);
+
+        _growth_left -= _ctrl[index] == ctrl_empty;
+        _ctrl[index] = h2(hash);
+        ++_size;
+
+        return { { _ctrl + index, _slots + index, _ctrl + _capacity }, true };
+    }
+
+  private:
+    static constexpr size_type max_growth(size_type capacity) noexcept { return capacity - capacity / 8; }
+    static constexpr std::size_t h1(std::size_t hash) noexcept { return hash >> 7; }
+    static constexpr ctrl_t h2(std::size_t hash) noexcept { return static_cast<ctrl_t>(hash & 0x7F); }
+
+    size_type find_index(const Name& key) const noexcept { return find_index(key, _hash(key)); }
+
+    /**
+     * @brief Probes the table for key.
+     * @returns The index of the slot holding key, or the capacity if it is not found.
+     */
+    size_type find_index(const Name& key, std::size_t hash) const noexcept
+    {
+        if (_capacity == 0) return 0;
+
+        const size_type group_mask = _capacity / ctrl_group::width - 1;
+        const ctrl_t tag = h2(hash);
+
+        size_type group_index = h1(hash) & group_mask;
+        for (size_type step = 1;; ++step)
+        {
+            const size_type offset = group_index * ctrl_group::width;
+            const ctrl_group group(_ctrl + offset);
+
+            for (std::uint32_t match = group.match(tag); match; match &= match - 1)
+            {
+                const size_type index = offset + utility::countr_zero(match);
+                if (_equal(Policy::key(_slots[index]), key)) return index;
+            }
+
+            if (group.match_empty()) return _capacity;
+
+            group_index = (group_index + step) & group_mask;
+        }
+    }
+
+    /**
+     * @brief Finds the first empty or deleted slot in the probe sequence of hash.
+     */
+    size_type find_first_non_full(std::size_t hash) const noexcept
+    {
+        const size_type group_mask = _capacity / ctrl_group::width - 1;
+
+        size_type group_index = h1(hash) & group_mask;
+        for (size_type step = 1;; ++step)
+        {
+            const size_type offset = group_index * ctrl_group::width;
+            const std::uint32_t mask = ctrl_group(_ctrl + offset).match_empty_or_deleted();
+            if (mask) return offset + utility::countr_zero(mask);
+
+            group_index = (group_index + step) & group_mask;
+        }
+    }
+
+    void erase_at(size_type index) noexcept
+    {
+        value_traits::destroy(_alloc, _slots + index);
+        --_size;
+
+        // A group that still has an empty slot has never been full, so no probe
+        // sequence has ever passed through it, and the slot can be reused freely.
+        const size_type offset = index - index % ctrl_group::width;
+        if (ctrl_group(_ctrl + offset).match_empty())
+        {
+            _ctrl[index] = ctrl_empty;
+            ++_growth_left;
+        }
+        else
+        {
+            _ctrl[index] = ctrl_deleted;
+        }
+    }
+
+    void resize(size_type capacity)
+    {
+        ctrl_alloc_t ctrl_alloc(_alloc);
+        ctrl_t* old_ctrl = _ctrl;
+        auto* old_slots = _slots;
+        const size_type old_capacity = _capacity;
+
+        _ctrl = ctrl_traits::allocate(ctrl_alloc, capacity);
+        try
+        {
+            _slots = value_traits::allocate(_alloc, capacity);
+        }
+        catch (...)
+        {
+            ctrl_traits::deallocate(ctrl_alloc, _ctrl, capacity);
+            _ctrl = old_ctrl;
+            throw;
+        }
+
+        std::memset(_ctrl, ctrl_empty, capacity);
+        _capacity = capacity;
+        _growth_left = max_growth(capacity) - _size;
+
+        for (size_type i = 0; i < old_capacity; ++i)
+        {
+            if (!is_full(old_ctrl[i])) continue;
+
+            const std::size_t hash = _hash(Policy::key(old_slots[i]));
+            const size_type index = find_first_non_full(hash);
+            value_traits::construct(_alloc, _slots + index, std::move(old_slots[i]));
+            value_traits::destroy(_alloc, old_slots + i);
+            _ctrl[index] = h2(hash);
+        }
+
+        if (old_capacity)
+        {
+            ctrl_traits::deallocate(ctrl_alloc, old_ctrl, old_capacity);
+            value_traits::deallocate(_alloc, old_slots, old_capacity);
+        }
+    }
+
+    void destroy() noexcept
+    {
+        if (!_capacity) return;
+
+        clear();
+
+        ctrl_alloc_t ctrl_alloc(_alloc);
+        ctrl_traits::deallocate(ctrl_alloc, _ctrl, _capacity);
+        value_traits::deallocate(_alloc, _slots, _capacity);
+
+        _ctrl = nullptr;
+        _slots = nullptr;
+        _capacity = 0;
+        _growth_left = 0;
+    }
+
+  protected:
+    ctrl_t* _ctrl = nullptr;
+    value_type* _slots = nullptr;
+    size_type _capacity = 0;
+    size_type _size = 0;
+    size_type _growth_left = 0;
+
+    Hash _hash;
+    KeyEqual _equal;
+    value_alloc_t _alloc;
+};
+
+template<class T>
+struct name_map_policy
+{
+    using value_type = std::pair<const Name, T>;
+    static const Name& key(const value_type& value) noexcept { return value.first; }
+};
+
+struct name_set_policy
+{
+    using value_type = Name;
+    static const Name& key(const value_type& value) noexcept { return value; }
+};
+} // namespace detail
+
+/**
+ * @brief A flat hash map keyed on Name.
+ *
+ * @details An open addressing hash map storing its values, including the
+ *          16 byte Name key, inline in a single flat array, and probing
+ *          groups of 16 slots at a time using SIMD instructions where
+ *          available. Unlike std::unordered_map, inserting does not allocate
+ *          a node per entry, but inserting or rehashing may move values and
+ *          thus invalidates iterators, pointers and references.
+ *
+ * @tparam T The mapped type.
+ * @tparam Hash The hasher to use. Defaults to std::hash<Name>.
+ * @tparam KeyEqual The key equality comparator to use. Default to std::equal_to<Name>.
+ * @tparam Allocator The allocator type to use. Default is same as std::unordered_map.
+ */
+template<class T,
+         class Hash = std::hash<Name>,
+         class KeyEqual = std::equal_to<Name>,
+         class Allocator = std::allocator<std::pair<const Name, T>>>
+class name_hash_map : public detail::name_hash_table<detail::name_map_policy<T>, Hash, KeyEqual, Allocator>
+{
+    using base_t = detail::name_hash_table<detail::name_map_policy<T>, Hash, KeyEqual, Allocator>;
+
+  public:
+    using mapped_type = T;
+    using typename base_t::const_iterator;
+    using typename base_t::iterator;
+
+    using base_t::base_t;
+    using base_t::insert;
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const Name& key, Args&&... args)
+    {
+        return this->emplace_key(
+          key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const Name& key, M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) result.first->second = std::forward<M>(value);
+        return result;
+    }
+
+    T& operator[](const Name& key) { return try_emplace(key).first->second; }
+
+    T& at(const Name& key)
+    {
+        auto it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("Name not found in quicr::name_hash_map");
+        return it->second;
+    }
+
+    const T& at(const Name& key) const
+    {
+        auto it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("Name not found in quicr::name_hash_map");
+        return it->second;
+    }
+};
+
+/**
+ * @brief A flat hash set of Names.
+ *
+ * @details Same open addressing layout as name_hash_map, storing only the Names.
+ *
+ * @tparam Hash The hasher to use. Defaults to std::hash<Name>.
+ * @tparam KeyEqual The key equality comparator to use. Default to std::equal_to<Name>.
+ * @tparam Allocator The allocator type to use. Default is same as std::unordered_set.
+ */
+template<class Hash = std::hash<Name>, class KeyEqual = std::equal_to<Name>, class Allocator = std::allocator<Name>>
+class name_hash_set : public detail::name_hash_table<detail::name_set_policy, Hash, KeyEqual, Allocator>
+{
+    using base_t = detail::name_hash_table<detail::name_set_policy, Hash, KeyEqual, Allocator>;
+
+  public:
+    using base_t::base_t;
+};
+} // namespace quicr
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "name.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+namespace quicr
+{
+/**
+ * @brief Encodes/Decodes names from/into a list of unsigned integer values,
+ *        according to a distribution of bits only known at runtime.
+ *
+ * @details The runtime counterpart of HexEndec, for layouts read from
+ *          configuration. The distribution is validated once on
+ *          construction, and compiled into a table of the offset and mask of
+ *          every value, so that encoding and decoding neither re-validate it
+ *          nor allocate. Like the values of a HexEndec, the values are laid
+ *          out from the most significant bits of the name.
+ *
+ * @tparam Bits The number of bits of the names.
+ */
+template<std::size_t Bits>
+class BasicNameLayout
+{
+  public:
+    using name_type = BasicName<Bits>;
+
+    /**
+     * @brief Compiles a distribution of bits.
+     *
+     * @param first The first width of the distribution, for the most significant value.
+     * @param last The end of the distribution.
+     * @throws std::invalid_argument If a width is 0 or greater than 64, or the
+     *         widths add up to more than Bits.
+     */
+    template<class InputIt>
+    BasicNameLayout(InputIt first, InputIt last)
+    {
+        std::size_t offset = Bits;
+        for (; first != last; ++first)
+        {
+            const std::size_t width = *first;
+            if (width == 0 || width > sizeof(std::uint64_t) * 8)
+                throw std::invalid_argument("Width of a value must be between 1 and 64 bits");
+            if (width > offset) throw std::invalid_argument("Total bits cannot exceed size of the name");
+
+            offset -= width;
+            const std::uint64_t mask =
+              width == sizeof(std::uint64_t) * 8 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+            _fields.push_back({ mask, static_cast<std::uint16_t>(offset), static_cast<std::uint16_t>(width) });
+        }
+    }
+
+    BasicNameLayout(std::initializer_list<std::uint16_t> distribution)
+      : BasicNameLayout(distribution.begin(), distribution.end())
+    {
+    }
+
+#if __cplusplus >= 202002L
+    BasicNameLayout(std::span<const std::uint16_t> distribution)
+      : BasicNameLayout(distribution.begin(), distribution.end())
+    {
+    }
+#else
+    BasicNameLayout(const std::vector<std::uint16_t>& distribution)
+      : BasicNameLayout(distribution.begin(), distribution.end())
+    {
+    }
+#endif
+
+    /**
+     * @brief The number of values in the distribution.
+     */
+    std::size_t Count() const noexcept { return _fields.size(); }
+
+    /**
+     * @brief The number of bits of a value in the distribution.
+     *
+     * @param index The index of the value.
+     * @throws std::out_of_range If index is outside of the distribution.
+     */
+    std::uint16_t Width(std::size_t index) const { return field(index).width; }
+
+    /**
+     * @brief The position of the least significant bit of a value in the distribution.
+     *
+     * @param index The index of the value.
+     * @throws std::out_of_range If index is outside of the distribution.
+     */
+    std::uint16_t Offset(std::size_t index) const { return field(index).offset; }
+
+    /**
+     * @brief Encodes values into a name, keeping the last bits of each value that fit in its width.
+     *
+     * @param values The values in order of the distribution.
+     * @param count The number of values, which must match the distribution.
+     * @returns The name containing the values.
+     * @throws std::invalid_argument If count does not match the distribution.
+     */
+    name_type EncodeName(const std::uint64_t* values, std::size_t count) const
+    {
+        check_count(count);
+
+        name_type name{};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto& f = _fields[i];
+            name |= (name_type{} | (values[i] & f.mask)) << f.offset;
+        }
+
+        return name;
+    }
+
+    /**
+     * @brief Encodes values into the hexadecimal string of a name.
+     *
+     * @param values The values in order of the distribution.
+     * @param count The number of values, which must match the distribution.
+     * @returns The hexadecimal string of the name containing the values.
+     * @throws std::invalid_argument If count does not match the distribution.
+     */
+    std::string Encode(const std::uint64_t* values, std::size_t count) const { return EncodeName(values, count); }
+
+    /**
+     * @brief Decodes all values of a name.
+     *
+     * @param name The name to decode.
+     * @param values The output values in order of the distribution.
+     * @param count The number of output values, which must match the distribution.
+     * @throws std::invalid_argument If count does not match the distribution.
+     */
+    void Decode(const name_type& name, std::uint64_t* values, std::size_t count) const
+    {
+        check_count(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto& f = _fields[i];
+            values[i] = std::uint64_t(name >> f.offset) & f.mask;
+        }
+    }
+
+    /**
+     * @brief Decodes a single value of a name.
+     *
+     * @param name The name to decode.
+     * @param index The index of the value in the distribution.
+     * @returns The value.
+     * @throws std::out_of_range If index is outside of the distribution.
+     */
+    std::uint64_t Decode(const name_type& name, std::size_t index) const
+    {
+        const auto& f = field(index);
+        return std::uint64_t(name >> f.offset) & f.mask;
+    }
+
+#if __cplusplus >= 202002L
+    name_type EncodeName(std::span<const std::uint64_t> values) const
+    {
+        return EncodeName(values.data(), values.size());
+    }
+
+    std::string Encode(std::span<const std::uint64_t> values) const { return EncodeName(values.data(), values.size()); }
+
+    void Decode(const name_type& name, std::span<std::uint64_t> values) const
+    {
+        Decode(name, values.data(), values.size());
+    }
+#endif
+
+  private:
+    struct field_info
+    {
+        std::uint64_t mask;
+        std::uint16_t offset;
+        std::uint16_t width;
+    };
+
+    const field_info& field(std::size_t index) const
+    {
+        if (index >= _fields.size()) throw std::out_of_range("Index is outside of the distribution of bits");
+        return _fields[index];
+    }
+
+    void check_count(std::size_t count) const
+    {
+        if (count != _fields.size())
+            throw std::invalid_argument("Number of values should match distribution of bits");
+    }
+
+  private:
+    std::vector<field_info> _fields;
+};
+
+/**
+ * @brief A runtime layout of 128 bit Names. See BasicNameLayout.
+ */
+using NameLayout = BasicNameLayout<Name::size_bits>;
+} // namespace quicr
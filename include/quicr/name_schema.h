@@ -0,0 +1,327 @@
+#pragma once
+
+#include "hex_endec.h"
+#include "name.h"
+#include "namespace.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#if __cplusplus >= 202002L
+#include <concepts>
+#endif
+
+namespace quicr
+{
+/**
+ * @brief A named field of a name schema.
+ *
+ * @tparam Tag The type naming the field, usually an empty struct.
+ * @tparam Width The number of bits of the field, at most 64.
+ */
+template<class Tag, std::uint16_t Width>
+struct field
+{
+    static_assert(Width > 0 && Width <= sizeof(std::uint64_t) * 8, "Field width must be between 1 and 64 bits");
+
+    using tag = Tag;
+    static constexpr std::uint16_t width = Width;
+};
+
+/**
+ * @brief What happens when incrementing a field goes past the largest value it can hold.
+ */
+enum class field_overflow
+{
+    /// The field wraps around, leaving the other fields untouched.
+    wrap,
+    /// The field stays at the largest value it can hold.
+    saturate,
+    /// The field wraps around and carries into the more significant fields, like an addition on the name.
+    carry
+};
+
+/**
+ * @brief A compile-time layout of named fields in a name.
+ *
+ * @details Fields are laid out in order from the most significant bits of the
+ *          name, like the distribution of a HexEndec. The offset and mask of
+ *          every field are constants, so each accessor compiles down to a
+ *          shift and a mask of the words holding the field, instead of
+ *          decoding every field of the name.
+ *
+ * For Example:
+ *   struct org; struct app; struct conf; struct media; struct client; struct object;
+ *   using layout = name_schema<field<org, 24>, field<app, 8>, field<conf, 24>,
+ *                              field<media, 8>, field<client, 16>, field<object, 48>>;
+ *
+ *   const std::uint64_t conf_id = layout::get<conf>(name);
+ *   const Name first_object = layout::with<client, object>(name, 1u, 0u);
+ *   layout::increment<object>(name);
+ *
+ * @tparam Bits The number of bits of the name.
+ * @tparam Fields The fields of the schema, each a quicr::field.
+ */
+template<std::size_t Bits, class... Fields>
+class basic_name_schema
+{
+    static_assert(sizeof...(Fields) > 0, "A schema must have at least one field");
+    static_assert((Fields::width + ...) == Bits, "Total bits of the fields must be equal to the bits of the name");
+
+    static constexpr std::uint16_t widths[] = { Fields::width... };
+
+    template<class Tag>
+    static constexpr std::size_t find_index() noexcept
+    {
+        static_assert((std::is_same_v<Tag, typename Fields::tag> + ...) == 1,
+                      "Tag must name exactly one field of the schema");
+
+        constexpr bool matches[] = { std::is_same_v<Tag, typename Fields::tag>... };
+        std::size_t i = 0;
+        while (!matches[i])
+            ++i;
+        return i;
+    }
+
+    static constexpr std::uint16_t field_offset(std::size_t index) noexcept
+    {
+        std::size_t offset = Bits;
+        for (std::size_t i = 0; i <= index; ++i)
+            offset -= widths[i];
+
+        return static_cast<std::uint16_t>(offset);
+    }
+
+    static constexpr std::size_t prefix_length(std::size_t count) noexcept
+    {
+        std::size_t length = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            length += widths[i];
+
+        return length;
+    }
+
+    static constexpr std::uint64_t field_max_value(std::size_t index) noexcept
+    {
+        return widths[index] == sizeof(std::uint64_t) * 8 ? ~std::uint64_t(0)
+                                                          : (std::uint64_t(1) << widths[index]) - 1;
+    }
+
+  public:
+    using name_type = BasicName<Bits>;
+    using namespace_type = BasicNamespace<Bits>;
+
+    /**
+     * The HexEndec with the same distribution of bits as the schema.
+     */
+    using hex_endec = HexEndec<Bits, Fields::width...>;
+
+    /**
+     * The number of fields of the schema.
+     */
+    static constexpr std::size_t size = sizeof...(Fields);
+
+    /**
+     * The index of a field in the schema, where 0 is the most significant field.
+     */
+    template<class Tag>
+    static constexpr std::size_t index = find_index<Tag>();
+
+    /**
+     * The number of bits of a field.
+     */
+    template<class Tag>
+    static constexpr std::uint16_t width = widths[index<Tag>];
+
+    /**
+     * The position of the least significant bit of a field, where 0 is the least significant bit of the name.
+     */
+    template<class Tag>
+    static constexpr std::uint16_t offset = field_offset(index<Tag>);
+
+    /**
+     * The largest value a field can hold.
+     */
+    template<class Tag>
+    static constexpr std::uint64_t max_value = field_max_value(index<Tag>);
+
+    /**
+     * The mask of the bits of a field within the name.
+     */
+    template<class Tag>
+    static constexpr name_type mask = (name_type{} | max_value<Tag>) << offset<Tag>;
+
+    /**
+     * The mask of the bits of all fields less significant than a field.
+     */
+    template<class Tag>
+    static constexpr name_type lower_mask = ~(~name_type{} << offset<Tag>);
+
+    /**
+     * @brief Extracts the value of a field.
+     *
+     * @tparam Tag The tag of the field.
+     * @param name The name to extract from.
+     * @returns The value of the field.
+     */
+    template<class Tag>
+    static constexpr std::uint64_t get(const name_type& name) noexcept
+    {
+        return std::uint64_t(name >> offset<Tag>) & max_value<Tag>;
+    }
+
+    /**
+     * @brief Replaces the value of a field, truncating the value to the width of the field.
+     *
+     * @tparam Tag The tag of the field.
+     * @param name The name to modify.
+     * @param value The new value of the field.
+     */
+    template<class Tag>
+    static constexpr void set(name_type& name, std::uint64_t value) noexcept
+    {
+        name = (name & ~mask<Tag>) | ((name_type{} | (value & max_value<Tag>)) << offset<Tag>);
+    }
+
+    /**
+     * @brief Increments the value of a field, leaving the less significant fields untouched.
+     *
+     * @details The masks are constants of the schema, so a step compiles down
+     *          to an add on the value of the field and a masked merge back into
+     *          the name, or a single add on the name when carrying.
+     *
+     * @tparam Tag The tag of the field.
+     * @tparam Overflow What to do when the field goes past its largest value.
+     * @param name The name to modify.
+     * @param step The amount to increment the field by.
+     * @returns True if the field went past its largest value. When carrying,
+     *          true only if the carry went past the most significant bit of the name.
+     */
+    template<class Tag, field_overflow Overflow = field_overflow::wrap>
+    static constexpr bool increment(name_type& name, std::uint64_t step = 1) noexcept
+    {
+        if constexpr (Overflow == field_overflow::carry)
+        {
+            const name_type previous = name;
+            name += (name_type{} | step) << offset<Tag>;
+            return name < previous;
+        }
+        else
+        {
+            const std::uint64_t value = get<Tag>(name);
+            const bool overflow = step > max_value<Tag> - value;
+            if constexpr (Overflow == field_overflow::saturate)
+            {
+                if (overflow)
+                {
+                    name |= mask<Tag>;
+                    return true;
+                }
+            }
+
+            const std::uint64_t next = (value + step) & max_value<Tag>;
+            name = (name & ~mask<Tag>) | ((name_type{} | next) << offset<Tag>);
+            return overflow;
+        }
+    }
+
+    /**
+     * @brief Clears all fields less significant than a field, such as the
+     *        object of a name after moving to a new group.
+     *
+     * @tparam Tag The tag of the field, which is kept.
+     * @param name The name to modify.
+     */
+    template<class Tag>
+    static constexpr void reset_lower(name_type& name) noexcept
+    {
+        name &= ~lower_mask<Tag>;
+    }
+
+    /**
+     * @brief Builds the namespace of all names starting with the given values
+     *        of the leading fields, without going through a string.
+     *
+     * For Example:
+     *   constexpr Namespace conference = layout::make_namespace(0xA11CEEu, 0x01u, 0xF00001u);
+     *
+     * @param values The values of the first fields of the schema in order,
+     *               each truncated to the width of its field.
+     * @returns The namespace whose length is the sum of the widths of the given fields.
+     */
+#if __cplusplus >= 202002L
+    template<std::unsigned_integral... UInt_ts>
+#else
+    template<typename... UInt_ts, typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
+#endif
+    static constexpr namespace_type make_namespace(UInt_ts... values) noexcept
+    {
+        static_assert(sizeof...(UInt_ts) <= size, "Number of values cannot exceed number of fields");
+
+        constexpr std::size_t length = prefix_length(sizeof...(UInt_ts));
+        name_type name{};
+        [[maybe_unused]] std::size_t i = 0;
+        ((name |= (name_type{} | (values & field_max_value(i))) << field_offset(i), ++i), ...);
+
+        return namespace_type(name, static_cast<typename namespace_type::length_type>(length));
+    }
+
+    /**
+     * @brief The number of leading fields a namespace fully pins, whose bits
+     *        all lie within the length of the namespace.
+     *
+     * @param ns The namespace to inspect.
+     * @returns The number of fields with a single value in the namespace, from the first field.
+     */
+    static constexpr std::size_t pinned_fields(const namespace_type& ns) noexcept
+    {
+        std::size_t count = 0;
+        while (count < size && prefix_length(count + 1) <= ns.length())
+            ++count;
+
+        return count;
+    }
+
+    /**
+     * @brief Checks if a namespace fully pins a field, holding a single value of it.
+     *
+     * @tparam Tag The tag of the field.
+     * @param ns The namespace to inspect.
+     * @returns True if all bits of the field lie within the length of the namespace.
+     */
+    template<class Tag>
+    static constexpr bool pins(const namespace_type& ns) noexcept
+    {
+        return ns.length() >= Bits - offset<Tag>;
+    }
+
+    /**
+     * @brief Creates a copy of a name with the values of some fields replaced.
+     *
+     * @tparam Tags The tags of the fields to replace.
+     * @param name The name to copy.
+     * @param values The new values of the fields, in the order of Tags.
+     * @returns The modified copy of the name.
+     */
+#if __cplusplus >= 202002L
+    template<class... Tags, std::unsigned_integral... UInt_ts>
+#else
+    template<class... Tags,
+             typename... UInt_ts,
+             typename std::enable_if_t<(std::is_unsigned_v<UInt_ts> && ...), bool> = true>
+#endif
+    static constexpr name_type with(name_type name, UInt_ts... values) noexcept
+    {
+        static_assert(sizeof...(Tags) == sizeof...(UInt_ts), "Number of values should match number of fields");
+
+        (set<Tags>(name, values), ...);
+        return name;
+    }
+};
+
+/**
+ * @brief A compile-time layout of named fields in a 128 bit Name. See basic_name_schema.
+ */
+template<class... Fields>
+using name_schema = basic_name_schema<Name::size_bits, Fields...>;
+} // namespace quicr
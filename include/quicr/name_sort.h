@@ -0,0 +1,474 @@
+#pragma once
+
+#include "name.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+namespace quicr
+{
+namespace detail
+{
+constexpr std::size_t radix_digits = sizeof(Name);
+constexpr std::size_t radix_buckets = 256;
+
+/**
+ * Inputs smaller than this are sorted on a single thread, as starting threads would cost more than sorting.
+ */
+constexpr std::size_t parallel_radix_sort_threshold = 1 << 16;
+
+using radix_counts = std::array<std::size_t, radix_buckets>;
+using radix_histogram = std::array<radix_counts, radix_digits>;
+
+/**
+ * @brief Gets the byte of a name at the given digit, where digit 0 is the least significant byte.
+ */
+inline std::uint8_t radix_digit(const Name& name, std::size_t digit) noexcept
+{
+    if (digit < sizeof(std::uint64_t)) return static_cast<std::uint8_t>(std::uint64_t(name) >> (digit * 8));
+    return static_cast<std::uint8_t>(std::uint64_t(name >> 64) >> ((digit - sizeof(std::uint64_t)) * 8));
+}
+
+/**
+ * @brief Counts the occurrences of every byte value at every digit, in a single pass.
+ */
+inline void radix_count(const Name* first, const Name* last, radix_histogram& histogram) noexcept
+{
+    for (auto& counts : histogram)
+        counts.fill(0);
+
+    for (; first != last; ++first)
+    {
+        const std::uint64_t lo = std::uint64_t(*first);
+        const std::uint64_t hi = std::uint64_t(*first >> 64);
+        for (std::size_t d = 0; d < sizeof(std::uint64_t); ++d)
+        {
+            ++histogram[d][(lo >> (d * 8)) & 0xFF];
+            ++histogram[d + sizeof(std::uint64_t)][(hi >> (d * 8)) & 0xFF];
+        }
+    }
+}
+
+/**
+ * @brief Lists the digits that need a pass, skipping every digit where all names have the same byte.
+ */
+inline std::vector<std::size_t> radix_passes(const radix_histogram& histogram, const Name& sample, std::size_t count)
+{
+    std::vector<std::size_t> passes;
+    for (std::size_t d = 0; d < radix_digits; ++d)
+    {
+        if (histogram[d][radix_digit(sample, d)] != count) passes.push_back(d);
+    }
+    return passes;
+}
+
+/**
+ * @brief Runs fn(0), ..., fn(count - 1) each on its own thread, the first one on the calling thread.
+ */
+template<class Fn>
+void parallel_for(std::size_t count, const Fn& fn)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(count - 1);
+    try
+    {
+        for (std::size_t t = 1; t < count; ++t)
+            threads.emplace_back(fn, t);
+        fn(std::size_t(0));
+    }
+    catch (...)
+    {
+        for (auto& thread : threads)
+            thread.join();
+        throw;
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+/**
+ * @brief Scratch space for the keys, and the values if any, of a radix sort.
+ */
+template<class T>
+struct radix_buffers
+{
+    explicit radix_buffers(std::size_t count)
+      : keys{ new Name[count] }, values{ std::is_void_v<T> ? nullptr : new value_type[count] }
+    {
+    }
+
+    using value_type = std::conditional_t<std::is_void_v<T>, char, T>;
+
+    std::unique_ptr<Name[]> keys;
+    std::unique_ptr<value_type[]> values;
+};
+
+template<class T>
+void radix_move_value([[maybe_unused]] T* src,
+                      [[maybe_unused]] std::size_t from,
+                      [[maybe_unused]] T* dst,
+                      [[maybe_unused]] std::size_t to)
+{
+    if constexpr (!std::is_void_v<T>) dst[to] = std::move(src[from]);
+}
+
+/**
+ * @brief Moves the deduplicated buckets [starts[i], ends[i]) of src into out, skipping
+ *        keys equal to the last key moved.
+ * @details out may be src itself, after an even number of passes, in which
+ *          case keys already in place are left alone rather than moved onto
+ *          themselves, which would empty values such as strings.
+ * @returns The number of keys moved.
+ */
+template<class T>
+std::size_t radix_compact(Name* src,
+                          T* src_values,
+                          const std::vector<std::pair<std::size_t, std::size_t>>& segments,
+                          Name* out,
+                          T* out_values)
+{
+    std::size_t size = 0;
+    for (const auto& [start, end] : segments)
+    {
+        for (std::size_t i = start; i < end; ++i)
+        {
+            if (size && out[size - 1] == src[i]) continue;
+
+            if (out + size != src + i)
+            {
+                out[size] = src[i];
+                radix_move_value(src_values, i, out_values, size);
+            }
+            ++size;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Single threaded LSD radix sort, optionally deduplicating during the last pass.
+ * @returns The end of the sorted range.
+ */
+template<class T>
+Name* radix_sort(Name* first, Name* last, T* values, bool unique)
+{
+    const std::size_t count = static_cast<std::size_t>(last - first);
+    if (count < 2) return last;
+
+    radix_histogram histogram;
+    radix_count(first, last, histogram);
+
+    const auto passes = radix_passes(histogram, *first, count);
+    if (passes.empty()) return unique ? first + 1 : last;
+
+    radix_buffers<T> buffers(count);
+
+    Name* src = first;
+    Name* dst = buffers.keys.get();
+    T* src_values = values;
+    T* dst_values = reinterpret_cast<T*>(buffers.values.get());
+
+    for (std::size_t p = 0; p < passes.size(); ++p)
+    {
+        const std::size_t digit = passes[p];
+        const bool dedup = unique && p == passes.size() - 1;
+
+        radix_counts offsets;
+        std::size_t offset = 0;
+        for (std::size_t b = 0; b < radix_buckets; ++b)
+        {
+            offsets[b] = offset;
+            offset += histogram[digit][b];
+        }
+        const radix_counts starts = offsets;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t bucket = radix_digit(src[i], digit);
+            const std::size_t pos = offsets[bucket];
+
+            // Equal keys land next to each other in the same bucket on the last pass.
+            if (dedup && pos != starts[bucket] && dst[pos - 1] == src[i]) continue;
+
+            dst[pos] = src[i];
+            radix_move_value(src_values, i, dst_values, pos);
+            ++offsets[bucket];
+        }
+
+        if (dedup)
+        {
+            std::vector<std::pair<std::size_t, std::size_t>> segments;
+            for (std::size_t b = 0; b < radix_buckets; ++b)
+                segments.emplace_back(starts[b], offsets[b]);
+
+            return first + radix_compact(dst, dst_values, segments, first, values);
+        }
+
+        std::swap(src, dst);
+        std::swap(src_values, dst_values);
+    }
+
+    if (src != first)
+    {
+        std::copy(src, src + count, first);
+        if constexpr (!std::is_void_v<T>) std::move(src_values, src_values + count, values);
+    }
+
+    return last;
+}
+
+/**
+ * @brief Multi-threaded LSD radix sort, optionally deduplicating during the last pass.
+ *
+ * @details The input is split into one chunk per thread. Every pass, each
+ *          thread counts the digit in its chunk, and then scatters its chunk
+ *          into its own region of every bucket, so no two threads write to
+ *          the same location.
+ *
+ * @returns The end of the sorted range.
+ */
+template<class T>
+Name* parallel_radix_sort(Name* first, Name* last, T* values, bool unique, std::size_t thread_count)
+{
+    const std::size_t count = static_cast<std::size_t>(last - first);
+    if (thread_count < 2 || count < parallel_radix_sort_threshold) return radix_sort(first, last, values, unique);
+
+    const std::size_t chunk = (count + thread_count - 1) / thread_count;
+    thread_count = (count + chunk - 1) / chunk;
+    const auto chunk_begin = [&](std::size_t t) { return std::min(t * chunk, count); };
+
+    std::vector<radix_histogram> histograms(thread_count);
+    parallel_for(thread_count, [&](std::size_t t) {
+        radix_count(first + chunk_begin(t), first + chunk_begin(t + 1), histograms[t]);
+    });
+
+    radix_histogram total = histograms[0];
+    for (std::size_t t = 1; t < thread_count; ++t)
+    {
+        for (std::size_t d = 0; d < radix_digits; ++d)
+        {
+            for (std::size_t b = 0; b < radix_buckets; ++b)
+                total[d][b] += histograms[t][d][b];
+        }
+    }
+
+    const auto passes = radix_passes(total, *first, count);
+    if (passes.empty()) return unique ? first + 1 : last;
+
+    radix_buffers<T> buffers(count);
+
+    Name* src = first;
+    Name* dst = buffers.keys.get();
+    T* src_values = values;
+    T* dst_values = reinterpret_cast<T*>(buffers.values.get());
+
+    std::vector<radix_counts> counts(thread_count);
+    std::vector<radix_counts> offsets(thread_count);
+
+    for (std::size_t p = 0; p < passes.size(); ++p)
+    {
+        const std::size_t digit = passes[p];
+        const bool dedup = unique && p == passes.size() - 1;
+
+        if (p == 0)
+        {
+            for (std::size_t t = 0; t < thread_count; ++t)
+                counts[t] = histograms[t][digit];
+        }
+        else
+        {
+            parallel_for(thread_count, [&](std::size_t t) {
+                counts[t].fill(0);
+                for (std::size_t i = chunk_begin(t); i < chunk_begin(t + 1); ++i)
+                    ++counts[t][radix_digit(src[i], digit)];
+            });
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t b = 0; b < radix_buckets; ++b)
+        {
+            for (std::size_t t = 0; t < thread_count; ++t)
+            {
+                offsets[t][b] = offset;
+                offset += counts[t][b];
+            }
+        }
+        const std::vector<radix_counts> starts = offsets;
+
+        parallel_for(thread_count, [&](std::size_t t) {
+            auto& thread_offsets = offsets[t];
+            for (std::size_t i = chunk_begin(t); i < chunk_begin(t + 1); ++i)
+            {
+                const std::size_t bucket = radix_digit(src[i], digit);
+                const std::size_t pos = thread_offsets[bucket];
+                if (dedup && pos != starts[t][bucket] && dst[pos - 1] == src[i]) continue;
+
+                dst[pos] = src[i];
+                radix_move_value(src_values, i, dst_values, pos);
+                ++thread_offsets[bucket];
+            }
+        });
+
+        if (dedup)
+        {
+            // Duplicates can still remain across the regions of different threads.
+            std::vector<std::pair<std::size_t, std::size_t>> segments;
+            for (std::size_t b = 0; b < radix_buckets; ++b)
+            {
+                for (std::size_t t = 0; t < thread_count; ++t)
+                    segments.emplace_back(starts[t][b], offsets[t][b]);
+            }
+
+            return first + radix_compact(dst, dst_values, segments, first, values);
+        }
+
+        std::swap(src, dst);
+        std::swap(src_values, dst_values);
+    }
+
+    if (src != first)
+    {
+        parallel_for(thread_count, [&](std::size_t t) {
+            std::copy(src + chunk_begin(t), src + chunk_begin(t + 1), first + chunk_begin(t));
+            if constexpr (!std::is_void_v<T>)
+                std::move(src_values + chunk_begin(t), src_values + chunk_begin(t + 1), values + chunk_begin(t));
+        });
+    }
+
+    return last;
+}
+
+inline std::size_t default_thread_count() noexcept
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+} // namespace detail
+
+/**
+ * @brief Sorts names in ascending order with an LSD radix sort.
+ *
+ * @details Sorts byte by byte from the least significant byte, skipping every
+ *          byte which is the same for all names (such as a shared namespace
+ *          prefix). Uses a scratch buffer of the same size as the input.
+ *
+ * @param first The beginning of the names to sort.
+ * @param last The end of the names to sort.
+ */
+inline void radix_sort(Name* first, Name* last)
+{
+    detail::radix_sort<void>(first, last, nullptr, false);
+}
+
+/**
+ * @brief Sorts names in ascending order, moving the values along with their keys.
+ *
+ * @details The sort is stable. Values must be default constructible and move assignable.
+ *
+ * @param first The beginning of the names to sort.
+ * @param last The end of the names to sort.
+ * @param values The values, one per name.
+ */
+template<class T>
+void radix_sort(Name* first, Name* last, T* values)
+{
+    detail::radix_sort<T>(first, last, values, false);
+}
+
+/**
+ * @brief Sorts names in ascending order and removes duplicates in the same pass.
+ *
+ * @returns The end of the sorted unique names.
+ */
+inline Name* radix_sort_unique(Name* first, Name* last)
+{
+    return detail::radix_sort<void>(first, last, nullptr, true);
+}
+
+/**
+ * @brief Sorts names in ascending order and removes duplicates, keeping the
+ *        value of the first occurrence of every name.
+ *
+ * @returns The end of the sorted unique names, and of their values.
+ */
+template<class T>
+Name* radix_sort_unique(Name* first, Name* last, T* values)
+{
+    return detail::radix_sort<T>(first, last, values, true);
+}
+
+/**
+ * @brief Sorts names in ascending order with an LSD radix sort split across threads.
+ *
+ * @param first The beginning of the names to sort.
+ * @param last The end of the names to sort.
+ * @param thread_count The number of threads to use. Defaults to the number of cores.
+ */
+inline void parallel_radix_sort(Name* first, Name* last, std::size_t thread_count = detail::default_thread_count())
+{
+    detail::parallel_radix_sort<void>(first, last, nullptr, false, thread_count);
+}
+
+template<class T>
+void parallel_radix_sort(Name* first,
+                         Name* last,
+                         T* values,
+                         std::size_t thread_count = detail::default_thread_count())
+{
+    detail::parallel_radix_sort<T>(first, last, values, false, thread_count);
+}
+
+/**
+ * @brief Sorts names in ascending order and removes duplicates, split across threads.
+ *
+ * @returns The end of the sorted unique names.
+ */
+inline Name* parallel_radix_sort_unique(Name* first,
+                                        Name* last,
+                                        std::size_t thread_count = detail::default_thread_count())
+{
+    return detail::parallel_radix_sort<void>(first, last, nullptr, true, thread_count);
+}
+
+template<class T>
+Name* parallel_radix_sort_unique(Name* first,
+                                 Name* last,
+                                 T* values,
+                                 std::size_t thread_count = detail::default_thread_count())
+{
+    return detail::parallel_radix_sort<T>(first, last, values, true, thread_count);
+}
+
+#if __cplusplus >= 202002L
+inline void radix_sort(std::span<Name> names)
+{
+    radix_sort(names.data(), names.data() + names.size());
+}
+
+inline std::span<Name> radix_sort_unique(std::span<Name> names)
+{
+    return { names.data(), radix_sort_unique(names.data(), names.data() + names.size()) };
+}
+
+inline void parallel_radix_sort(std::span<Name> names, std::size_t thread_count = detail::default_thread_count())
+{
+    parallel_radix_sort(names.data(), names.data() + names.size(), thread_count);
+}
+
+inline std::span<Name> parallel_radix_sort_unique(std::span<Name> names,
+                                                  std::size_t thread_count = detail::default_thread_count())
+{
+    return { names.data(), parallel_radix_sort_unique(names.data(), names.data() + names.size(), thread_count) };
+}
+#endif
+} // namespace quicr
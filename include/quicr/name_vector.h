@@ -0,0 +1,630 @@
+#pragma once
+
+#include "hex_endec.h"
+#include "name.h"
+#include "namespace.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace quicr
+{
+namespace detail
+{
+/**
+ * @brief Allocates memory aligned to the given boundary, such as a cache line.
+ */
+template<class T, std::size_t Alignment>
+struct aligned_allocator
+{
+    using value_type = T;
+
+    template<class U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() noexcept = default;
+
+    template<class U>
+    constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Alignment }));
+    }
+
+    void deallocate(T* ptr, std::size_t) noexcept { ::operator delete(ptr, std::align_val_t{ Alignment }); }
+
+    friend constexpr bool operator==(const aligned_allocator&, const aligned_allocator&) noexcept { return true; }
+    friend constexpr bool operator!=(const aligned_allocator&, const aligned_allocator&) noexcept { return false; }
+};
+} // namespace detail
+
+/**
+ * @brief A sequence of Names stored column-wise, with the high and low 64
+ *        bits of every name in separate aligned arrays.
+ *
+ * @details Bulk operations loop over each column on its own, with no
+ *          branches in the loop body, so that the compiler vectorizes them
+ *          and scans run close to memory bandwidth. Elements are accessed
+ *          through proxy references, the same way as std::vector<bool>, so
+ *          the container still works with the standard algorithms.
+ */
+class name_vector
+{
+    using column_t = std::vector<std::uint64_t, detail::aligned_allocator<std::uint64_t, 64>>;
+
+  public:
+    using value_type = Name;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = Name;
+
+    /**
+     * @brief Proxy reference to a Name split across both columns.
+     */
+    class reference
+    {
+        friend class name_vector;
+
+      public:
+        reference(const reference&) noexcept = default;
+
+        operator Name() const noexcept { return Name(*_hi, *_lo); }
+
+        const reference& operator=(const Name& name) const noexcept
+        {
+            *_hi = std::uint64_t(name >> 64);
+            *_lo = std::uint64_t(name);
+            return *this;
+        }
+
+        const reference& operator=(const reference& other) const noexcept { return *this = Name(other); }
+
+        friend void swap(reference a, reference b) noexcept
+        {
+            std::swap(*a._hi, *b._hi);
+            std::swap(*a._lo, *b._lo);
+        }
+
+        friend bool operator==(const reference& a, const reference& b) noexcept { return Name(a) == Name(b); }
+        friend bool operator!=(const reference& a, const reference& b) noexcept { return Name(a) != Name(b); }
+        friend bool operator<(const reference& a, const reference& b) noexcept { return Name(a) < Name(b); }
+        friend bool operator>(const reference& a, const reference& b) noexcept { return Name(a) > Name(b); }
+        friend bool operator<=(const reference& a, const reference& b) noexcept { return Name(a) <= Name(b); }
+        friend bool operator>=(const reference& a, const reference& b) noexcept { return Name(a) >= Name(b); }
+
+      private:
+        reference(std::uint64_t* hi, std::uint64_t* lo) noexcept : _hi{ hi }, _lo{ lo } {}
+
+        std::uint64_t* _hi;
+        std::uint64_t* _lo;
+    };
+
+    template<bool Const>
+    class basic_iterator
+    {
+        friend class name_vector;
+        using word_ptr = std::conditional_t<Const, const std::uint64_t*, std::uint64_t*>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Name;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<Const, Name, name_vector::reference>;
+
+        basic_iterator() noexcept = default;
+
+        template<bool C = Const, std::enable_if_t<C, bool> = true>
+        basic_iterator(const basic_iterator<false>& other) noexcept : _hi{ other._hi }, _lo{ other._lo }
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            if constexpr (Const)
+                return Name(*_hi, *_lo);
+            else
+                return make_reference(_hi, _lo);
+        }
+
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        basic_iterator& operator++() noexcept { return *this += 1; }
+        basic_iterator& operator--() noexcept { return *this -= 1; }
+
+        basic_iterator operator++(int) noexcept
+        {
+            auto it = *this;
+            ++*this;
+            return it;
+        }
+
+        basic_iterator operator--(int) noexcept
+        {
+            auto it = *this;
+            --*this;
+            return it;
+        }
+
+        basic_iterator& operator+=(difference_type n) noexcept
+        {
+            _hi += n;
+            _lo += n;
+            return *this;
+        }
+
+        basic_iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type n) noexcept { return it += n; }
+        friend basic_iterator operator+(difference_type n, basic_iterator it) noexcept { return it += n; }
+        friend basic_iterator operator-(basic_iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) noexcept
+        {
+            return a._hi - b._hi;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a._hi == b._hi; }
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) noexcept { return a._hi != b._hi; }
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) noexcept { return a._hi < b._hi; }
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) noexcept { return a._hi > b._hi; }
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) noexcept { return a._hi <= b._hi; }
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) noexcept { return a._hi >= b._hi; }
+
+      private:
+        friend class basic_iterator<!Const>;
+
+        basic_iterator(word_ptr hi, word_ptr lo) noexcept : _hi{ hi }, _lo{ lo } {}
+
+        word_ptr _hi = nullptr;
+        word_ptr _lo = nullptr;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    name_vector() = default;
+    explicit name_vector(size_type count, const Name& value = Name(std::uint64_t(0), std::uint64_t(0)))
+      : _hi(count, std::uint64_t(value >> 64)), _lo(count, std::uint64_t(value))
+    {
+    }
+
+    template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    name_vector(InputIt first, InputIt last)
+    {
+        assign(first, last);
+    }
+
+    name_vector(std::initializer_list<Name> names) : name_vector(names.begin(), names.end()) {}
+
+    template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>)
+            reserve(static_cast<size_type>(std::distance(first, last)));
+
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    /*=======================================================================*/
+    // Element Access
+    /*=======================================================================*/
+
+    reference operator[](size_type index) noexcept { return make_reference(&_hi[index], &_lo[index]); }
+    const_reference operator[](size_type index) const noexcept { return Name(_hi[index], _lo[index]); }
+
+    reference at(size_type index)
+    {
+        if (index >= size()) throw std::out_of_range("Index is outside of the name_vector");
+        return (*this)[index];
+    }
+
+    const_reference at(size_type index) const
+    {
+        if (index >= size()) throw std::out_of_range("Index is outside of the name_vector");
+        return (*this)[index];
+    }
+
+    reference front() noexcept { return (*this)[0]; }
+    const_reference front() const noexcept { return (*this)[0]; }
+    reference back() noexcept { return (*this)[size() - 1]; }
+    const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+    /**
+     * @brief The column of the high 64 bits of every name, aligned to 64 bytes.
+     */
+    std::uint64_t* hi_data() noexcept { return _hi.data(); }
+    const std::uint64_t* hi_data() const noexcept { return _hi.data(); }
+
+    /**
+     * @brief The column of the low 64 bits of every name, aligned to 64 bytes.
+     */
+    std::uint64_t* lo_data() noexcept { return _lo.data(); }
+    const std::uint64_t* lo_data() const noexcept { return _lo.data(); }
+
+    /*=======================================================================*/
+    // Iterators
+    /*=======================================================================*/
+
+    iterator begin() noexcept { return iterator(_hi.data(), _lo.data()); }
+    iterator end() noexcept { return begin() + static_cast<difference_type>(size()); }
+    const_iterator begin() const noexcept { return const_iterator(_hi.data(), _lo.data()); }
+    const_iterator end() const noexcept { return begin() + static_cast<difference_type>(size()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /*=======================================================================*/
+    // Capacity
+    /*=======================================================================*/
+
+    bool empty() const noexcept { return _hi.empty(); }
+    size_type size() const noexcept { return _hi.size(); }
+    size_type capacity() const noexcept { return _hi.capacity(); }
+
+    void reserve(size_type count)
+    {
+        _hi.reserve(count);
+        _lo.reserve(count);
+    }
+
+    void shrink_to_fit()
+    {
+        _hi.shrink_to_fit();
+        _lo.shrink_to_fit();
+    }
+
+    /*=======================================================================*/
+    // Modifiers
+    /*=======================================================================*/
+
+    void clear() noexcept
+    {
+        _hi.clear();
+        _lo.clear();
+    }
+
+    void push_back(const Name& name)
+    {
+        _hi.push_back(std::uint64_t(name >> 64));
+        _lo.push_back(std::uint64_t(name));
+    }
+
+    void pop_back() noexcept
+    {
+        _hi.pop_back();
+        _lo.pop_back();
+    }
+
+    void resize(size_type count, const Name& value = Name(std::uint64_t(0), std::uint64_t(0)))
+    {
+        _hi.resize(count, std::uint64_t(value >> 64));
+        _lo.resize(count, std::uint64_t(value));
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        const auto from = first - cbegin();
+        const auto to = last - cbegin();
+        _hi.erase(_hi.begin() + from, _hi.begin() + to);
+        _lo.erase(_lo.begin() + from, _lo.begin() + to);
+        return begin() + from;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    void swap(name_vector& other) noexcept
+    {
+        _hi.swap(other._hi);
+        _lo.swap(other._lo);
+    }
+
+    friend void swap(name_vector& a, name_vector& b) noexcept { a.swap(b); }
+
+    /*=======================================================================*/
+    // Bulk Operations
+    /*=======================================================================*/
+
+    /**
+     * @brief Masks every name with the given bits.
+     * @param mask The mask to AND every name with.
+     */
+    void mask(const Name& mask) noexcept
+    {
+        const std::uint64_t mask_hi = std::uint64_t(mask >> 64);
+        const std::uint64_t mask_lo = std::uint64_t(mask);
+        std::uint64_t* hi = _hi.data();
+        std::uint64_t* lo = _lo.data();
+        for (size_type i = 0; i < size(); ++i)
+        {
+            hi[i] &= mask_hi;
+            lo[i] &= mask_lo;
+        }
+    }
+
+    /**
+     * @brief Shifts every name right by the given number of bits.
+     */
+    void shift_right(std::uint16_t value) noexcept
+    {
+        std::uint64_t* hi = _hi.data();
+        std::uint64_t* lo = _lo.data();
+        const size_type count = size();
+
+        if (value == 0) return;
+
+        if (value >= sizeof(Name) * 8)
+        {
+            std::fill_n(hi, count, 0);
+            std::fill_n(lo, count, 0);
+        }
+        else if (value >= sizeof(std::uint64_t) * 8)
+        {
+            const std::uint16_t shift = value - sizeof(std::uint64_t) * 8;
+            for (size_type i = 0; i < count; ++i)
+            {
+                lo[i] = hi[i] >> shift;
+                hi[i] = 0;
+            }
+        }
+        else
+        {
+            const std::uint16_t carry = sizeof(std::uint64_t) * 8 - value;
+            for (size_type i = 0; i < count; ++i)
+            {
+                lo[i] = (lo[i] >> value) | (hi[i] << carry);
+                hi[i] >>= value;
+            }
+        }
+    }
+
+    /**
+     * @brief Shifts every name left by the given number of bits.
+     */
+    void shift_left(std::uint16_t value) noexcept
+    {
+        std::uint64_t* hi = _hi.data();
+        std::uint64_t* lo = _lo.data();
+        const size_type count = size();
+
+        if (value == 0) return;
+
+        if (value >= sizeof(Name) * 8)
+        {
+            std::fill_n(hi, count, 0);
+            std::fill_n(lo, count, 0);
+        }
+        else if (value >= sizeof(std::uint64_t) * 8)
+        {
+            const std::uint16_t shift = value - sizeof(std::uint64_t) * 8;
+            for (size_type i = 0; i < count; ++i)
+            {
+                hi[i] = lo[i] << shift;
+                lo[i] = 0;
+            }
+        }
+        else
+        {
+            const std::uint16_t carry = sizeof(std::uint64_t) * 8 - value;
+            for (size_type i = 0; i < count; ++i)
+            {
+                hi[i] = (hi[i] << value) | (lo[i] >> carry);
+                lo[i] <<= value;
+            }
+        }
+    }
+
+    /**
+     * @brief Extracts the same range of bits from every name, shifted to the right.
+     *
+     * @param offset The least significant bit of the range. 0 is the least significant bit of the name.
+     * @param width The number of bits to extract, in the range [1, 64].
+     * @param out Where to write the extracted bits, with room for size() values.
+     * @throws std::domain_error If width is not in the range [1, 64].
+     * @throws std::out_of_range If the range extends past the end of a Name.
+     */
+    void extract(std::uint16_t offset, std::uint16_t width, std::uint64_t* out) const
+    {
+        constexpr std::uint16_t word_bits = sizeof(std::uint64_t) * 8;
+
+        if (width == 0 || width > word_bits) throw std::domain_error("Width must be in the range [1, 64]");
+        if (offset + width > sizeof(Name) * 8) throw std::out_of_range("Bits are outside of the range of a Name");
+
+        const std::uint64_t* hi = _hi.data();
+        const std::uint64_t* lo = _lo.data();
+        const size_type count = size();
+        const std::uint64_t field_mask = width == word_bits ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+
+        if (offset >= word_bits)
+        {
+            const std::uint16_t shift = offset - word_bits;
+            for (size_type i = 0; i < count; ++i)
+                out[i] = (hi[i] >> shift) & field_mask;
+        }
+        else if (offset + width <= word_bits)
+        {
+            for (size_type i = 0; i < count; ++i)
+                out[i] = (lo[i] >> offset) & field_mask;
+        }
+        else
+        {
+            const std::uint16_t carry = word_bits - offset;
+            for (size_type i = 0; i < count; ++i)
+                out[i] = ((lo[i] >> offset) | (hi[i] << carry)) & field_mask;
+        }
+    }
+
+    /**
+     * @brief Extracts one field of a HexEndec layout from every name.
+     *
+     * @param layout The layout of the names.
+     * @param field The index of the field to extract, such as the object id.
+     * @param out Where to write the field values, with room for size() values.
+     */
+    template<std::uint16_t Size, std::uint16_t... Dist>
+    void extract(HexEndec<Size, Dist...> layout, std::size_t field, std::uint64_t* out) const
+    {
+        extract(layout.Offset(field), layout.Width(field), out);
+    }
+
+    /**
+     * @brief Checks which names fall within a namespace.
+     *
+     * @param ns The namespace to check against.
+     * @param out Where to write 1 for every name in the namespace and 0 otherwise, with room for size() values.
+     * @returns The number of names in the namespace.
+     */
+    size_type contains(const Namespace& ns, std::uint8_t* out) const noexcept
+    {
+        const Name ns_mask = namespace_mask(ns);
+        const std::uint64_t mask_hi = std::uint64_t(ns_mask >> 64);
+        const std::uint64_t mask_lo = std::uint64_t(ns_mask);
+        const std::uint64_t name_hi = std::uint64_t(ns.name() >> 64);
+        const std::uint64_t name_lo = std::uint64_t(ns.name());
+
+        const std::uint64_t* hi = _hi.data();
+        const std::uint64_t* lo = _lo.data();
+        size_type matches = 0;
+        for (size_type i = 0; i < size(); ++i)
+        {
+            const bool match = ((hi[i] & mask_hi) == name_hi) & ((lo[i] & mask_lo) == name_lo);
+            out[i] = match;
+            matches += match;
+        }
+        return matches;
+    }
+
+    /**
+     * @brief Counts the names that fall within a namespace.
+     */
+    size_type count(const Namespace& ns) const noexcept
+    {
+        const Name ns_mask = namespace_mask(ns);
+        const std::uint64_t mask_hi = std::uint64_t(ns_mask >> 64);
+        const std::uint64_t mask_lo = std::uint64_t(ns_mask);
+        const std::uint64_t name_hi = std::uint64_t(ns.name() >> 64);
+        const std::uint64_t name_lo = std::uint64_t(ns.name());
+
+        const std::uint64_t* hi = _hi.data();
+        const std::uint64_t* lo = _lo.data();
+        size_type matches = 0;
+        for (size_type i = 0; i < size(); ++i)
+            matches += ((hi[i] & mask_hi) == name_hi) & ((lo[i] & mask_lo) == name_lo);
+        return matches;
+    }
+
+    /**
+     * @brief The least name in the vector.
+     * @throws std::out_of_range If the vector is empty.
+     */
+    Name min() const
+    {
+        if (empty()) throw std::out_of_range("Cannot take the min of an empty name_vector");
+
+        // Reduce the high column first, then only the low words sharing that high word.
+        const std::uint64_t* hi = _hi.data();
+        const std::uint64_t* lo = _lo.data();
+        std::uint64_t min_hi = ~std::uint64_t(0);
+        for (size_type i = 0; i < size(); ++i)
+            min_hi = std::min(min_hi, hi[i]);
+
+        std::uint64_t min_lo = ~std::uint64_t(0);
+        for (size_type i = 0; i < size(); ++i)
+            min_lo = std::min(min_lo, hi[i] == min_hi ? lo[i] : ~std::uint64_t(0));
+
+        return Name(min_hi, min_lo);
+    }
+
+    /**
+     * @brief The greatest name in the vector.
+     * @throws std::out_of_range If the vector is empty.
+     */
+    Name max() const
+    {
+        if (empty()) throw std::out_of_range("Cannot take the max of an empty name_vector");
+
+        const std::uint64_t* hi = _hi.data();
+        const std::uint64_t* lo = _lo.data();
+        std::uint64_t max_hi = 0;
+        for (size_type i = 0; i < size(); ++i)
+            max_hi = std::max(max_hi, hi[i]);
+
+        std::uint64_t max_lo = 0;
+        for (size_type i = 0; i < size(); ++i)
+            max_lo = std::max(max_lo, hi[i] == max_hi ? lo[i] : 0);
+
+        return Name(max_hi, max_lo);
+    }
+
+    /**
+     * @brief Collects the names at the given indices.
+     *
+     * @param indices The indices of the names to collect, each less than size().
+     * @param count The number of indices.
+     * @returns The names at the given indices, in the order of the indices.
+     */
+    name_vector gather(const size_type* indices, size_type count) const
+    {
+        name_vector result;
+        result._hi.resize(count);
+        result._lo.resize(count);
+        for (size_type i = 0; i < count; ++i)
+        {
+            result._hi[i] = _hi[indices[i]];
+            result._lo[i] = _lo[indices[i]];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Writes names to the given indices.
+     *
+     * @param indices The indices to write to, each less than size(), one per name.
+     * @param names The names to write, where names[i] is written to indices[i].
+     */
+    void scatter(const size_type* indices, const name_vector& names) noexcept
+    {
+        for (size_type i = 0; i < names.size(); ++i)
+        {
+            _hi[indices[i]] = names._hi[i];
+            _lo[indices[i]] = names._lo[i];
+        }
+    }
+
+    friend bool operator==(const name_vector& a, const name_vector& b) noexcept
+    {
+        return a._hi == b._hi && a._lo == b._lo;
+    }
+
+    friend bool operator!=(const name_vector& a, const name_vector& b) noexcept { return !(a == b); }
+
+  private:
+    static reference make_reference(std::uint64_t* hi, std::uint64_t* lo) noexcept { return reference(hi, lo); }
+
+    /**
+     * @brief A mask of the significant bits of a namespace.
+     */
+    static Name namespace_mask(const Namespace& ns) noexcept
+    {
+        const Name all_bits(~std::uint64_t(0), ~std::uint64_t(0));
+        return all_bits.bits(sizeof(Name) * 8 - ns.length(), ns.length());
+    }
+
+    column_t _hi;
+    column_t _lo;
+};
+} // namespace quicr
@@ -2,6 +2,9 @@
 
 #include <quicr/name.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <istream>
 #include <map>
 #include <optional>
@@ -11,109 +14,86 @@ namespace quicr
 {
 
 /**
- * @brief A prefix for a Name
+ * @brief A prefix for a name of Bits bits.
+ *
+ * @tparam Bits The number of bits of the names in the namespace.
  */
-class Namespace
+template<std::size_t Bits>
+class BasicNamespace
 {
-    /**
-     * @brief Static helper method for converting charater to decimal value at compile-time.
-     * @param dec The decimal character to convert.
-     * @returns The decimal value of the digit character.
-     */
-    static constexpr uint8_t char_to_uint(char dec)
-    {
-        if ('0' <= dec && dec <= '9') return dec - '0';
-        return 0;
-    }
+  public:
+    using name_type = BasicName<Bits>;
 
     /**
-     * @brief Static helper function to convert a string to a decimal value at compile-time.
-     * @param dec The decimal string to convert.
-     * @returns The decimal value of the given string.
+     * The type of the length, wide enough to hold Bits.
      */
-    static constexpr uint8_t str_to_uint(std::string_view dec)
-    {
-        uint8_t value = 0;
-        for (std::size_t i = 0; i < dec.length(); ++i)
-        {
-            value *= 10u;
-            value += char_to_uint(dec[i]);
-        }
-
-        return value;
-    }
+    using length_type = std::conditional_t<(Bits < 256), std::uint8_t, std::uint16_t>;
 
-  public:
-    Namespace() noexcept = default;
-    constexpr Namespace(const Namespace& ns) noexcept = default;
-    Namespace(Namespace&& ns) noexcept = default;
+    BasicNamespace() noexcept = default;
+    constexpr BasicNamespace(const BasicNamespace& ns) noexcept = default;
+    BasicNamespace(BasicNamespace&& ns) noexcept = default;
 
-    constexpr Namespace& operator=(const Namespace& other) noexcept = default;
-    Namespace& operator=(Namespace&& other) noexcept = default;
+    constexpr BasicNamespace& operator=(const BasicNamespace& other) noexcept = default;
+    BasicNamespace& operator=(BasicNamespace&& other) noexcept = default;
 
     /**
-     * @brief Construct a namespace from a Name with significant bits to extract.
+     * @brief Construct a namespace from a name with significant bits to extract.
      * @param name The name that will form the base of the namespace
      * @param sig_bits The amount of bits (from right to left) that are significant.
      */
-    constexpr Namespace(Name name, uint8_t sig_bits) noexcept
-      : _name{ name.bits((sizeof(Name) * 8) - sig_bits, sig_bits) }, _sig_bits{ sig_bits }
+    constexpr BasicNamespace(name_type name, length_type sig_bits) noexcept
+      : _name{ name.bits(Bits - sig_bits, sig_bits) }, _sig_bits{ sig_bits }
     {
     }
 
     /**
      * @brief Constructs a namespace from a string.
      * @param str A string of the form '0xXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX/X'.
+     * @throws std::invalid_argument If the string is not a valid namespace.
      */
 #if __cplusplus >= 202002L
-    constexpr Namespace(std::string_view str)
+    constexpr BasicNamespace(std::string_view str) : _name{}, _sig_bits{ 0 }
     {
-        auto delim_pos = str.find_first_of('/');
-        _name = str.substr(0, delim_pos);
-
-        str.remove_prefix(delim_pos + 1);
-        _sig_bits = str_to_uint(str);
-
-        _name = _name.bits((sizeof(Name) * 8) - _sig_bits, _sig_bits);
+        const char* last = str.data() + str.size();
+        const auto result = from_chars(str.data(), last, *this);
+        if (result.ec != std::errc{} || result.ptr != last) throw_parse_error(result.ec);
     }
 
-    constexpr Namespace& operator=(std::string_view hex) { return *this = Namespace(hex); }
+    constexpr BasicNamespace& operator=(std::string_view hex) { return *this = BasicNamespace(hex); }
 #else
-    constexpr Namespace(const char* str)
-        : _name(""), _sig_bits(0)
+    constexpr BasicNamespace(const char* str) : _name{}, _sig_bits{ 0 }
     {
-        std::size_t delim_pos = 0;
-        std::size_t str_length = utility::str_length(str);
-
-        while (delim_pos < str_length)
-        {
-            if (str[delim_pos] == '/') break;
-            ++delim_pos;
-        }
-
-        char name_str[(sizeof(Name) * 2) + 3] = "";
-
-        utility::str_n_copy(name_str, str, delim_pos);
-        name_str[utility::str_length(name_str) - 1] = '\n';
-
-        _name = name_str;
-        _sig_bits = str_to_uint(str + delim_pos + 1);
-
-        _name = _name.bits((sizeof(Name) * 8) - _sig_bits, _sig_bits);
+        const char* last = str + utility::str_length(str);
+        const auto result = from_chars(str, last, *this);
+        if (result.ec != std::errc{} || result.ptr != last) throw_parse_error(result.ec);
     }
 
-    constexpr Namespace& operator=(const char* hex) { return *this = Namespace(hex); }
+    constexpr BasicNamespace& operator=(const char* hex) { return *this = BasicNamespace(hex); }
 #endif
 
+    /**
+     * @brief Parses a namespace string without throwing.
+     *
+     * @param str A string of the form '0xXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX/X'.
+     * @returns The parsed namespace, with std::errc::invalid_argument if the
+     *          string is malformed, or std::errc::result_out_of_range if the
+     *          name has too many digits or the length exceeds the bits of a name.
+     */
+    static constexpr parse_result<BasicNamespace> parse(std::string_view str) noexcept;
+
+    template<std::size_t B>
+    friend constexpr std::from_chars_result from_chars(const char* first,
+                                                       const char* last,
+                                                       BasicNamespace<B>& value) noexcept;
 
     /**
      * @brief Checks if the given name falls within the namespace.
      * @param name The name to check.
      * @returns True if the given name is contained within the namespace. False otherwise.
      */
-    constexpr bool contains(const Name& name) const noexcept
+    constexpr bool contains(const name_type& name) const noexcept
     {
-        return name.bits((sizeof(Name) * 8) - _sig_bits, _sig_bits) == _name;
+        return name.bits(Bits - _sig_bits, _sig_bits) == _name;
     }
 
     /**
@@ -121,19 +101,42 @@ class Namespace
      * @param prefix The namespace to check.
      * @returns True if the sub-namespace is contained within the current namespace. False otherwise.
      */
-    constexpr bool contains(const Namespace& prefix) const noexcept { return contains(prefix._name); }
+    constexpr bool contains(const BasicNamespace& prefix) const noexcept { return contains(prefix._name); }
+
+    /**
+     * @brief The longest namespace containing both names.
+     * @param a The first name.
+     * @param b The second name.
+     * @returns The namespace of the bits both names have in common.
+     */
+    static constexpr BasicNamespace common_prefix(const name_type& a, const name_type& b) noexcept
+    {
+        return BasicNamespace(a, static_cast<length_type>(common_prefix_length(a, b)));
+    }
+
+    /**
+     * @brief The longest namespace containing both namespaces.
+     * @param a The first namespace.
+     * @param b The second namespace.
+     * @returns The namespace of the bits both namespaces have in common.
+     */
+    static constexpr BasicNamespace common_prefix(const BasicNamespace& a, const BasicNamespace& b) noexcept
+    {
+        const int length = std::min({ common_prefix_length(a._name, b._name), int(a._sig_bits), int(b._sig_bits) });
+        return BasicNamespace(a._name, static_cast<length_type>(length));
+    }
 
     /**
      * @brief The name of the namespace.
      * @returns The masked name of the namespace, with the insignificant bits set to 0.
      */
-    constexpr Name name() const noexcept { return _name; }
+    constexpr name_type name() const noexcept { return _name; }
 
     /**
      * @brief The length of the namespace, corresponding directly to the number of significant bits.
      * @returns The significant bits.
      */
-    constexpr uint8_t length() const noexcept { return _sig_bits; }
+    constexpr length_type length() const noexcept { return _sig_bits; }
 
     /*=======================================================================*/
     // Conversion Operators
@@ -144,50 +147,56 @@ class Namespace
      */
     operator std::string() const { return std::string(_name) + "/" + std::to_string(_sig_bits); }
 
-    constexpr operator Name() const noexcept { return name(); }
+    constexpr operator name_type() const noexcept { return name(); }
 
     /*=======================================================================*/
     // Comparison Operators
     /*=======================================================================*/
 
-    friend constexpr bool operator==(const Namespace& a, const Namespace& b) noexcept
+    friend constexpr bool operator==(const BasicNamespace& a, const BasicNamespace& b) noexcept
     {
         return a._name == b._name && a._sig_bits == b._sig_bits;
     }
 
-    friend constexpr bool operator!=(const Namespace& a, const Namespace& b) noexcept { return !(a == b); }
+    friend constexpr bool operator!=(const BasicNamespace& a, const BasicNamespace& b) noexcept { return !(a == b); }
 
-    friend constexpr bool operator>(const Namespace& a, const Namespace& b) noexcept { return a._name > b._name; }
+    friend constexpr bool operator>(const BasicNamespace& a, const BasicNamespace& b) noexcept
+    {
+        return a._name > b._name;
+    }
 
-    friend constexpr bool operator>(const Namespace& a, const Name& b) noexcept
+    friend constexpr bool operator>(const BasicNamespace& a, const name_type& b) noexcept
     {
-        return a._name > Namespace{ b, a._sig_bits };
+        return a._name > BasicNamespace{ b, a._sig_bits };
     }
 
-    friend constexpr bool operator>(const Name& a, const Namespace& b) noexcept
+    friend constexpr bool operator>(const name_type& a, const BasicNamespace& b) noexcept
     {
-        return Namespace{ a, b._sig_bits } > b._name;
+        return BasicNamespace{ a, b._sig_bits } > b._name;
     }
 
-    friend constexpr bool operator<(const Namespace& a, const Namespace& b) noexcept { return a._name < b._name; }
+    friend constexpr bool operator<(const BasicNamespace& a, const BasicNamespace& b) noexcept
+    {
+        return a._name < b._name;
+    }
 
-    friend constexpr bool operator<(const Namespace& a, const Name& b) noexcept
+    friend constexpr bool operator<(const BasicNamespace& a, const name_type& b) noexcept
     {
-        return a._name < Namespace{ b, a._sig_bits };
+        return a._name < BasicNamespace{ b, a._sig_bits };
     }
 
-    friend constexpr bool operator<(const Name& a, const Namespace& b) noexcept
+    friend constexpr bool operator<(const name_type& a, const BasicNamespace& b) noexcept
     {
-        return Namespace{ a, b._sig_bits } < b._name;
+        return BasicNamespace{ a, b._sig_bits } < b._name;
     }
 
-    friend constexpr bool operator>=(const Namespace& a, const Namespace& b) noexcept { return !(a < b); }
+    friend constexpr bool operator>=(const BasicNamespace& a, const BasicNamespace& b) noexcept { return !(a < b); }
 
-    friend constexpr bool operator>=(const Namespace& a, const Name& b) noexcept { return !(a < b); }
+    friend constexpr bool operator>=(const BasicNamespace& a, const name_type& b) noexcept { return !(a < b); }
 
-    friend constexpr bool operator<=(const Namespace& a, const Namespace& b) noexcept { return !(a > b); }
+    friend constexpr bool operator<=(const BasicNamespace& a, const BasicNamespace& b) noexcept { return !(a > b); }
 
-    friend constexpr bool operator<=(const Name& a, const Namespace& b) noexcept { return !(a > b); }
+    friend constexpr bool operator<=(const name_type& a, const BasicNamespace& b) noexcept { return !(a > b); }
 
     /*=======================================================================*/
     // Stream Operators
@@ -196,12 +205,12 @@ class Namespace
     /**
      * Outputs a string in the form '0xXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX/X'.
      */
-    friend std::ostream& operator<<(std::ostream& os, const Namespace& ns) { return os << std::string(ns); }
+    friend std::ostream& operator<<(std::ostream& os, const BasicNamespace& ns) { return os << std::string(ns); }
 
     /**
      * Inputs a string in the form '0xXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX/X' into Name
      */
-    friend std::istream& operator>>(std::istream& is, Namespace& ns)
+    friend std::istream& operator>>(std::istream& is, BasicNamespace& ns)
     {
         std::string hex;
         is >> hex;
@@ -210,17 +219,83 @@ class Namespace
     }
 
   private:
-    Name _name;
-    uint8_t _sig_bits;
+    [[noreturn]] static void throw_parse_error(std::errc ec)
+    {
+        if (ec == std::errc::result_out_of_range)
+            throw std::invalid_argument("Namespace name or length is out of range of its name type");
+
+        throw std::invalid_argument("Namespace string must be of the form '0xXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX/X'");
+    }
+
+  private:
+    name_type _name;
+    length_type _sig_bits;
 };
 
+/**
+ * @brief A prefix for a Name, the default width of names.
+ */
+using Namespace = BasicNamespace<128>;
+
+/**
+ * @brief Parses a namespace of the form '0xXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX/X' from [first, last),
+ *        in the style of std::from_chars.
+ *
+ * @param first The beginning of the string.
+ * @param last The end of the string.
+ * @param value The parsed namespace. Only modified on success.
+ * @returns The pointer to the first unparsed character, and the error code.
+ */
+template<std::size_t Bits>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, BasicNamespace<Bits>& value) noexcept
+{
+    BasicName<Bits> name{};
+    const auto result = from_chars(first, last, name);
+    if (result.ec != std::errc{}) return result;
+    if (result.ptr == last || *result.ptr != '/') return { result.ptr, std::errc::invalid_argument };
+
+    const char* it = result.ptr + 1;
+    const char* digits = it;
+    unsigned int sig_bits = 0;
+    for (; it != last && '0' <= *it && *it <= '9'; ++it)
+    {
+        if (sig_bits <= Bits) sig_bits = sig_bits * 10 + (*it - '0');
+    }
+
+    if (it == digits) return { it, std::errc::invalid_argument };
+    if (sig_bits > Bits) return { it, std::errc::result_out_of_range };
+
+    value = BasicNamespace<Bits>(name, static_cast<typename BasicNamespace<Bits>::length_type>(sig_bits));
+    return { it, std::errc{} };
+}
+
+template<std::size_t Bits>
+constexpr parse_result<BasicNamespace<Bits>> BasicNamespace<Bits>::parse(std::string_view str) noexcept
+{
+    parse_result<BasicNamespace> result{ BasicNamespace(name_type{}, 0), std::errc{} };
+
+    const char* last = str.data() + str.size();
+    const auto [ptr, ec] = from_chars(str.data(), last, result.value);
+    if (ec != std::errc{})
+        result.ec = ec;
+    else if (ptr != last)
+        result.ec = std::errc::invalid_argument;
+
+    return result;
+}
+
 /**
  * @brief Namespace comparator capable of comparing Namespaces against Names.
+ *
+ * @tparam Comp The STL comparator to wrap.
+ * @tparam Bits The number of bits of the names.
  */
-template<template<typename> class Comp>
-class namespace_comparator_wrapper : Comp<Namespace>
+template<template<typename> class Comp, std::size_t Bits = Name::size_bits>
+class namespace_comparator_wrapper : Comp<BasicNamespace<Bits>>
 {
-    using base = Comp<Namespace>;
+    using base = Comp<BasicNamespace<Bits>>;
+    using namespace_type = BasicNamespace<Bits>;
+    using name_type = BasicName<Bits>;
 
   public:
     using is_transparent = std::true_type;
@@ -236,7 +311,7 @@ class namespace_comparator_wrapper : Comp<Namespace>
      * @param name The name to compare.
      * @returns True if the namespace is less than the name.
      */
-    constexpr bool operator()(const Namespace& ns, const Name& name) const
+    constexpr bool operator()(const namespace_type& ns, const name_type& name) const
     {
         return base::operator()(ns, { name, ns.length() });
     }
@@ -247,39 +322,467 @@ class namespace_comparator_wrapper : Comp<Namespace>
      * @param ns The namespace to compare.
      * @returns True if the name is less than the namespace.
      */
-    constexpr bool operator()(const Name& name, const Namespace& ns) const
+    constexpr bool operator()(const name_type& name, const namespace_type& ns) const
     {
         return base::operator()({ name, ns.length() }, ns);
     }
 };
 
 /**
- * @brief A map keyed on Namespace.
+ * @brief Whether namespace maps are instrumented by default.
  *
- * @details A map keyed by Namespace, and searchable by Name as well. It is thus
- *          possible to use a Name to retrieve an entry. When indexing using Name,
+ * @details Defining QNAME_NAMESPACE_STATS before including this header makes
+ *          every namespace map count its operations, without changing the
+ *          code using them. The definition must be the same in every
+ *          translation unit of a program.
+ */
+#if defined(QNAME_NAMESPACE_STATS)
+inline constexpr bool instrument_namespace_maps = true;
+#else
+inline constexpr bool instrument_namespace_maps = false;
+#endif
+
+/**
+ * @brief A snapshot of the counters of an instrumented namespace map.
+ *
+ * @tparam Bits The number of bits of the names.
+ */
+template<std::size_t Bits>
+struct basic_namespace_map_stats
+{
+    /**
+     * The calls to find and contains, by namespace or by name.
+     */
+    std::uint64_t lookups = 0;
+
+    /**
+     * The lookups that found an entry.
+     */
+    std::uint64_t hits = 0;
+
+    /**
+     * The lookups that found no entry.
+     */
+    std::uint64_t misses = 0;
+
+    /**
+     * The key comparisons made by the lookups, one per level of the tree traversed.
+     */
+    std::uint64_t comparisons = 0;
+
+    /**
+     * The entries added by insert, emplace, try_emplace, insert_or_assign and operator[].
+     */
+    std::uint64_t inserts = 0;
+
+    /**
+     * The entries removed by erase and clear.
+     */
+    std::uint64_t erases = 0;
+
+    /**
+     * The hits by length of the namespace they matched, from 0 to Bits.
+     */
+    std::array<std::uint64_t, Bits + 1> match_lengths{};
+
+    /**
+     * @brief The mean number of comparisons of a lookup, i.e. the mean depth of the lookups.
+     * @returns The comparisons per lookup, or 0 without lookups.
+     */
+    constexpr double comparisons_per_lookup() const noexcept
+    {
+        return lookups == 0 ? 0.0 : double(comparisons) / double(lookups);
+    }
+};
+
+/**
+ * @brief A snapshot of the counters of a namespace_map.
+ */
+using namespace_map_stats = basic_namespace_map_stats<Name::size_bits>;
+
+namespace detail
+{
+/**
+ * The key comparisons made on this thread by instrumented namespace maps.
+ */
+inline thread_local std::uint64_t namespace_comparisons = 0;
+
+/**
+ * @brief A namespace comparator counting its calls in namespace_comparisons.
+ */
+template<template<typename> class Comp, std::size_t Bits>
+class counting_namespace_comparator : public namespace_comparator_wrapper<Comp, Bits>
+{
+    using base = namespace_comparator_wrapper<Comp, Bits>;
+
+  public:
+    template<class Lhs, class Rhs>
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    {
+        ++namespace_comparisons;
+        return base::operator()(lhs, rhs);
+    }
+};
+
+/**
+ * @brief The counters of an instrumented namespace map.
+ *
+ * @details The counters are relaxed atomics, so that lookups sharing a map
+ *          across threads, as they may under a reader lock, count correctly.
+ */
+template<std::size_t Bits, bool Enabled>
+class namespace_map_counters
+{
+  public:
+    namespace_map_counters() noexcept = default;
+    namespace_map_counters(const namespace_map_counters& other) noexcept { *this = other; }
+
+    namespace_map_counters& operator=(const namespace_map_counters& other) noexcept
+    {
+        const auto stats = other.snapshot();
+        _lookups.store(stats.lookups, std::memory_order_relaxed);
+        _hits.store(stats.hits, std::memory_order_relaxed);
+        _comparisons.store(stats.comparisons, std::memory_order_relaxed);
+        _inserts.store(stats.inserts, std::memory_order_relaxed);
+        _erases.store(stats.erases, std::memory_order_relaxed);
+        for (std::size_t i = 0; i <= Bits; ++i)
+            _match_lengths[i].store(stats.match_lengths[i], std::memory_order_relaxed);
+
+        return *this;
+    }
+
+    void lookup(std::uint64_t comparisons) const noexcept
+    {
+        _lookups.fetch_add(1, std::memory_order_relaxed);
+        _comparisons.fetch_add(comparisons, std::memory_order_relaxed);
+    }
+
+    void hit(std::size_t length) const noexcept
+    {
+        _hits.fetch_add(1, std::memory_order_relaxed);
+        _match_lengths[length].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void resize(std::size_t before, std::size_t after) noexcept
+    {
+        if (after > before)
+            _inserts.fetch_add(after - before, std::memory_order_relaxed);
+        else if (after < before)
+            _erases.fetch_add(before - after, std::memory_order_relaxed);
+    }
+
+    basic_namespace_map_stats<Bits> snapshot() const noexcept
+    {
+        basic_namespace_map_stats<Bits> stats;
+        stats.lookups = _lookups.load(std::memory_order_relaxed);
+        stats.hits = _hits.load(std::memory_order_relaxed);
+        stats.misses = stats.lookups - std::min(stats.hits, stats.lookups);
+        stats.comparisons = _comparisons.load(std::memory_order_relaxed);
+        stats.inserts = _inserts.load(std::memory_order_relaxed);
+        stats.erases = _erases.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i <= Bits; ++i)
+            stats.match_lengths[i] = _match_lengths[i].load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    void reset() noexcept { *this = namespace_map_counters{}; }
+
+  private:
+    mutable std::atomic<std::uint64_t> _lookups{ 0 };
+    mutable std::atomic<std::uint64_t> _hits{ 0 };
+    mutable std::atomic<std::uint64_t> _comparisons{ 0 };
+    std::atomic<std::uint64_t> _inserts{ 0 };
+    std::atomic<std::uint64_t> _erases{ 0 };
+    mutable std::array<std::atomic<std::uint64_t>, Bits + 1> _match_lengths{};
+};
+
+/**
+ * @brief The counters of a namespace map that is not instrumented, which are empty and count nothing.
+ */
+template<std::size_t Bits>
+class namespace_map_counters<Bits, false>
+{
+  public:
+    void lookup(std::uint64_t) const noexcept {}
+    void hit(std::size_t) const noexcept {}
+    void resize(std::size_t, std::size_t) noexcept {}
+    basic_namespace_map_stats<Bits> snapshot() const noexcept { return {}; }
+    void reset() noexcept {}
+};
+
+template<template<typename> class Comp, std::size_t Bits, bool Instrumented>
+using namespace_map_comparator = std::conditional_t<Instrumented,
+                                                    counting_namespace_comparator<Comp, Bits>,
+                                                    namespace_comparator_wrapper<Comp, Bits>>;
+} // namespace detail
+
+/**
+ * @brief A map keyed on namespaces of Bits bit names.
+ *
+ * @details A map keyed by namespace, and searchable by name as well. It is thus
+ *          possible to use a name to retrieve an entry. When indexing using a name,
  *          if the given comparator is std::greater, the entry returned is that
- *          which has a key (Namespace) whose value matches Name the longest (i.e.
- *          most specific namespace). When the comparator is std::less, the entry
- *          returned is that which has a key (Namespace) whose value matches Name
- *          the shortest (i.e. the shortest match).
+ *          which has a key (namespace) whose value matches the name the longest
+ *          (i.e. most specific namespace). When the comparator is std::less, the
+ *          entry returned is that which has a key (namespace) whose value matches
+ *          the name the shortest (i.e. the shortest match).
+ *
+ *          An instrumented map counts its lookups, hits, misses, comparisons,
+ *          inserts and erases, and the lengths of the namespaces matched, which
+ *          stats() returns. A map that is not instrumented has the same layout
+ *          and comparator as a plain std::map, and its stats() are all zero.
  *
+ * @tparam Bits The number of bits of the names.
  * @tparam T The value type
  * @tparam Comparator The STL comparator to use inside the namespace_comparator_wrapper. Defaults to std::greater<T>.
  * @tparam Allocator The allocator type to use. Default is same as std::map.
+ * @tparam Instrumented Whether the map counts its operations. Defaults to instrument_namespace_maps.
  */
-template<class T,
+template<std::size_t Bits,
+         class T,
          template<typename> class Comparator = std::greater,
-         class Allocator = std::allocator<std::pair<const Namespace, T>>>
-class namespace_map : public std::map<Namespace, T, namespace_comparator_wrapper<Comparator>, Allocator>
+         class Allocator = std::allocator<std::pair<const BasicNamespace<Bits>, T>>,
+         bool Instrumented = instrument_namespace_maps>
+class basic_namespace_map
+  : public std::map<BasicNamespace<Bits>,
+                    T,
+                    detail::namespace_map_comparator<Comparator, Bits, Instrumented>,
+                    Allocator>
+  , private detail::namespace_map_counters<Bits, Instrumented>
 {
-    using base_t = std::map<Namespace, T, namespace_comparator_wrapper<Comparator>, Allocator>;
+    using base_t =
+      std::map<BasicNamespace<Bits>, T, detail::namespace_map_comparator<Comparator, Bits, Instrumented>, Allocator>;
+    using counters_t = detail::namespace_map_counters<Bits, Instrumented>;
 
   public:
     using base_t::base_t;
+    using typename base_t::const_iterator;
+    using typename base_t::iterator;
+    using typename base_t::insert_return_type;
+    using typename base_t::key_type;
+    using typename base_t::node_type;
+    using typename base_t::value_type;
+    using name_type = BasicName<Bits>;
+    using stats_type = basic_namespace_map_stats<Bits>;
 
-#if __cplusplus < 202002L
-    bool contains(const Namespace& ns) { return this->find(ns) != this->end(); }
-#endif
+    /**
+     * Whether the map counts its operations.
+     */
+    static constexpr bool instrumented = Instrumented;
+
+    iterator find(const key_type& ns) { return counted_find(*this, ns); }
+    const_iterator find(const key_type& ns) const { return counted_find(*this, ns); }
+    iterator find(const name_type& name) { return counted_find(*this, name); }
+    const_iterator find(const name_type& name) const { return counted_find(*this, name); }
+
+    bool contains(const key_type& ns) const { return find(ns) != this->end(); }
+    bool contains(const name_type& name) const { return find(name) != this->end(); }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert(std::move(value));
+    }
+
+    template<class P, std::enable_if_t<std::is_constructible_v<value_type, P&&>, int> = 0>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert(std::forward<P>(value));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert(hint, std::move(value));
+    }
+
+    template<class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        base_t::insert(first, last);
+    }
+
+    void insert(std::initializer_list<value_type> values)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        base_t::insert(values);
+    }
+
+    insert_return_type insert(node_type&& node)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert(std::move(node));
+    }
+
+    iterator insert(const_iterator hint, node_type&& node)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert(hint, std::move(node));
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::emplace(std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::emplace_hint(hint, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& ns, Args&&... args)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::try_emplace(ns, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, const key_type& ns, Args&&... args)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::try_emplace(hint, ns, std::forward<Args>(args)...);
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& ns, M&& value)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert_or_assign(ns, std::forward<M>(value));
+    }
+
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, const key_type& ns, M&& value)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::insert_or_assign(hint, ns, std::forward<M>(value));
+    }
+
+    T& operator[](const key_type& ns) { return try_emplace(ns).first->second; }
+
+    iterator erase(iterator pos)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::erase(pos);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::erase(first, last);
+    }
+
+    std::size_t erase(const key_type& ns)
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        return base_t::erase(ns);
+    }
+
+    void clear() noexcept
+    {
+        [[maybe_unused]] const resize_guard guard(*this);
+        base_t::clear();
+    }
+
+    /**
+     * @brief A snapshot of the counters of the map.
+     * @returns The counters since construction or the last reset_stats, all zero if the map is not instrumented.
+     */
+    stats_type stats() const noexcept { return counters_t::snapshot(); }
+
+    /**
+     * @brief Sets all the counters of the map back to zero.
+     */
+    void reset_stats() noexcept { counters_t::reset(); }
+
+  private:
+    /**
+     * @brief Counts the entries inserted or erased by an operation, when it returns or throws.
+     */
+    class resize_guard
+    {
+      public:
+        explicit resize_guard(basic_namespace_map& map) noexcept : _map{ map }, _before{ map.size() } {}
+        ~resize_guard() { static_cast<counters_t&>(_map).resize(_before, _map.size()); }
+
+      private:
+        basic_namespace_map& _map;
+        std::size_t _before;
+    };
+
+    template<class Map, class Key>
+    static auto counted_find(Map& map, const Key& key)
+    {
+        if constexpr (!Instrumented)
+        {
+            return map.base_t::find(key);
+        }
+        else
+        {
+            const std::uint64_t before = detail::namespace_comparisons;
+            const auto it = map.base_t::find(key);
+            const counters_t& counters = map;
+            counters.lookup(detail::namespace_comparisons - before);
+            if (it != map.end()) counters.hit(it->first.length());
+            return it;
+        }
+    }
 };
+
+/**
+ * @brief A map keyed on Namespace, the default width of names. See basic_namespace_map.
+ */
+template<class T,
+         template<typename> class Comparator = std::greater,
+         class Allocator = std::allocator<std::pair<const Namespace, T>>,
+         bool Instrumented = instrument_namespace_maps>
+using namespace_map = basic_namespace_map<Name::size_bits, T, Comparator, Allocator, Instrumented>;
+
+/**
+ * @brief A namespace_map counting its operations, whether or not QNAME_NAMESPACE_STATS is defined.
+ */
+template<class T, template<typename> class Comparator = std::greater>
+using instrumented_namespace_map =
+  basic_namespace_map<Name::size_bits, T, Comparator, std::allocator<std::pair<const Namespace, T>>, true>;
 } // namespace quicr
+
+namespace std
+{
+/**
+ * @brief Hash specialization for namespaces, mixing the length into the name's hash.
+ */
+template<std::size_t Bits>
+struct hash<quicr::BasicNamespace<Bits>>
+{
+    constexpr std::size_t operator()(const quicr::BasicNamespace<Bits>& ns) const noexcept
+    {
+        const std::uint64_t h = std::hash<quicr::BasicName<Bits>>{}(ns.name());
+        return static_cast<std::size_t>(quicr::utility::mul_fold(h ^ ns.length(), 0x589965cc75374cc3ull));
+    }
+};
+} // namespace std
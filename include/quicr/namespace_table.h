@@ -0,0 +1,406 @@
+#pragma once
+
+#include "name.h"
+#include "name_sort.h"
+#include "namespace.h"
+#include "task_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace quicr
+{
+namespace detail
+{
+/**
+ * The number of children of every node of the search tree over the namespaces of a length.
+ */
+constexpr std::size_t namespace_table_fanout = 16;
+
+/**
+ * The least number of entries given to a task of a bulk build, below which
+ * handing work to another thread costs more than doing it.
+ */
+constexpr std::size_t namespace_table_grain = 1 << 14;
+} // namespace detail
+
+/**
+ * @brief An immutable index of namespaces, bulk built in parallel from an unsorted range.
+ *
+ * @details The namespaces are grouped by length, longest first, and sorted by
+ *          name within each length. Over the names of every length sits a
+ *          static search tree of 16 keys per node, laid out level by level in
+ *          flat arrays, with the first name of every block of 16 names of the
+ *          level below it. Finding a name searches each length in turn, from
+ *          the longest, so the first namespace found is the longest one
+ *          containing the name.
+ *
+ *          Building splits every step across the threads of a task_pool: the
+ *          input is counted and scattered by length in chunks, every length is
+ *          cut into runs which are radix sorted and deduplicated on their own,
+ *          the runs are merged pairwise, and the search trees are filled from
+ *          the sorted names up. When a namespace appears more than once, the
+ *          value of its first occurrence is kept.
+ *
+ * @tparam T The type of the values, which must be default constructible and move assignable.
+ */
+template<class T>
+class namespace_table
+{
+    static_assert(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>,
+                  "Values of a namespace_table must be default constructible and move assignable");
+
+  public:
+    using key_type = Namespace;
+    using mapped_type = T;
+    using value_type = std::pair<Namespace, T>;
+    using size_type = std::size_t;
+    using const_iterator = const value_type*;
+    using iterator = const_iterator;
+
+    namespace_table() = default;
+
+    /**
+     * @brief Builds the table from a range of namespaces and values, on the threads of a pool.
+     * @param first The beginning of the range of pairs of a namespace and its value, in any order.
+     * @param last The end of the range.
+     * @param pool The pool running the build.
+     */
+    template<class InputIt>
+    namespace_table(InputIt first, InputIt last, task_pool& pool)
+    {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, category>)
+        {
+            build(first, static_cast<std::size_t>(std::distance(first, last)), pool);
+        }
+        else
+        {
+            const std::vector<value_type> input(first, last);
+            build(input.begin(), input.size(), pool);
+        }
+    }
+
+    /**
+     * @brief Builds the table from a range of namespaces and values, on a pool of its own.
+     * @param first The beginning of the range of pairs of a namespace and its value, in any order.
+     * @param last The end of the range.
+     * @param thread_count The number of threads to use. Defaults to the number of cores.
+     */
+    template<class InputIt>
+    namespace_table(InputIt first, InputIt last, std::size_t thread_count = detail::default_thread_count())
+    {
+        task_pool pool(thread_count);
+        *this = namespace_table(first, last, pool);
+    }
+
+    /**
+     * @brief Iterates over the entries, by decreasing length and then by increasing name.
+     */
+    const_iterator begin() const noexcept { return _entries.data(); }
+    const_iterator end() const noexcept { return _entries.data() + _entries.size(); }
+
+    size_type size() const noexcept { return _entries.size(); }
+    bool empty() const noexcept { return _entries.empty(); }
+
+    /**
+     * @brief Finds the longest namespace containing a name.
+     * @returns The entry of the namespace, or end() if no namespace contains the name.
+     */
+    const_iterator find(const Name& name) const noexcept
+    {
+        for (const auto& level : _levels)
+        {
+            const std::size_t pos = search(level, Namespace(name, level.length).name());
+            if (pos != npos) return &_entries[pos];
+        }
+
+        return end();
+    }
+
+    /**
+     * @brief Finds a namespace, of exactly the same length.
+     * @returns The entry of the namespace, or end() if it is not in the table.
+     */
+    const_iterator find(const Namespace& ns) const noexcept
+    {
+        for (const auto& level : _levels)
+        {
+            if (level.length != ns.length()) continue;
+
+            const std::size_t pos = search(level, ns.name());
+            return pos == npos ? end() : &_entries[pos];
+        }
+
+        return end();
+    }
+
+    bool contains(const Name& name) const noexcept { return find(name) != end(); }
+    bool contains(const Namespace& ns) const noexcept { return find(ns) != end(); }
+
+  private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    static constexpr std::size_t fanout = detail::namespace_table_fanout;
+    static constexpr std::size_t length_count = Name::size_bits + 1;
+
+    /**
+     * @brief The entries of one length, and the levels of their search tree from the bottom up.
+     */
+    struct level_type
+    {
+        Namespace::length_type length;
+        std::size_t begin;
+        std::size_t size;
+        std::vector<std::vector<Name>> tree;
+    };
+
+    /**
+     * @brief A sorted run of the keys of a length, in one of the two buffers of the build.
+     */
+    struct run_type
+    {
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    std::size_t search(const level_type& level, const Name& key) const noexcept
+    {
+        std::size_t block = 0;
+        for (auto tree = level.tree.rbegin(); tree != level.tree.rend(); ++tree)
+        {
+            const std::size_t first = block * fanout;
+            const std::size_t last = std::min(first + fanout, tree->size());
+
+            std::size_t i = first;
+            while (i < last && !(key < (*tree)[i]))
+                ++i;
+
+            if (i == first) return npos;
+            block = i - 1;
+        }
+
+        const std::size_t first = level.begin + block * fanout;
+        const std::size_t last = level.begin + std::min(block * fanout + fanout, level.size);
+        for (std::size_t i = first; i < last; ++i)
+        {
+            if (_entries[i].first.name() == key) return i;
+        }
+
+        return npos;
+    }
+
+    static std::size_t task_count(std::size_t count, const task_pool& pool) noexcept
+    {
+        return std::max<std::size_t>(1, std::min(count / detail::namespace_table_grain, pool.size() * 4));
+    }
+
+    template<class RandomIt>
+    void build(RandomIt input, std::size_t count, task_pool& pool)
+    {
+        using histogram = std::array<std::size_t, length_count>;
+
+        // Count the namespaces of every length, per chunk of the input.
+        const std::size_t chunks = task_count(count, pool);
+        const auto chunk_begin = [&](std::size_t c) { return count * c / chunks; };
+
+        std::vector<histogram> offsets(chunks);
+        pool.run(chunks, [&](std::size_t c) {
+            auto& counts = offsets[c];
+            counts.fill(0);
+            for (std::size_t i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+                ++counts[Namespace(input[i].first).length()];
+        });
+
+        // Lay out the lengths longest first, with the region of every chunk within each.
+        std::vector<level_type> levels;
+        std::size_t next = 0;
+        for (std::size_t length = length_count; length-- > 0;)
+        {
+            const std::size_t begin = next;
+            for (auto& counts : offsets)
+                next += std::exchange(counts[length], next);
+
+            if (next == begin) continue;
+            levels.push_back({ static_cast<Namespace::length_type>(length), begin, next - begin, {} });
+        }
+
+        std::vector<Name> keys[2] = { std::vector<Name>(count), std::vector<Name>(count) };
+        std::vector<T> values[2] = { std::vector<T>(count), std::vector<T>(count) };
+
+        pool.run(chunks, [&](std::size_t c) {
+            auto& positions = offsets[c];
+            for (std::size_t i = chunk_begin(c); i < chunk_begin(c + 1); ++i)
+            {
+                const Namespace ns(input[i].first);
+                const std::size_t pos = positions[ns.length()]++;
+                keys[0][pos] = ns.name();
+                values[0][pos] = input[i].second;
+            }
+        });
+
+        // Sort and deduplicate runs of every length on their own.
+        std::vector<std::vector<run_type>> runs(levels.size());
+        std::vector<std::pair<std::size_t, std::size_t>> tasks;
+        for (std::size_t l = 0; l < levels.size(); ++l)
+        {
+            const std::size_t n = task_count(levels[l].size, pool);
+            for (std::size_t r = 0; r < n; ++r)
+            {
+                const auto& level = levels[l];
+                runs[l].push_back({ level.begin + level.size * r / n, level.begin + level.size * (r + 1) / n });
+                tasks.emplace_back(l, r);
+            }
+        }
+
+        pool.run(tasks.size(), [&](std::size_t t) {
+            auto& run = runs[tasks[t].first][tasks[t].second];
+            Name* first = keys[0].data() + run.begin;
+            run.end = static_cast<std::size_t>(
+              radix_sort_unique(first, keys[0].data() + run.end, values[0].data() + run.begin) - keys[0].data());
+        });
+
+        // Merge the runs of every length pairwise, alternating between the two buffers.
+        std::vector<unsigned char> buffer(levels.size(), 0);
+        for (;;)
+        {
+            tasks.clear();
+            for (std::size_t l = 0; l < levels.size(); ++l)
+            {
+                for (std::size_t r = 0; runs[l].size() > 1 && r < runs[l].size(); r += 2)
+                    tasks.emplace_back(l, r);
+            }
+            if (tasks.empty()) break;
+
+            pool.run(tasks.size(), [&](std::size_t t) {
+                const auto [l, r] = tasks[t];
+                const unsigned char src = buffer[l];
+                auto& left = runs[l][r];
+                const run_type right = r + 1 < runs[l].size() ? runs[l][r + 1] : run_type{ left.end, left.end };
+                left.end = merge_unique(keys[src], values[src], left, right, keys[1 - src], values[1 - src]);
+            });
+
+            for (std::size_t l = 0; l < levels.size(); ++l)
+            {
+                if (runs[l].size() < 2) continue;
+
+                std::vector<run_type> merged;
+                for (std::size_t r = 0; r < runs[l].size(); r += 2)
+                    merged.push_back(runs[l][r]);
+
+                runs[l] = std::move(merged);
+                buffer[l] ^= 1;
+            }
+        }
+
+        // Move the sorted entries of every length into place.
+        std::size_t total = 0;
+        std::vector<std::size_t> sources(levels.size());
+        for (std::size_t l = 0; l < levels.size(); ++l)
+        {
+            sources[l] = runs[l].front().begin;
+            levels[l].begin = total;
+            levels[l].size = runs[l].front().end - runs[l].front().begin;
+            total += levels[l].size;
+        }
+
+        _entries.resize(total);
+        tasks.clear();
+        for (std::size_t l = 0; l < levels.size(); ++l)
+        {
+            const std::size_t n = task_count(levels[l].size, pool);
+            for (std::size_t r = 0; r < n; ++r)
+                tasks.emplace_back(l, r);
+        }
+
+        pool.run(tasks.size(), [&](std::size_t t) {
+            const auto [l, r] = tasks[t];
+            const auto& level = levels[l];
+            const std::size_t n = task_count(level.size, pool);
+            const auto& src_keys = keys[buffer[l]];
+            auto& src_values = values[buffer[l]];
+
+            for (std::size_t i = level.size * r / n; i < level.size * (r + 1) / n; ++i)
+            {
+                auto& entry = _entries[level.begin + i];
+                entry.first = Namespace(src_keys[sources[l] + i], level.length);
+                entry.second = std::move(src_values[sources[l] + i]);
+            }
+        });
+
+        // Fill the search trees, whose every level holds the name of every 16^(k + 1)th entry.
+        tasks.clear();
+        for (std::size_t l = 0; l < levels.size(); ++l)
+        {
+            for (std::size_t size = levels[l].size, k = 0; size > fanout; ++k)
+            {
+                size = (size + fanout - 1) / fanout;
+                levels[l].tree.emplace_back(size);
+                tasks.emplace_back(l, k);
+            }
+        }
+
+        pool.run(tasks.size(), [&](std::size_t t) {
+            const auto [l, k] = tasks[t];
+            auto& tree = levels[l].tree[k];
+
+            std::size_t stride = fanout;
+            for (std::size_t i = 0; i < k; ++i)
+                stride *= fanout;
+
+            for (std::size_t j = 0; j < tree.size(); ++j)
+                tree[j] = _entries[levels[l].begin + j * stride].first.name();
+        });
+
+        _levels = std::move(levels);
+    }
+
+    /**
+     * @brief Merges two adjacent sorted runs into the other buffer, at the start of the first, keeping the first of
+     *        equal names.
+     * @returns The end of the merged run.
+     */
+    static std::size_t merge_unique(const std::vector<Name>& keys,
+                                    std::vector<T>& values,
+                                    const run_type& left,
+                                    const run_type& right,
+                                    std::vector<Name>& out_keys,
+                                    std::vector<T>& out_values)
+    {
+        std::size_t i = left.begin;
+        std::size_t j = right.begin;
+        std::size_t out = left.begin;
+        const auto take = [&](std::size_t& from) {
+            out_keys[out] = keys[from];
+            out_values[out++] = std::move(values[from++]);
+        };
+
+        while (i < left.end && j < right.end)
+        {
+            if (keys[j] < keys[i])
+                take(j);
+            else if (keys[i] < keys[j])
+                take(i);
+            else
+            {
+                take(i);
+                ++j;
+            }
+        }
+
+        while (i < left.end)
+            take(i);
+        while (j < right.end)
+            take(j);
+
+        return out;
+    }
+
+    std::vector<value_type> _entries;
+    std::vector<level_type> _levels;
+};
+} // namespace quicr
@@ -0,0 +1,311 @@
+#pragma once
+
+#include "name.h"
+#include "spsc_ring.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace quicr
+{
+/**
+ * @brief A name to route, with an opaque handle to its payload.
+ */
+template<class Handle>
+struct routed_name
+{
+    Name name;
+    Handle handle{};
+};
+
+/**
+ * @brief The counters of a worker of a routing_stage.
+ */
+struct routing_stats
+{
+    /**
+     * The names pushed to the ring of their destination.
+     */
+    std::uint64_t routed = 0;
+
+    /**
+     * The names not found in the index, or mapped to no destination, which are
+     * handed back to the worker rather than routed.
+     */
+    std::uint64_t unrouted = 0;
+
+    /**
+     * The batches taken from the input ring.
+     */
+    std::uint64_t batches = 0;
+
+    /**
+     * The times routing stopped on a full output ring, holding back the input ring.
+     */
+    std::uint64_t stalls = 0;
+};
+
+/**
+ * @brief Routes names from per-worker input rings to per-destination output rings, looking them up in a shared index.
+ *
+ * @details Each worker has its own input ring, fed by a single producer, and
+ *          its own output ring for every destination, drained by the single
+ *          consumer of that destination, so no ring is shared by two producers
+ *          or two consumers and no lock is taken. A worker takes a batch of
+ *          names from its input ring, looks them all up in the index, then
+ *          pushes each to the ring of its destination.
+ *
+ *          When an output ring is full, the worker keeps the rest of its batch
+ *          and resumes with it on its next call, without taking more names, so
+ *          that its input ring fills up and a full destination holds back the
+ *          producers upstream rather than losing names.
+ *
+ *          Names not found in the index, or mapped to no destination, are
+ *          handed back to the worker through the function given to
+ *          process, so that the payloads their handles refer to can be
+ *          released.
+ *
+ *          Larger batches amortize the cost of publishing to the rings, while
+ *          smaller ones deliver the first names of a burst sooner. The batch
+ *          size can be tuned while workers run, and applies from their next
+ *          batch.
+ *
+ * @tparam Index The type of the shared index, such as a namespace_map, whose
+ *               find(name) returns an iterator to an entry whose mapped value
+ *               is the number of the destination. The index must not change
+ *               while workers run.
+ * @tparam Handle The type of the handle to the payload of a name.
+ */
+template<class Index, class Handle = std::uintptr_t>
+class routing_stage
+{
+  public:
+    using index_type = Index;
+    using handle_type = Handle;
+    using value_type = routed_name<Handle>;
+    using ring_type = spsc_ring<value_type>;
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /**
+     * @param index The index mapping names to destinations, which must outlive the stage.
+     * @param workers The number of workers, each with its own input ring.
+     * @param destinations The number of destinations, numbered from 0.
+     * @param ring_capacity The minimum capacity of every input and output ring.
+     * @param batch_size The maximum number of names a worker takes from its input ring at once.
+     * @throws std::invalid_argument If any count is 0.
+     */
+    routing_stage(const Index& index,
+                  std::size_t workers,
+                  std::size_t destinations,
+                  std::size_t ring_capacity = 1024,
+                  std::size_t batch_size = 32)
+      : _index(index), _destinations(destinations), _batch_size(batch_size)
+    {
+        if (workers == 0 || destinations == 0)
+            throw std::invalid_argument("routing_stage needs at least one worker and one destination");
+        if (batch_size == 0) throw std::invalid_argument("routing_stage batch size must not be 0");
+
+        _workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i)
+            _workers.push_back(std::make_unique<worker_state>(ring_capacity));
+
+        _outputs.reserve(workers * destinations);
+        for (std::size_t i = 0; i < workers * destinations; ++i)
+            _outputs.push_back(std::make_unique<ring_type>(ring_capacity));
+    }
+
+    std::size_t workers() const noexcept { return _workers.size(); }
+
+    std::size_t destinations() const noexcept { return _destinations; }
+
+    /**
+     * @brief The input ring of a worker, into which its producer pushes names to route.
+     */
+    ring_type& input(std::size_t worker) noexcept { return _workers[worker]->input; }
+
+    /**
+     * @brief The output ring from a worker to a destination.
+     */
+    ring_type& output(std::size_t worker, std::size_t destination) noexcept
+    {
+        return *_outputs[worker * _destinations + destination];
+    }
+
+    std::size_t batch_size() const noexcept { return _batch_size.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Changes the batch size, from the next batch of every worker.
+     * @throws std::invalid_argument If the batch size is 0.
+     */
+    void set_batch_size(std::size_t batch_size)
+    {
+        if (batch_size == 0) throw std::invalid_argument("routing_stage batch size must not be 0");
+        _batch_size.store(batch_size, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Routes a batch of names of a worker, from the thread of that worker.
+     *
+     * @details Resumes the batch held back by a full output ring if any, or
+     *          takes a new batch from the input ring otherwise.
+     *
+     * @param worker The worker.
+     * @param unrouted The function called with a reference to each routed_name
+     *                 not found in the index or mapped to no destination, such
+     *                 as to release the payload of its handle.
+     * @returns The number of names routed or handed to unrouted, 0 if the
+     *          input ring is empty or the first output ring is still full.
+     */
+    template<class Unrouted>
+    std::size_t process(std::size_t worker, Unrouted&& unrouted)
+    {
+        auto& state = *_workers[worker];
+        if (state.position == state.size && !take_batch(state)) return 0;
+
+        std::uint64_t routed = 0;
+        std::uint64_t rejected = 0;
+        const std::size_t first = state.position;
+        for (; state.position < state.size; ++state.position)
+        {
+            const std::size_t destination = state.destinations[state.position];
+            if (destination == npos)
+            {
+                unrouted(state.batch[state.position]);
+                ++rejected;
+                continue;
+            }
+
+            if (!output(worker, destination).try_push(state.batch[state.position]))
+            {
+                bump(state.stalls, 1);
+                break;
+            }
+            ++routed;
+        }
+
+        bump(state.routed, routed);
+        bump(state.unrouted, rejected);
+        return state.position - first;
+    }
+
+    /**
+     * @brief Routes a batch of names of a worker, dropping the names that are
+     *        not routed, for handles that own nothing.
+     */
+    std::size_t process(std::size_t worker)
+    {
+        return process(worker, [](value_type&) {});
+    }
+
+    /**
+     * @brief The number of names of a worker held back by a full output ring, from the thread of that worker.
+     */
+    std::size_t pending(std::size_t worker) const noexcept
+    {
+        const auto& state = *_workers[worker];
+        return state.size - state.position;
+    }
+
+    /**
+     * @brief Hands the names routed to a destination by every worker to a function, from the thread of the destination.
+     *
+     * @param destination The destination.
+     * @param fn The function called with a reference to each routed_name.
+     * @param max_per_worker The maximum number of names taken from the ring of each worker.
+     * @returns The number of names handed to the function.
+     */
+    template<class Fn>
+    std::size_t drain(std::size_t destination, Fn&& fn, std::size_t max_per_worker = npos)
+    {
+        std::size_t count = 0;
+        for (std::size_t worker = 0; worker < _workers.size(); ++worker)
+            count += output(worker, destination).consume(fn, max_per_worker);
+
+        return count;
+    }
+
+    /**
+     * @brief The counters of a worker, which may be read from any thread.
+     */
+    routing_stats stats(std::size_t worker) const noexcept
+    {
+        const auto& state = *_workers[worker];
+        return { state.routed.load(std::memory_order_relaxed),
+                 state.unrouted.load(std::memory_order_relaxed),
+                 state.batches.load(std::memory_order_relaxed),
+                 state.stalls.load(std::memory_order_relaxed) };
+    }
+
+  private:
+    /**
+     * @brief The rings and pending batch of a worker, aligned so that workers do not share cache lines.
+     */
+    struct alignas(64) worker_state
+    {
+        explicit worker_state(std::size_t ring_capacity) : input(ring_capacity) {}
+
+        ring_type input;
+        std::vector<value_type> batch;
+        std::vector<std::size_t> destinations;
+        std::size_t position = 0;
+        std::size_t size = 0;
+
+        std::atomic<std::uint64_t> routed{ 0 };
+        std::atomic<std::uint64_t> unrouted{ 0 };
+        std::atomic<std::uint64_t> batches{ 0 };
+        std::atomic<std::uint64_t> stalls{ 0 };
+    };
+
+    /**
+     * @brief Adds to a counter only its worker writes, without a read-modify-write.
+     */
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t n) noexcept
+    {
+        if (n != 0) counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    bool take_batch(worker_state& state)
+    {
+        const std::size_t batch_size = _batch_size.load(std::memory_order_relaxed);
+        if (state.batch.size() < batch_size)
+        {
+            state.batch.resize(batch_size);
+            state.destinations.resize(batch_size);
+        }
+
+        std::size_t size = 0;
+        state.input.consume([&](value_type& value) { state.batch[size++] = std::move(value); }, batch_size);
+        if (size == 0) return false;
+
+        // Every name of the batch is looked up before any is pushed, so that the lookups do not wait on each other.
+        for (std::size_t i = 0; i < size; ++i)
+            state.destinations[i] = destination_of(state.batch[i].name);
+
+        state.position = 0;
+        state.size = size;
+        bump(state.batches, 1);
+        return true;
+    }
+
+    std::size_t destination_of(const Name& name) const
+    {
+        const auto it = _index.find(name);
+        if (it == _index.end()) return npos;
+
+        const auto destination = static_cast<std::size_t>(it->second);
+        return destination < _destinations ? destination : npos;
+    }
+
+    const Index& _index;
+    const std::size_t _destinations;
+    std::atomic<std::size_t> _batch_size;
+    std::vector<std::unique_ptr<worker_state>> _workers;
+    std::vector<std::unique_ptr<ring_type>> _outputs;
+};
+} // namespace quicr
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace quicr
+{
+/**
+ * @brief A bounded lock-free queue between one producer thread and one consumer thread.
+ *
+ * @details The capacity is rounded up to a power of two. The producer and the
+ *          consumer each own one index, on its own cache line, and keep a copy
+ *          of the index of the other side, which they only load again once
+ *          the copy says the ring is full or empty. Pushing and popping in
+ *          batches publishes a whole batch with a single release store.
+ *
+ * @tparam T The type of the elements, which must be default constructible.
+ */
+template<class T>
+class spsc_ring
+{
+    static_assert(std::is_default_constructible_v<T>, "Elements of an spsc_ring must be default constructible");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * @param capacity The minimum number of elements the ring holds.
+     * @throws std::invalid_argument If the capacity is 0.
+     */
+    explicit spsc_ring(size_type capacity) : _mask(round_up(capacity) - 1), _slots(new T[_mask + 1])
+    {
+        if (capacity == 0) throw std::invalid_argument("spsc_ring capacity must not be 0");
+    }
+
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+    /**
+     * @brief Pushes an element, from the producer thread.
+     * @returns False if the ring is full.
+     */
+    template<class U>
+    bool try_push(U&& value)
+    {
+        const size_type tail = _producer.index.load(std::memory_order_relaxed);
+        if (tail - _producer.cached >= capacity())
+        {
+            _producer.cached = _consumer.index.load(std::memory_order_acquire);
+            if (tail - _producer.cached >= capacity()) return false;
+        }
+
+        _slots[tail & _mask] = std::forward<U>(value);
+        _producer.index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pushes as many elements of a range as fit, from the producer thread.
+     * @param first The first element to push.
+     * @param count The number of elements to push.
+     * @returns The number of elements pushed, from the front of the range.
+     */
+    template<class InputIt>
+    size_type try_push(InputIt first, size_type count)
+    {
+        const size_type tail = _producer.index.load(std::memory_order_relaxed);
+        if (capacity() - (tail - _producer.cached) < count)
+            _producer.cached = _consumer.index.load(std::memory_order_acquire);
+
+        const size_type n = std::min(count, capacity() - (tail - _producer.cached));
+        for (size_type i = 0; i < n; ++i, ++first)
+            _slots[(tail + i) & _mask] = *first;
+
+        if (n != 0) _producer.index.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief Pops an element, from the consumer thread.
+     * @returns False if the ring is empty.
+     */
+    bool try_pop(T& value)
+    {
+        return consume([&](T& element) { value = std::move(element); }, 1) == 1;
+    }
+
+    /**
+     * @brief Hands elements to a function in place, then pops them, from the consumer thread.
+     * @param fn The function called with a reference to each element, in order.
+     * @param max The maximum number of elements to pop.
+     * @returns The number of elements popped.
+     */
+    template<class Fn>
+    size_type consume(Fn&& fn, size_type max = static_cast<size_type>(-1))
+    {
+        const size_type head = _consumer.index.load(std::memory_order_relaxed);
+        if (_consumer.cached - head < max) _consumer.cached = _producer.index.load(std::memory_order_acquire);
+
+        const size_type n = std::min(max, _consumer.cached - head);
+        for (size_type i = 0; i < n; ++i)
+            fn(_slots[(head + i) & _mask]);
+
+        if (n != 0) _consumer.index.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief The number of elements in the ring, which is only a snapshot while the other side runs.
+     */
+    size_type size() const noexcept
+    {
+        // The head is loaded first, so that it cannot have passed the tail loaded after it.
+        const size_type head = _consumer.index.load(std::memory_order_acquire);
+        return _producer.index.load(std::memory_order_acquire) - head;
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+
+    size_type capacity() const noexcept { return _mask + 1; }
+
+  private:
+    static size_type round_up(size_type capacity) noexcept
+    {
+        size_type rounded = 1;
+        while (rounded < capacity)
+            rounded <<= 1;
+
+        return rounded;
+    }
+
+    /**
+     * The index one side writes, and its copy of the index of the other side.
+     */
+    struct alignas(64) side
+    {
+        std::atomic<size_type> index{ 0 };
+        size_type cached = 0;
+    };
+
+    const size_type _mask;
+    const std::unique_ptr<T[]> _slots;
+
+    side _producer;
+    side _consumer;
+};
+} // namespace quicr
@@ -0,0 +1,290 @@
+#pragma once
+
+#include "name.h"
+#include "name_hash_map.h"
+#include "namespace.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace quicr
+{
+/**
+ * @brief An index of the subscribers of namespaces, matching names to the subscribers of every namespace
+ *        containing them.
+ *
+ * @details The subscribers of each namespace are kept as a sorted array of
+ *          ids. To match a name, the namespaces are probed by length, from the
+ *          longest length subscribed to, in a hash table per length. The first
+ *          namespace found is the longest containing the name, and every other
+ *          namespace containing the name contains it as well, so the union of
+ *          the subscribers of a name is that of its longest namespace. That
+ *          union is merged once and cached with the namespace, and is only
+ *          merged again after a subscription to the namespace, or to one
+ *          containing it, changes. Matching a name whose union is cached does
+ *          not allocate.
+ *
+ *          Matching updates the cache, so calls to match must not run
+ *          concurrently with each other, nor with changes to subscriptions.
+ *
+ * @tparam Id The integral type of the ids of subscribers.
+ */
+template<class Id = std::uint32_t>
+class subscriber_index
+{
+    static_assert(std::is_integral_v<Id>, "Subscriber ids must be integers");
+
+  public:
+    using subscriber_type = Id;
+
+    /**
+     * @brief A set of subscribers, in increasing order of id.
+     */
+    using subscriber_set = std::vector<Id>;
+
+    subscriber_index() = default;
+    subscriber_index(subscriber_index&&) = default;
+    subscriber_index& operator=(subscriber_index&&) = default;
+
+    subscriber_index(const subscriber_index& other) : _entries(other._entries), _subscriptions(other._subscriptions)
+    {
+        for (auto& [ns, entry] : _entries)
+            level(ns.length()).try_emplace(ns.name(), &entry);
+    }
+
+    subscriber_index& operator=(const subscriber_index& other)
+    {
+        if (this != &other) *this = subscriber_index(other);
+        return *this;
+    }
+
+    /**
+     * @brief Subscribes a subscriber to a namespace.
+     * @param ns The namespace to subscribe to.
+     * @param id The subscriber.
+     * @returns True if the subscriber was not already subscribed to the namespace.
+     */
+    bool subscribe(const Namespace& ns, Id id)
+    {
+        auto [it, created] = _entries.try_emplace(ns);
+        auto& subscribers = it->second.subscribers;
+        const auto pos = std::lower_bound(subscribers.begin(), subscribers.end(), id);
+        if (pos != subscribers.end() && *pos == id) return false;
+
+        subscribers.insert(pos, id);
+        ++_subscriptions;
+
+        if (created) level(ns.length()).try_emplace(ns.name(), &it->second);
+        invalidate(ns);
+        return true;
+    }
+
+    /**
+     * @brief Unsubscribes a subscriber from a namespace.
+     * @param ns The namespace to unsubscribe from.
+     * @param id The subscriber.
+     * @returns True if the subscriber was subscribed to the namespace.
+     */
+    bool unsubscribe(const Namespace& ns, Id id)
+    {
+        const auto it = _entries.find(ns);
+        if (it == _entries.end()) return false;
+
+        auto& subscribers = it->second.subscribers;
+        const auto pos = std::lower_bound(subscribers.begin(), subscribers.end(), id);
+        if (pos == subscribers.end() || *pos != id) return false;
+
+        subscribers.erase(pos);
+        --_subscriptions;
+
+        if (subscribers.empty()) erase(it);
+        invalidate(ns);
+        return true;
+    }
+
+    /**
+     * @brief Unsubscribes a subscriber from every namespace, such as when it disconnects.
+     * @param id The subscriber.
+     * @returns The number of namespaces the subscriber was unsubscribed from.
+     */
+    std::size_t unsubscribe(Id id)
+    {
+        std::size_t count = 0;
+        for (auto it = _entries.begin(); it != _entries.end();)
+        {
+            auto& subscribers = it->second.subscribers;
+            const auto pos = std::lower_bound(subscribers.begin(), subscribers.end(), id);
+            if (pos == subscribers.end() || *pos != id)
+            {
+                ++it;
+                continue;
+            }
+
+            subscribers.erase(pos);
+            ++count;
+
+            const Namespace ns = it->first;
+            if (subscribers.empty())
+                erase(it++);
+            else
+                ++it;
+
+            invalidate(ns);
+        }
+
+        _subscriptions -= count;
+        return count;
+    }
+
+    /**
+     * @brief The subscribers of every namespace containing a name.
+     * @param name The name to match.
+     * @returns The union of the subscribers of the namespaces containing the name, which remains valid until the
+     *          next change to subscriptions.
+     */
+    const subscriber_set& match(const Name& name)
+    {
+        auto levels = _levels.begin();
+        entry* longest = find_next(levels, name);
+        if (!longest) return _none;
+        if (longest->merged_valid) return longest->merged;
+
+        longest->merged = longest->subscribers;
+        while (entry* next = find_next(levels, name))
+        {
+            _scratch.clear();
+            std::set_union(longest->merged.begin(),
+                           longest->merged.end(),
+                           next->subscribers.begin(),
+                           next->subscribers.end(),
+                           std::back_inserter(_scratch));
+            longest->merged.swap(_scratch);
+        }
+
+        longest->merged_valid = true;
+        return longest->merged;
+    }
+
+    /**
+     * @brief The subscribers of a namespace itself, without those of the namespaces containing it.
+     * @param ns The namespace.
+     * @returns The subscribers of the namespace, empty if it has none.
+     */
+    const subscriber_set& subscribers(const Namespace& ns) const
+    {
+        const auto it = _entries.find(ns);
+        return it == _entries.end() ? _none : it->second.subscribers;
+    }
+
+    /**
+     * @brief The number of namespaces with subscribers.
+     */
+    std::size_t size() const noexcept { return _entries.size(); }
+
+    bool empty() const noexcept { return _entries.empty(); }
+
+    /**
+     * @brief The number of subscriptions, over all namespaces.
+     */
+    std::size_t subscription_count() const noexcept { return _subscriptions; }
+
+    void clear() noexcept
+    {
+        _entries.clear();
+        _levels.clear();
+        _subscriptions = 0;
+    }
+
+  private:
+    struct entry
+    {
+        subscriber_set subscribers;
+        subscriber_set merged;
+        bool merged_valid = false;
+    };
+
+    /**
+     * Orders namespaces by name then by length, so that the namespaces
+     * contained in a namespace follow it.
+     */
+    struct namespace_order
+    {
+        bool operator()(const Namespace& a, const Namespace& b) const noexcept
+        {
+            return a.name() == b.name() ? a.length() < b.length() : a.name() < b.name();
+        }
+    };
+
+    struct level_type
+    {
+        Namespace::length_type length;
+        name_hash_map<entry*> entries;
+    };
+
+    using entry_map = std::map<Namespace, entry, namespace_order>;
+
+    /**
+     * @brief The table of the namespaces of a length, created if need be, keeping levels by decreasing length.
+     */
+    name_hash_map<entry*>& level(Namespace::length_type length)
+    {
+        auto it = std::find_if(_levels.begin(), _levels.end(), [&](const auto& l) { return l.length <= length; });
+        if (it == _levels.end() || it->length != length) it = _levels.insert(it, { length, {} });
+
+        return it->entries;
+    }
+
+    /**
+     * @brief Finds the longest namespace containing a name from the given level on, moving past its level.
+     */
+    entry* find_next(typename std::vector<level_type>::iterator& it, const Name& name) noexcept
+    {
+        for (; it != _levels.end(); ++it)
+        {
+            const auto found = it->entries.find(Namespace(name, it->length).name());
+            if (found != it->entries.end())
+            {
+                ++it;
+                return found->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void erase(typename entry_map::iterator it)
+    {
+        const auto length = it->first.length();
+        auto level = std::find_if(_levels.begin(), _levels.end(), [&](const auto& l) { return l.length == length; });
+        level->entries.erase(it->first.name());
+        if (level->entries.empty()) _levels.erase(level);
+
+        _entries.erase(it);
+    }
+
+    /**
+     * @brief Drops the merged subscribers of a namespace and of every namespace it contains.
+     */
+    void invalidate(const Namespace& ns) noexcept
+    {
+        const Name last = ns.name() | (~Name{} >> ns.length());
+        for (auto it = _entries.lower_bound(ns); it != _entries.end() && !(last < it->first.name()); ++it)
+        {
+            if (it->first.length() >= ns.length()) it->second.merged_valid = false;
+        }
+    }
+
+    entry_map _entries;
+    std::vector<level_type> _levels;
+    subscriber_set _scratch;
+    std::size_t _subscriptions = 0;
+
+    inline static const subscriber_set _none;
+};
+} // namespace quicr
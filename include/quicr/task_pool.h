@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace quicr
+{
+/**
+ * @brief A small pool of threads running batches of indexed tasks, with work stealing.
+ *
+ * @details The threads are started once and reused by every batch. A batch of
+ *          tasks is split into one contiguous range of indices per thread.
+ *          Each thread runs the tasks of its own range from the front, and
+ *          once it is empty steals the tasks of the other ranges from their
+ *          back, so that threads whose tasks finish early help with the rest.
+ *          The calling thread takes part in the batch as one of the threads.
+ *
+ *          Batches must be run from one thread at a time, and tasks must not
+ *          run batches of their own.
+ */
+class task_pool
+{
+  public:
+    /**
+     * @param thread_count The number of threads running tasks, including the
+     *                     calling thread. Defaults to the number of cores.
+     */
+    explicit task_pool(std::size_t thread_count = std::max(1u, std::thread::hardware_concurrency()))
+      : _queues(std::max<std::size_t>(1, thread_count))
+    {
+        _threads.reserve(_queues.size() - 1);
+        for (std::size_t i = 1; i < _queues.size(); ++i)
+            _threads.emplace_back([this, i] { work_loop(i); });
+    }
+
+    task_pool(const task_pool&) = delete;
+    task_pool& operator=(const task_pool&) = delete;
+
+    ~task_pool()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+
+        for (auto& thread : _threads)
+            thread.join();
+    }
+
+    /**
+     * @brief The number of threads running tasks, including the calling thread.
+     */
+    std::size_t size() const noexcept { return _queues.size(); }
+
+    /**
+     * @brief Runs fn(0), ..., fn(count - 1) across the threads of the pool, and waits for all of them.
+     *
+     * @param count The number of tasks.
+     * @param fn The task, called with the index of each task.
+     * @throws Rethrows the first exception thrown by a task, once every task has run.
+     */
+    template<class Fn>
+    void run(std::size_t count, const Fn& fn)
+    {
+        if (count == 0) return;
+        if (_threads.empty() || count == 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                fn(i);
+            return;
+        }
+
+        {
+            std::lock_guard lock(_mutex);
+            const std::size_t share = count / _queues.size();
+            const std::size_t extra = count % _queues.size();
+
+            ++_generation;
+            std::size_t next = 0;
+            for (std::size_t q = 0; q < _queues.size(); ++q)
+            {
+                std::lock_guard queue_lock(_queues[q].mutex);
+                _queues[q].generation = _generation;
+                _queues[q].begin = next;
+                _queues[q].end = next += share + (q < extra);
+            }
+
+            _job = { &invoke<Fn>, &fn, _generation };
+            _remaining = count;
+            _error = nullptr;
+            ++_busy;
+        }
+        _wake.notify_all();
+
+        work(0, _job);
+
+        std::unique_lock lock(_mutex);
+        --_busy;
+        _done.wait(lock, [&] { return _remaining == 0 && _busy == 0; });
+        if (_error) std::rethrow_exception(_error);
+    }
+
+  private:
+    struct job
+    {
+        void (*invoke)(const void* fn, std::size_t index) = nullptr;
+        const void* fn = nullptr;
+        std::uint64_t generation = 0;
+    };
+
+    /**
+     * @brief The range of tasks of a thread, aligned so that threads do not share cache lines.
+     */
+    struct alignas(64) queue
+    {
+        std::mutex mutex;
+        std::uint64_t generation = 0;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    template<class Fn>
+    static void invoke(const void* fn, std::size_t index)
+    {
+        (*static_cast<const Fn*>(fn))(index);
+    }
+
+    void work_loop(std::size_t self)
+    {
+        std::uint64_t seen = 0;
+        for (;;)
+        {
+            job current;
+            {
+                std::unique_lock lock(_mutex);
+                _wake.wait(lock, [&] { return _stop || _generation != seen; });
+                if (_stop) return;
+
+                seen = _generation;
+                current = _job;
+                ++_busy;
+            }
+
+            work(self, current);
+
+            std::lock_guard lock(_mutex);
+            if (--_busy == 0 && _remaining == 0) _done.notify_all();
+        }
+    }
+
+    void work(std::size_t self, const job& current)
+    {
+        std::size_t index;
+        while (pop(self, current.generation, index) || steal(self, current.generation, index))
+        {
+            try
+            {
+                current.invoke(current.fn, index);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(_mutex);
+                if (!_error) _error = std::current_exception();
+            }
+
+            if (_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard lock(_mutex);
+                _done.notify_all();
+            }
+        }
+    }
+
+    /**
+     * @brief Takes the next task of a thread, if its range still belongs to the batch.
+     *
+     * @details A thread that wakes up after its batch is over would otherwise
+     *          take tasks of the next batch and run them with the old one.
+     */
+    bool pop(std::size_t q, std::uint64_t generation, std::size_t& index)
+    {
+        auto& own = _queues[q];
+        std::lock_guard lock(own.mutex);
+        if (own.generation != generation || own.begin == own.end) return false;
+
+        index = own.begin++;
+        return true;
+    }
+
+    bool steal(std::size_t self, std::uint64_t generation, std::size_t& index)
+    {
+        for (std::size_t i = 1; i < _queues.size(); ++i)
+        {
+            auto& victim = _queues[(self + i) % _queues.size()];
+            std::lock_guard lock(victim.mutex);
+            if (victim.generation != generation || victim.begin == victim.end) continue;
+
+            index = --victim.end;
+            return true;
+        }
+
+        return false;
+    }
+
+    std::vector<queue> _queues;
+    std::vector<std::thread> _threads;
+
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    job _job;
+    std::uint64_t _generation = 0;
+    std::size_t _busy = 0;
+    std::atomic<std::size_t> _remaining{ 0 };
+    std::exception_ptr _error;
+    bool _stop = false;
+};
+} // namespace quicr
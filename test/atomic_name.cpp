@@ -0,0 +1,128 @@
+#include <doctest/doctest.h>
+
+#include <quicr/atomic_name.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("quicr::atomic_name Load/Store Tests")
+{
+    quicr::atomic_name name;
+    CHECK_EQ(name.load(), 0x0_name);
+
+    name.store(0xA11CEE00F00001000000000000000000_name);
+    CHECK_EQ(name.load(), 0xA11CEE00F00001000000000000000000_name);
+
+    CHECK_EQ(name.exchange(0x1_name), 0xA11CEE00F00001000000000000000000_name);
+    CHECK_EQ(quicr::Name(name), 0x1_name);
+
+#if defined(__x86_64__) || defined(_M_X64)
+    CHECK(quicr::atomic_name::is_always_lock_free);
+#endif
+}
+
+TEST_CASE("quicr::atomic_name Compare Exchange Tests")
+{
+    quicr::atomic_name name = 0x10000000000000000_name;
+
+    quicr::Name expected = 0x1_name;
+    CHECK_FALSE(name.compare_exchange_strong(expected, 0x2_name));
+    CHECK_EQ(expected, 0x10000000000000000_name);
+
+    CHECK(name.compare_exchange_strong(expected, 0x2_name));
+    CHECK_EQ(name.load(), 0x2_name);
+}
+
+TEST_CASE("quicr::atomic_name Arithmetic Tests")
+{
+    quicr::atomic_name name = 0xFFFFFFFFFFFFFFFF_name;
+    CHECK_EQ(name.fetch_add(1), 0xFFFFFFFFFFFFFFFF_name);
+    CHECK_EQ(name.load(), 0x10000000000000000_name);
+    CHECK_EQ(name.fetch_sub(1), 0x10000000000000000_name);
+    CHECK_EQ(name.load(), 0xFFFFFFFFFFFFFFFF_name);
+
+    // Adding to the low 16 bits wraps around without touching the rest.
+    name = 0xA11CEE0000000000000000000000FFFF_name;
+    CHECK_EQ(name.fetch_add(2, 16), 0xA11CEE0000000000000000000000FFFF_name);
+    CHECK_EQ(name.load(), 0xA11CEE00000000000000000000000001_name);
+
+    name.fetch_or(0xF0_name);
+    CHECK_EQ(name.load(), 0xA11CEE000000000000000000000000F1_name);
+    name.fetch_and(~0xFF_name);
+    CHECK_EQ(name.load(), 0xA11CEE00000000000000000000000000_name);
+    name.fetch_xor(0xA11CEE00000000000000000000000000_name);
+    CHECK_EQ(name.load(), 0x0_name);
+}
+
+TEST_CASE("quicr::atomic_name Monotonic Tests")
+{
+    quicr::atomic_name name = 0x100_name;
+    CHECK_FALSE(name.advance(0xFF_name));
+    CHECK_FALSE(name.advance(0x100_name));
+    CHECK_EQ(name.load(), 0x100_name);
+    CHECK(name.advance(0x10000000000000000_name));
+    CHECK_EQ(name.load(), 0x10000000000000000_name);
+
+    CHECK_EQ(name.fetch_min(0x1_name), 0x10000000000000000_name);
+    CHECK_EQ(name.load(), 0x1_name);
+    CHECK_EQ(name.fetch_max(0x2_name), 0x1_name);
+    CHECK_EQ(name.load(), 0x2_name);
+}
+
+TEST_CASE("quicr::atomic_name Concurrency Tests")
+{
+    constexpr std::uint64_t thread_count = 4;
+    constexpr std::uint64_t increments = 100000;
+    const quicr::Name start = 0xFFFFFFFFFFFF0000_name;
+
+    quicr::atomic_name counter = start;
+    quicr::atomic_name latest = 0x0_name;
+
+    std::vector<std::thread> threads;
+    for (std::uint64_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&] {
+            for (std::uint64_t i = 0; i < increments; ++i)
+                latest.advance(counter.fetch_add(1));
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK_EQ(counter.load(), start + thread_count * increments);
+    CHECK_EQ(latest.load(), start + (thread_count * increments - 1));
+}
+
+TEST_CASE("quicr::atomic_name Torn Read Tests")
+{
+    // Alternating between names whose halves differ, so that a read of one
+    // half of each would yield a name that was never stored.
+    const quicr::Name high = 0x10000000000000000_name;
+    const quicr::Name low = 0xFFFFFFFFFFFFFFFF_name;
+
+    quicr::atomic_name name = high;
+    std::atomic<bool> done{ false };
+    std::thread writer([&] {
+        while (!done.load(std::memory_order_relaxed))
+        {
+            name.store(low);
+            name.store(high);
+        }
+    });
+
+    bool stored = true;
+    for (int i = 0; i < 200000 && stored; ++i)
+    {
+        const quicr::Name max = name.fetch_max(0x1_name);
+        const quicr::Name min = name.fetch_min(0x20000000000000000_name);
+        stored = (max == high || max == low) && (min == high || min == low);
+        stored = stored && !name.advance(0x2_name);
+    }
+
+    done = true;
+    writer.join();
+    CHECK(stored);
+}
@@ -0,0 +1,114 @@
+#include <doctest/doctest.h>
+
+#include <quicr/elias_fano_name_set.h>
+#include <quicr/namespace.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+/**
+ * Sorted names across a few tracks, with gaps of up to max_gap between object ids.
+ */
+std::vector<quicr::Name> make_names(std::size_t count, std::uint64_t max_gap)
+{
+    std::mt19937_64 rng(max_gap);
+    std::set<quicr::Name> names;
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+    while (names.size() < count)
+    {
+        // Occasionally jump to another track, far beyond 64 bits away.
+        if (rng() % 1000 == 0) name += quicr::Name(std::uint64_t(1), std::uint64_t(0));
+        name += 1 + rng() % max_gap;
+        names.insert(name);
+    }
+    return { names.begin(), names.end() };
+}
+} // namespace
+
+TEST_CASE("quicr::elias_fano_name_set Empty Tests")
+{
+    const quicr::elias_fano_name_set set;
+    CHECK(set.empty());
+    CHECK(set.begin() == set.end());
+    CHECK_FALSE(set.contains(0x0_name));
+    CHECK_FALSE(set.successor(0x0_name).has_value());
+    CHECK_EQ(set.rank(0x1_name), 0);
+    CHECK_THROWS_AS(set.select(0), std::out_of_range);
+}
+
+TEST_CASE("quicr::elias_fano_name_set Construction Tests")
+{
+    CHECK_THROWS_AS(quicr::elias_fano_name_set({ 0x2_name, 0x1_name }), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::elias_fano_name_set({ 0x1_name, 0x1_name }), std::invalid_argument);
+
+    const quicr::elias_fano_name_set set{ 0x0_name, 0x1_name, 0x10000000000000000_name,
+                                          0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name };
+    CHECK_EQ(set.size(), 4);
+    CHECK_EQ(std::vector<quicr::Name>(set.begin(), set.end()),
+             std::vector<quicr::Name>{ 0x0_name, 0x1_name, 0x10000000000000000_name,
+                                       0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name });
+}
+
+TEST_CASE("quicr::elias_fano_name_set Lookup Tests")
+{
+    for (std::uint64_t max_gap : { 1, 10, 1'000'000 })
+    {
+        const auto names = make_names(20000, max_gap);
+        const quicr::elias_fano_name_set set(names.begin(), names.end());
+        REQUIRE_EQ(set.size(), names.size());
+        CHECK(std::equal(set.begin(), set.end(), names.begin(), names.end()));
+
+        bool valid = true;
+        for (std::size_t i = 0; i < names.size(); i += 7)
+        {
+            valid = valid && set.contains(names[i]);
+            valid = valid && set.rank(names[i]) == i;
+            valid = valid && set.select(i) == names[i];
+
+            // A name between two stored names must find the next one.
+            const quicr::Name probe = names[i] + 1;
+            const auto expected = std::lower_bound(names.begin(), names.end(), probe);
+            const auto successor = set.successor(probe);
+            valid = valid && successor.has_value() == (expected != names.end());
+            if (successor) valid = valid && *successor == *expected;
+            valid = valid && set.contains(probe) == (expected != names.end() && *expected == probe);
+            valid = valid && set.rank(probe) == static_cast<std::size_t>(expected - names.begin());
+        }
+        CHECK(valid);
+
+        CHECK_EQ(*set.successor(0x0_name), names.front());
+        CHECK_FALSE(set.successor(names.back() + 1).has_value());
+    }
+}
+
+TEST_CASE("quicr::elias_fano_name_set Range Tests")
+{
+    const auto names = make_names(20000, 3);
+    const quicr::elias_fano_name_set set(names.begin(), names.end());
+
+    const quicr::Namespace ns(names[5000], 120);
+    const auto [first, last] = set.equal_range(ns);
+    const std::vector<quicr::Name> found(first, last);
+
+    std::vector<quicr::Name> expected;
+    std::copy_if(names.begin(), names.end(), std::back_inserter(expected), [&](auto& name) { return ns.contains(name); });
+    CHECK_FALSE(expected.empty());
+    CHECK_EQ(found, expected);
+}
+
+TEST_CASE("quicr::elias_fano_name_set Compression Tests")
+{
+    std::vector<quicr::Name> names;
+    for (std::uint64_t i = 0; i < 100000; ++i)
+        names.push_back(0xA11CEE00F00001000000000000000000_name + i);
+
+    const quicr::elias_fano_name_set set(names.begin(), names.end());
+    CHECK_LT(set.memory_usage(), names.size() / 2);
+}
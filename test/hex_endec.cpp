@@ -9,6 +9,7 @@
 #include <type_traits>
 #include <vector>
 #if __cplusplus >= 202002L
+#include <span>
 #include <string_view>
 #endif
 
@@ -85,6 +86,47 @@ TEST_CASE("quicr::HexEndec 64bit Encode/Decode Test")
     CHECK_EQ(three, third_part);
 }
 
+TEST_CASE("quicr::HexEndec 64bit Decode Name Test")
+{
+    // A Name is decoded from its 64 least significant bits, ignoring the rest.
+    const quicr::Name name = 0xFFFFFFFFFFFFFFFF1111111122222233_name;
+    const auto [one, two, three] = quicr::HexEndec<64, 32, 24, 8>::Decode(name);
+    CHECK_EQ(one, 0x11111111);
+    CHECK_EQ(two, 0x222222);
+    CHECK_EQ(three, 0x33);
+
+    const auto values = quicr::HexEndec<32, 16, 16>::Decode<std::uint16_t>(0x12345678_name);
+    CHECK_EQ(values, std::array<std::uint16_t, 2>{ 0x1234, 0x5678 });
+}
+
+TEST_CASE("quicr::HexEndec 64bit Decode Name Container Test")
+{
+    using endec_t = quicr::HexEndec<64, 32, 24, 8>;
+    const quicr::Name name = 0xFFFFFFFFFFFFFFFF1111111122222233_name;
+
+    std::array<std::uint16_t, 3> dist = { 32, 24, 8 };
+    CHECK_EQ(endec_t::Decode<3>(dist, name), std::array<std::uint64_t, 3>{ 0x11111111, 0x222222, 0x33 });
+
+    std::vector<std::uint16_t> dist_vector = { 32, 24, 8 };
+    CHECK_EQ(endec_t::Decode(dist_vector, name), std::vector<std::uint64_t>{ 0x11111111, 0x222222, 0x33 });
+}
+
+TEST_CASE("quicr::HexEndec 64bit Decode Name String Test")
+{
+    // Strings formatted from a Name carry leading zeros beyond the 64 bits of the layout.
+    using endec_t = quicr::HexEndec<64, 32, 24, 8>;
+    const auto [one, two, three] = endec_t::Decode("0x00000000000000001111111122222233");
+    CHECK_EQ(one, 0x11111111);
+    CHECK_EQ(two, 0x222222);
+    CHECK_EQ(three, 0x33);
+
+    std::vector<std::uint16_t> dist = { 32, 24, 8 };
+    CHECK_EQ(endec_t::Decode(dist, "0x00000000000000001111111122222233"),
+             std::vector<std::uint64_t>{ 0x11111111, 0x222222, 0x33 });
+
+    CHECK_THROWS(endec_t::Decode("0x1000000000000000000000000000000000"));
+}
+
 TEST_CASE("quicr::HexEndec Decode Throw Test")
 {
 #if __cplusplus >= 202002L
@@ -127,3 +169,177 @@ TEST_CASE("quicr::HexEndec Name Encode/Decode Test")
     CHECK_EQ(two, second_part);
     CHECK_EQ(three, third_part);
 }
+
+TEST_CASE("quicr::HexEndec Name Type Test")
+{
+    CHECK(std::is_same_v<quicr::HexEndec<32, 16, 16>::name_type, quicr::BasicName<64>>);
+    CHECK(std::is_same_v<quicr::HexEndec<64, 32, 24, 8>::name_type, quicr::BasicName<64>>);
+    CHECK(std::is_same_v<quicr::HexEndec<128, 64, 56, 8>::name_type, quicr::Name>);
+
+    constexpr quicr::HexEndec<64, 32, 24, 8> formatter_64bit;
+    const auto [one, two, three] = formatter_64bit.Decode(quicr::BasicName<64>(0x1111111122222233ull));
+    CHECK_EQ(one, 0x11111111);
+    CHECK_EQ(two, 0x222222);
+    CHECK_EQ(three, 0x33);
+}
+
+TEST_CASE("quicr::HexEndec 256bit Encode/Decode Test")
+{
+    const std::string hex_value = "0x1111111111111111222222222222223300000000000000004444444444444444";
+
+    constexpr quicr::HexEndec<256, 64, 56, 8, 64, 64> formatter_256bit;
+    const std::string encoded =
+      formatter_256bit.Encode(0x1111111111111111ull, 0x22222222222222ull, 0x33ull, 0x0ull, 0x4444444444444444ull);
+    CHECK_EQ(encoded, hex_value);
+
+    const auto decoded = formatter_256bit.Decode(quicr::BasicName<256>(
+      0x1111111111111111ull, 0x2222222222222233ull, 0x0000000000000000ull, 0x4444444444444444ull));
+    CHECK_EQ(decoded,
+             std::array<std::uint64_t, 5>{ 0x1111111111111111, 0x22222222222222, 0x33, 0x0, 0x4444444444444444 });
+    CHECK_EQ(formatter_256bit.Offset(1), 136);
+}
+
+TEST_CASE("quicr::HexEndec EncodeName Test")
+{
+    using layout = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>;
+
+    constexpr quicr::Name name = layout::EncodeName(0xA11CEEu, 0x01u, 0xF00001u, 0xC2u, 0x17u, 0x5ull);
+    static_assert(name == 0xA11CEE01F00001C20017000000000005_name);
+
+    // Values are truncated to their distribution of bits.
+    static_assert(layout::EncodeName(0xFFA11CEEu, 0x101u, 0u, 0u, 0u, 0u) == 0xA11CEE01000000000000000000000000_name);
+
+    CHECK_EQ(layout::Encode(0xA11CEEu, 0x01u, 0xF00001u, 0xC2u, 0x17u, 0x5ull), std::string(name));
+    CHECK_EQ(quicr::HexEndec<64, 32, 24, 8>::EncodeName(0x11111111u, 0x222222u, 0x33u),
+             quicr::BasicName<64>(0x1111111122222233ull));
+
+    std::array<std::uint16_t, 3> dist = { 64, 56, 8 };
+    std::array<std::uint64_t, 3> vals = { 0x1111111111111111, 0x22222222222222, 0x33 };
+    CHECK_EQ(quicr::HexEndec<128>::EncodeName(dist, vals), 0x11111111111111112222222222222233_name);
+}
+
+TEST_CASE("quicr::HexEndec Decode Single Value Test")
+{
+    using layout = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>;
+    constexpr quicr::Name name = 0xA11CEE01F00001C20017000000000005_name;
+
+    static_assert(layout::Decode<0>(name) == 0xA11CEE);
+    static_assert(layout::Decode<2>(name) == 0xF00001);
+    static_assert(layout::Decode<5>(name) == 0x5);
+    CHECK_EQ(layout::Decode<3, std::uint8_t>(name), 0xC2);
+    CHECK_EQ(layout::Decode(name), std::array<std::uint64_t, 6>{ 0xA11CEE, 0x01, 0xF00001, 0xC2, 0x17, 0x5 });
+
+    // The middle value straddles the two 64 bit words of the name.
+    using straddling = quicr::HexEndec<128, 60, 8, 60>;
+    constexpr quicr::Name straddled = 0x0000000000000001A000000000000000_name;
+    static_assert(straddling::Decode<1>(straddled) == 0x1A);
+    CHECK_EQ(straddling::Decode(straddled), std::array<std::uint64_t, 3>{ 0x0, 0x1A, 0x0 });
+}
+
+TEST_CASE("quicr::HexEndec Batch Test")
+{
+    using layout = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>;
+
+    // A count that is not a multiple of any vector width, to cover the remaining names.
+    constexpr std::size_t count = 19;
+    std::vector<quicr::Name> names;
+    for (std::uint64_t i = 0; i < count; ++i)
+        names.push_back(layout::EncodeName(0xA11CEEu + i, 0x01u, 0xF00001u * i, 0xC2u - i, 0xFFF0u + i, i << 40));
+
+    std::vector<std::uint32_t> org(count), conf(count);
+    std::vector<std::uint8_t> app(count), media(count);
+    std::vector<std::uint16_t> client(count);
+    std::vector<std::uint64_t> object(count);
+    layout::DecodeBatch(
+      names.data(), count, org.data(), app.data(), conf.data(), media.data(), client.data(), object.data());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto values = layout::Decode(names[i]);
+        CHECK_EQ(org[i], values[0]);
+        CHECK_EQ(app[i], values[1]);
+        CHECK_EQ(conf[i], values[2]);
+        CHECK_EQ(media[i], values[3]);
+        CHECK_EQ(client[i], values[4]);
+        CHECK_EQ(object[i], values[5]);
+    }
+
+    std::vector<quicr::Name> encoded(count);
+    layout::EncodeBatch(
+      encoded.data(), count, org.data(), app.data(), conf.data(), media.data(), client.data(), object.data());
+    CHECK_EQ(encoded, names);
+}
+
+TEST_CASE("quicr::HexEndec Batch Straddling Test")
+{
+    using layout = quicr::HexEndec<128, 60, 8, 60>;
+
+    constexpr std::size_t count = 11;
+    std::vector<std::uint64_t> high(count), low(count);
+    std::vector<std::uint8_t> middle(count);
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        // Values wider than their distribution are truncated.
+        high[i] = 0xF000000000000000 | i;
+        middle[i] = static_cast<std::uint8_t>(0x1A + i);
+        low[i] = 0x0FFFFFFFFFFFFFFF - i;
+    }
+
+    std::vector<quicr::Name> names(count);
+    layout::EncodeBatch(names.data(), count, high.data(), middle.data(), low.data());
+    for (std::size_t i = 0; i < count; ++i)
+        CHECK_EQ(names[i], layout::EncodeName(high[i], middle[i], low[i]));
+
+    std::vector<std::uint64_t> decoded_high(count), decoded_low(count);
+    std::vector<std::uint8_t> decoded_middle(count);
+    layout::DecodeBatch(names.data(), count, decoded_high.data(), decoded_middle.data(), decoded_low.data());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK_EQ(decoded_high[i], i);
+        CHECK_EQ(decoded_middle[i], middle[i]);
+        CHECK_EQ(decoded_low[i], low[i]);
+    }
+}
+
+TEST_CASE("quicr::HexEndec Batch 64bit Test")
+{
+    using layout = quicr::HexEndec<64, 32, 24, 8>;
+
+    constexpr std::size_t count = 10;
+    std::vector<std::uint32_t> a(count), b(count);
+    std::vector<std::uint8_t> c(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        a[i] = 0x11111111u * i;
+        b[i] = 0x222222u + i;
+        c[i] = static_cast<std::uint8_t>(0x33 + i);
+    }
+
+    std::vector<quicr::BasicName<64>> names(count);
+    layout::EncodeBatch(names.data(), count, a.data(), b.data(), c.data());
+    CHECK_EQ(names[1], quicr::BasicName<64>(0x1111111122222334ull));
+
+    std::vector<std::uint32_t> decoded_a(count), decoded_b(count);
+    std::vector<std::uint8_t> decoded_c(count);
+    layout::DecodeBatch(names.data(), count, decoded_a.data(), decoded_b.data(), decoded_c.data());
+    CHECK_EQ(decoded_a, a);
+    CHECK_EQ(decoded_b, b);
+    CHECK_EQ(decoded_c, c);
+}
+
+#if __cplusplus >= 202002L
+TEST_CASE("quicr::HexEndec Batch Span Test")
+{
+    using layout = quicr::HexEndec<128, 64, 64>;
+
+    std::vector<quicr::Name> names = { 0x1_name, 0x20000000000000003_name };
+    std::vector<std::uint64_t> high(2), low(2);
+    layout::DecodeBatch(std::span<const quicr::Name>(names), std::span(high), std::span(low));
+    CHECK_EQ(high, std::vector<std::uint64_t>{ 0, 2 });
+    CHECK_EQ(low, std::vector<std::uint64_t>{ 1, 3 });
+
+    std::vector<std::uint64_t> short_values(1);
+    CHECK_THROWS_AS(layout::DecodeBatch(std::span<const quicr::Name>(names), std::span(high), std::span(short_values)),
+                    std::invalid_argument);
+}
+#endif
@@ -3,9 +3,12 @@
 #include <quicr/name.h>
 
 #include <cstdint>
+#include <functional>
 #include <iterator>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <vector>
 
@@ -320,3 +323,160 @@ TEST_CASE("quicr::Name Extract Bits Tests")
 
     CHECK_EQ(name.bits(48, 24), 0x00000000000000FFFFFF000000000000_name);
 }
+
+TEST_CASE("quicr::Name Bit Operation Tests")
+{
+    static_assert(quicr::countl_zero(0x0_name) == 128);
+    static_assert(quicr::countl_zero(0x1_name) == 127);
+    static_assert(quicr::countl_zero(0x00F00000000000000000000000000000_name) == 8);
+    CHECK_EQ(quicr::countl_zero(0x10000000000000000_name), 63);
+
+    static_assert(quicr::countr_zero(0x0_name) == 128);
+    static_assert(quicr::countr_zero(0x10000000000000000_name) == 64);
+    CHECK_EQ(quicr::countr_zero(0x00F00000000000000000000000000000_name), 116);
+    CHECK_EQ(quicr::countr_zero(0x1_name), 0);
+
+    static_assert(quicr::popcount(0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name) == 128);
+    CHECK_EQ(quicr::popcount(0x0_name), 0);
+    CHECK_EQ(quicr::popcount(0xF000000000000000000000000000000F_name), 8);
+
+    constexpr quicr::Name a = 0xA11CEE00F00001000000000000000000_name;
+    constexpr quicr::Name b = 0xA11CEE00F00001000000000000000001_name;
+    static_assert(quicr::common_prefix_length(a, a) == 128);
+    CHECK_EQ(quicr::common_prefix_length(a, b), 127);
+    CHECK_EQ(quicr::common_prefix_length(a, 0x211CEE00F00001000000000000000000_name), 0);
+    CHECK_EQ(quicr::common_prefix_length(a, 0xA11CEE00F00002000000000000000000_name), 54);
+
+    static_assert(quicr::highest_differing_bit(a, a) == -1);
+    CHECK_EQ(quicr::highest_differing_bit(a, b), 0);
+    CHECK_EQ(quicr::highest_differing_bit(a, 0xA11CEE00F00002000000000000000000_name), 73);
+
+    constexpr quicr::Name name = 0x0123456789ABCDEFFEDCBA9876543210_name;
+    static_assert(quicr::rotl(name, 0) == name);
+    static_assert(quicr::rotl(name, 128) == name);
+    CHECK_EQ(quicr::rotl(name, 4), 0x123456789ABCDEFFEDCBA98765432100_name);
+    CHECK_EQ(quicr::rotl(name, 64), 0xFEDCBA98765432100123456789ABCDEF_name);
+    CHECK_EQ(quicr::rotl(name, 68), 0xEDCBA98765432100123456789ABCDEFF_name);
+    CHECK_EQ(quicr::rotr(name, 4), 0x00123456789ABCDEFFEDCBA987654321_name);
+    CHECK_EQ(quicr::rotr(name, 132), quicr::rotr(name, 4));
+    CHECK_EQ(quicr::rotr(quicr::rotl(name, 37), 37), name);
+
+    static_assert(quicr::byteswap(name) == 0x1032547698BADCFEEFCDAB8967452301_name);
+    CHECK_EQ(quicr::byteswap(quicr::byteswap(name)), name);
+}
+
+TEST_CASE("quicr::Name Parse Tests")
+{
+    {
+        constexpr auto result = quicr::Name::parse("0xA11CEE00F00001000000000000000000");
+        static_assert(result.ec == std::errc{});
+        CHECK(result);
+        CHECK_EQ(result.value, 0xA11CEE00F00001000000000000000000_name);
+    }
+
+    CHECK_EQ(quicr::Name::parse("abcdef").value, 0xABCDEF_name);
+    CHECK_EQ(quicr::Name::parse("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF").value, 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name);
+
+    CHECK_EQ(quicr::Name::parse("0x12G4").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Name::parse("0x1234 ").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Name::parse("0x").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Name::parse("").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Name::parse("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF0").ec, std::errc::result_out_of_range);
+    CHECK_FALSE(quicr::Name::parse("0xXYZ"));
+
+#if __cplusplus >= 202002L
+    CHECK_THROWS_AS(quicr::Name(std::string_view("0x12G4")), std::invalid_argument);
+#else
+    CHECK_THROWS_AS(quicr::Name("0x12G4"), std::invalid_argument);
+#endif
+}
+
+TEST_CASE("quicr::Name From Chars Tests")
+{
+    const std::string_view str = "0x1234/80";
+    quicr::Name name = 0x0_name;
+
+    auto [ptr, ec] = quicr::from_chars(str.data(), str.data() + str.size(), name);
+    CHECK_EQ(ec, std::errc{});
+    CHECK_EQ(ptr, str.data() + 6);
+    CHECK_EQ(name, 0x1234_name);
+
+    const std::string_view invalid = "/80";
+    const auto result = quicr::from_chars(invalid.data(), invalid.data() + invalid.size(), name);
+    CHECK_EQ(result.ec, std::errc::invalid_argument);
+    CHECK_EQ(result.ptr, invalid.data());
+    CHECK_EQ(name, 0x1234_name);
+}
+
+TEST_CASE("quicr::BasicName 64bit Tests")
+{
+    using Name64 = quicr::BasicName<64>;
+
+    CHECK(std::is_trivial_v<Name64>);
+    CHECK_EQ(sizeof(Name64), sizeof(std::uint64_t));
+
+#if __cplusplus >= 202002L
+    constexpr Name64 name(std::string_view("0xA11CEE00F0000123"));
+#else
+    constexpr Name64 name("0xA11CEE00F0000123");
+#endif
+    CHECK_EQ(name, Name64(0xA11CEE00F0000123ull));
+    CHECK_EQ(std::string(name), "0xA11CEE00F0000123");
+    CHECK_EQ(name + 0x10, Name64(0xA11CEE00F0000133ull));
+    CHECK_EQ(Name64(0xFFFFFFFFFFFFFFFFull) + 1, Name64(0ull));
+    CHECK_EQ(name >> 32, Name64(0xA11CEE00ull));
+    CHECK_EQ(name << 64, Name64(0ull));
+    CHECK_EQ(name.bits<std::uint64_t>(0, 16), 0x0123);
+    CHECK_EQ(name.bits(32, 32), Name64(0xA11CEE0000000000ull));
+    CHECK_EQ(name[7], 0xA1);
+    CHECK_THROWS_AS(name[8], std::out_of_range);
+    CHECK_EQ(quicr::countl_zero(Name64(1ull)), 63);
+    CHECK_EQ(quicr::popcount(Name64(0xFFull)), 8);
+
+    CHECK_EQ(Name64::parse("0x1").value, Name64(1ull));
+    CHECK_EQ(Name64::parse("0x10000000000000000").ec, std::errc::result_out_of_range);
+
+    CHECK_EQ(quicr::Name(name), 0x0000000000000000A11CEE00F0000123_name);
+    CHECK_EQ(Name64(0x1111111111111111A11CEE00F0000123_name), name);
+}
+
+TEST_CASE("quicr::BasicName 256bit Tests")
+{
+    using Name256 = quicr::BasicName<256>;
+
+    CHECK(std::is_trivial_v<Name256>);
+    CHECK_EQ(sizeof(Name256), sizeof(std::uint64_t) * 4);
+
+#if __cplusplus >= 202002L
+    constexpr Name256 name(std::string_view("0x0123456789ABCDEF1111111111111111FFFFFFFFFFFFFFFF0000000000000000"));
+#else
+    constexpr Name256 name("0x0123456789ABCDEF1111111111111111FFFFFFFFFFFFFFFF0000000000000000");
+#endif
+    CHECK_EQ(name, Name256(0x0123456789ABCDEFull, 0x1111111111111111ull, 0xFFFFFFFFFFFFFFFFull, 0ull));
+    CHECK_EQ(std::string(name), "0x0123456789ABCDEF1111111111111111FFFFFFFFFFFFFFFF0000000000000000");
+
+    // Carries and borrows propagate across every word.
+    const Name256 carry(0ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+    CHECK_EQ(carry + 1, Name256(1ull, 0ull, 0ull, 0ull));
+    CHECK_EQ(Name256(1ull, 0ull, 0ull, 0ull) - 1, carry);
+    CHECK_EQ(carry + carry, Name256(1ull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull));
+    CHECK_EQ(carry - carry, Name256(0ull, 0ull, 0ull, 0ull));
+
+    CHECK_EQ(name >> 192, Name256(0ull, 0ull, 0ull, 0x0123456789ABCDEFull));
+    CHECK_EQ(name >> 68, Name256(0ull, 0x00123456789ABCDEull, 0xF111111111111111ull, 0x1FFFFFFFFFFFFFFFull));
+    CHECK_EQ(name << 128, Name256(0xFFFFFFFFFFFFFFFFull, 0ull, 0ull, 0ull));
+    CHECK_EQ(name << 256, Name256(0ull, 0ull, 0ull, 0ull));
+    CHECK_LT(name >> 1, name);
+    CHECK_GT(name, carry);
+
+    CHECK_EQ(name.bits<std::uint64_t>(188, 16), 0xDEF1);
+    CHECK_EQ(name.bits(64, 128), Name256(0ull, 0x1111111111111111ull, 0xFFFFFFFFFFFFFFFFull, 0ull));
+    CHECK_EQ(quicr::countl_zero(name), 7);
+    CHECK_EQ(quicr::countr_zero(name), 64);
+    CHECK_EQ(quicr::rotl(name, 64), Name256(0x1111111111111111ull, 0xFFFFFFFFFFFFFFFFull, 0ull, 0x0123456789ABCDEFull));
+    CHECK_EQ(quicr::rotr(quicr::rotl(name, 100), 100), name);
+    CHECK_EQ(quicr::byteswap(quicr::byteswap(name)), name);
+
+    CHECK_EQ(quicr::Name(name), 0xFFFFFFFFFFFFFFFF0000000000000000_name);
+    CHECK_NE(std::hash<Name256>{}(name), std::hash<Name256>{}(carry));
+}
@@ -0,0 +1,143 @@
+#include <doctest/doctest.h>
+
+#include <quicr/hex_endec.h>
+#include <quicr/name_allocator.h>
+#include <quicr/namespace.h>
+
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using layout_t = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>;
+}
+
+TEST_CASE("quicr::HexEndec Field Offset Tests")
+{
+    static_assert(layout_t::Offset(0) == 104);
+    static_assert(layout_t::Width(0) == 24);
+    static_assert(layout_t::Offset(5) == 0);
+    static_assert(layout_t::Width(5) == 48);
+    CHECK_EQ(layout_t::Offset(4), 48);
+    CHECK_EQ(layout_t::Width(4), 16);
+    CHECK_THROWS_AS(layout_t::Offset(6), std::out_of_range);
+
+    CHECK_EQ(quicr::HexEndec<64, 32, 24, 8>::Offset(0), 32);
+}
+
+TEST_CASE("quicr::name_allocator Allocation Tests")
+{
+    const quicr::Namespace ns(0xA11CEE00F00001000000000000000000_name, 80);
+    quicr::name_allocator allocator(ns, layout_t{}, 5, 4);
+
+    auto local = allocator.local();
+    const quicr::Name first = local.next();
+    CHECK_EQ(first, 0xA11CEE00F00001000000000000000000_name);
+    CHECK_EQ(local.remaining(), 3);
+    CHECK_EQ(local.next(), first + 1);
+
+    auto other = allocator.local();
+    CHECK_EQ(other.next(), first + 4);
+    CHECK_EQ(local.next(), first + 2);
+
+    const auto fields = layout_t::Decode(other.next());
+    CHECK_EQ(fields[0], 0xA11CEE);
+    CHECK_EQ(fields[2], 0xF00001);
+    CHECK_EQ(fields[5], 5);
+}
+
+TEST_CASE("quicr::name_allocator Field Boundary Tests")
+{
+    // Allocating group ids leaves the object id field below them untouched.
+    const quicr::Namespace ns(0xA11CEE00F00001000000000000000000_name, 80);
+    quicr::name_allocator allocator(ns, 32, 16);
+
+    auto local = allocator.local();
+    CHECK_EQ(local.next(), 0xA11CEE00F00001000000000000000000_name);
+    CHECK_EQ(local.next(), 0xA11CEE00F00001000000000100000000_name);
+
+    CHECK_THROWS_AS(quicr::name_allocator(ns, 40, 16), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::name_allocator(ns, 0, 0), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::name_allocator(ns, 0, 8, 0), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::name_allocator(ns, layout_t{}, 4), std::invalid_argument);
+}
+
+TEST_CASE("quicr::name_allocator Exhaustion Tests")
+{
+    const quicr::Namespace ns(0xA11CEE00F00001000000000000000000_name, 124);
+    quicr::name_allocator allocator(ns, 0, 4, 5);
+
+    auto a = allocator.local();
+    auto b = allocator.local();
+
+    std::set<quicr::Name> names;
+    for (int i = 0; i < 16; ++i)
+    {
+        if (auto name = a.try_next()) names.insert(*name);
+        if (auto name = b.try_next()) names.insert(*name);
+    }
+
+    CHECK_EQ(names.size(), 16);
+    CHECK(allocator.exhausted());
+    CHECK_FALSE(a.try_next().has_value());
+    CHECK_FALSE(b.try_next().has_value());
+    CHECK_THROWS_AS(a.next(), std::out_of_range);
+
+    bool contained = true;
+    for (const auto& name : names)
+        contained = contained && ns.contains(name);
+    CHECK(contained);
+}
+
+TEST_CASE("quicr::name_allocator Full Width Tests")
+{
+    const quicr::Namespace ns(0xA11CEE00F00001000000000000000000_name, 64);
+    quicr::name_allocator allocator(ns, 0, 64);
+
+    auto local = allocator.local();
+    CHECK_EQ(local.next(), 0xA11CEE00F00001000000000000000000_name);
+    CHECK_FALSE(allocator.exhausted());
+}
+
+TEST_CASE("quicr::name_allocator Full Width Single Name Block Tests")
+{
+    const quicr::Namespace ns(0xA11CEE00F00001000000000000000000_name, 64);
+    quicr::name_allocator allocator(ns, 0, 64, 1);
+    CHECK_FALSE(allocator.exhausted());
+
+    auto local = allocator.local();
+    CHECK_EQ(local.try_next(), 0xA11CEE00F00001000000000000000000_name);
+    CHECK_EQ(local.try_next(), 0xA11CEE00F00001000000000000000001_name);
+    CHECK_FALSE(allocator.exhausted());
+}
+
+TEST_CASE("quicr::name_allocator Concurrency Tests")
+{
+    constexpr std::size_t thread_count = 4;
+    constexpr std::size_t per_thread = 10000;
+
+    const quicr::Namespace ns(0xA11CEE00F00001000000000000000000_name, 80);
+    quicr::name_allocator allocator(ns, layout_t{}, 5, 64);
+
+    std::vector<std::vector<quicr::Name>> allocated(thread_count);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t] {
+            auto local = allocator.local();
+            for (std::size_t i = 0; i < per_thread; ++i)
+                allocated[t].push_back(local.next());
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    std::set<quicr::Name> names;
+    for (const auto& thread_names : allocated)
+        names.insert(thread_names.begin(), thread_names.end());
+    CHECK_EQ(names.size(), thread_count * per_thread);
+}
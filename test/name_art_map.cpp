@@ -0,0 +1,266 @@
+#include <doctest/doctest.h>
+
+#include <quicr/name_art_map.h>
+#include <quicr/namespace.h>
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using map_t = quicr::name_art_map<int>;
+
+std::vector<std::pair<quicr::Name, int>> entries(const map_t& map)
+{
+    return { map.begin(), map.end() };
+}
+
+std::vector<std::pair<quicr::Name, int>> entries(const std::map<quicr::Name, int>& map)
+{
+    return { map.begin(), map.end() };
+}
+
+/**
+ * Names of a few tracks of dense object ids, with random names in between,
+ * so that the tree has nodes of every type and long compressed prefixes.
+ */
+std::vector<quicr::Name> make_names(std::size_t count, std::uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<quicr::Name> names;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        switch (rng() % 4)
+        {
+            case 0:
+                names.push_back(0xA11CEE00F00001000000000000000000_name + rng() % 2000);
+                break;
+            case 1:
+                names.push_back(0xA11CEE00F00002000000000000000000_name + (rng() % 40) * 0x10000);
+                break;
+            case 2:
+                names.push_back(quicr::Name(rng(), rng() % 8));
+                break;
+            default:
+                names.push_back(quicr::Name(rng(), rng()));
+                break;
+        }
+    }
+    return names;
+}
+} // namespace
+
+TEST_CASE("quicr::name_art_map Type Tests")
+{
+    CHECK(std::is_same_v<map_t::key_type, quicr::Name>);
+    CHECK(std::is_same_v<map_t::value_type, std::pair<const quicr::Name, int>>);
+    CHECK(std::is_same_v<std::iterator_traits<map_t::iterator>::iterator_category, std::forward_iterator_tag>);
+    CHECK(std::is_nothrow_move_constructible_v<map_t>);
+}
+
+TEST_CASE("quicr::name_art_map Insert/Find Tests")
+{
+    map_t map;
+    CHECK(map.empty());
+    CHECK(map.find(0x1_name) == map.end());
+    CHECK(map.begin() == map.end());
+
+    CHECK(map.insert({ 0x1_name, 1 }).second);
+    CHECK_FALSE(map.insert({ 0x1_name, 2 }).second);
+    CHECK(map.try_emplace(0x2_name, 2).second);
+    CHECK(map.try_emplace(0x10000000000000000000000000000002_name, 3).second);
+    map[0x3_name] = 4;
+
+    CHECK_EQ(map.size(), 4);
+    CHECK_EQ(map.at(0x1_name), 1);
+    CHECK_EQ(map.at(0x2_name), 2);
+    CHECK_EQ(map.at(0x10000000000000000000000000000002_name), 3);
+    CHECK_EQ(map[0x3_name], 4);
+    CHECK_THROWS_AS(map.at(0x4_name), std::out_of_range);
+
+    CHECK(map.contains(0x2_name));
+    CHECK_FALSE(map.contains(0x20000000000000000000000000000002_name));
+    CHECK_EQ(map.find(0x2_name)->second, 2);
+
+    const auto [it, inserted] = map.insert_or_assign(0x2_name, 20);
+    CHECK_FALSE(inserted);
+    CHECK_EQ(it->second, 20);
+
+    // Names are iterated in order, regardless of the order of insertion.
+    const std::vector<std::pair<quicr::Name, int>> expected{
+        { 0x1_name, 1 }, { 0x2_name, 20 }, { 0x3_name, 4 }, { 0x10000000000000000000000000000002_name, 3 }
+    };
+    CHECK_EQ(entries(map), expected);
+
+    CHECK_EQ(map.erase(0x2_name), 1);
+    CHECK_EQ(map.erase(0x2_name), 0);
+    CHECK_EQ(map.size(), 3);
+    CHECK_FALSE(map.contains(0x2_name));
+    CHECK(map.contains(0x3_name));
+
+    map.clear();
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("quicr::name_art_map Ordered Tests")
+{
+    std::mt19937_64 rng(3);
+    map_t map;
+    std::map<quicr::Name, int> expected;
+
+    const auto names = make_names(20000, 1);
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        CHECK_EQ(map.try_emplace(names[i], int(i)).second, expected.try_emplace(names[i], int(i)).second);
+    }
+    CHECK_EQ(map.size(), expected.size());
+    CHECK_EQ(entries(map), entries(expected));
+
+    for (const auto& probe : make_names(2000, 2))
+    {
+        const auto it = map.lower_bound(probe);
+        const auto expected_it = expected.lower_bound(probe);
+        REQUIRE_EQ(it == map.end(), expected_it == expected.end());
+        if (it != map.end()) CHECK_EQ(it->first, expected_it->first);
+
+        const auto upper = map.upper_bound(probe);
+        const auto expected_upper = expected.upper_bound(probe);
+        REQUIRE_EQ(upper == map.end(), expected_upper == expected.end());
+        if (upper != map.end()) CHECK_EQ(upper->first, expected_upper->first);
+    }
+
+    const quicr::Name track = 0xA11CEE00F00001000000000000000000_name;
+    for (const int length : { 0, 8, 80, 96, 116, 120, 127, 128 })
+    {
+        const quicr::Namespace ns(track + 0x123, static_cast<std::uint8_t>(length));
+        const auto [first, last] = map.equal_range(ns);
+
+        std::size_t count = 0;
+        for (auto it = first; it != last; ++it, ++count)
+            CHECK(ns.contains(it->first));
+
+        std::size_t expected_count = 0;
+        for (const auto& [name, value] : expected)
+            expected_count += ns.contains(name);
+        CHECK_EQ(count, expected_count);
+    }
+
+    // Erasing shrinks nodes and merges prefixes back, which iteration must still see in order.
+    for (std::size_t i = 0; i < names.size(); i += 1 + rng() % 3)
+    {
+        CHECK_EQ(map.erase(names[i]), expected.erase(names[i]));
+    }
+    CHECK_EQ(map.size(), expected.size());
+    CHECK_EQ(entries(map), entries(expected));
+
+    auto it = map.find(expected.begin()->first);
+    while (it != map.end())
+        it = map.erase(it);
+    CHECK(map.empty());
+}
+
+TEST_CASE("quicr::name_art_map Dense Tests")
+{
+    // Sequential object ids fill nodes of 256 children, which shrink back as they empty.
+    const quicr::Name track = 0xA11CEE00F00001000000000000000000_name;
+    map_t map;
+    for (int i = 0; i < 70000; ++i)
+        map.try_emplace(track + i, i);
+
+    CHECK_EQ(map.size(), 70000);
+    CHECK_EQ(map.lower_bound(track + 65535)->second, 65535);
+    CHECK_EQ(std::distance(map.begin(), map.end()), 70000);
+
+    int expected = 0;
+    bool ordered = true;
+    for (const auto& [name, value] : map)
+        ordered &= name == track + expected && value == expected++;
+    CHECK(ordered);
+
+    const auto [first, last] = map.equal_range(quicr::Namespace(track + 0x10000, 112));
+    CHECK_EQ(std::distance(first, last), 70000 - 0x10000);
+
+    for (int i = 0; i < 70000; i += 2)
+        map.erase(track + i);
+    CHECK_EQ(map.size(), 35000);
+    CHECK_FALSE(map.contains(track + 1000));
+    CHECK(map.contains(track + 1001));
+    CHECK_EQ(map.lower_bound(track + 1000)->second, 1001);
+
+    const map_t copy = map;
+    for (int i = 1; i < 70000; i += 2)
+        map.erase(track + i);
+    CHECK(map.empty());
+    CHECK_EQ(copy.size(), 35000);
+    CHECK_EQ(copy.at(track + 69999), 69999);
+}
+
+TEST_CASE("quicr::name_art_map Iterator Path Tests")
+{
+    // Erasing the first entry collapses the root into the leaf, then into the node, that follows it.
+    map_t small{ { 0x100_name, 1 }, { 0x200_name, 2 }, { 0x201_name, 3 }, { 0x300_name, 4 } };
+    auto after = small.erase(small.find(0x300_name));
+    CHECK(after == small.end());
+    after = small.erase(small.begin());
+    REQUIRE(after != small.end());
+    CHECK_EQ(after->first, 0x200_name);
+    CHECK_EQ((++after)->first, 0x201_name);
+    CHECK(++after == small.end());
+
+    small.erase(0x201_name);
+    small.try_emplace(0x1FF_name, 0);
+    after = small.erase(small.begin());
+    REQUIRE(after != small.end());
+    CHECK_EQ(after->first, 0x200_name);
+    CHECK(++after == small.end());
+
+    // Iterators returned by inserts and erases carry their own path, so iterating on from them must stay in order.
+    map_t map;
+    std::map<quicr::Name, int> expected;
+
+    bool ordered = true;
+    const auto names = make_names(20000, 4);
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        const auto [it, inserted] = i % 2 ? map.try_emplace(names[i], int(i)) : map.insert_or_assign(names[i], int(i));
+        const auto expected_it = i % 2 ? expected.try_emplace(names[i], int(i)).first
+                                       : expected.insert_or_assign(names[i], int(i)).first;
+        ordered &= it->first == names[i] && it->second == expected_it->second;
+
+        auto next = std::next(it);
+        const auto expected_next = std::next(expected_it);
+        ordered &= (next == map.end()) == (expected_next == expected.end());
+        if (next != map.end() && expected_next != expected.end()) ordered &= next->first == expected_next->first;
+    }
+    CHECK(ordered);
+    CHECK_EQ(entries(map), entries(expected));
+
+    // Erasing every other entry shrinks and collapses the parents on the paths of the returned iterators.
+    auto it = map.begin();
+    auto expected_it = expected.begin();
+    while (it != map.end())
+    {
+        it = map.erase(it);
+        expected_it = expected.erase(expected_it);
+        ordered &= (it == map.end()) == (expected_it == expected.end());
+        if (it == map.end()) break;
+
+        ordered &= it->first == expected_it->first;
+        ++it;
+        ++expected_it;
+    }
+    CHECK(ordered);
+    CHECK_EQ(entries(map), entries(expected));
+
+    it = map.begin();
+    while (it != map.end())
+        it = map.erase(it);
+    CHECK(map.empty());
+}
@@ -0,0 +1,211 @@
+#include <doctest/doctest.h>
+
+#include <quicr/name_cache.h>
+#include <quicr/namespace.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/**
+ * A clock set by hand, to stamp objects with chosen times.
+ */
+struct manual_clock
+{
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<manual_clock>;
+
+    static inline time_point current{};
+    static time_point now() noexcept { return current; }
+};
+
+struct string_size
+{
+    std::size_t operator()(const std::string& str) const noexcept { return str.size(); }
+};
+
+std::vector<std::pair<quicr::Name, int>> collect(const quicr::name_cache<int>& cache,
+                                                 const quicr::Name& first,
+                                                 const quicr::Name& last)
+{
+    std::vector<std::pair<quicr::Name, int>> objects;
+    cache.range(first, last, [&](const quicr::Name& name, int value) { objects.emplace_back(name, value); });
+    return objects;
+}
+
+std::vector<std::pair<quicr::Name, int>> collect(const std::map<quicr::Name, int>& map,
+                                                 const quicr::Name& first,
+                                                 const quicr::Name& last)
+{
+    return { map.lower_bound(first), map.upper_bound(last) };
+}
+} // namespace
+
+TEST_CASE("quicr::name_cache Put/Get Tests")
+{
+    quicr::name_cache<int> cache;
+    CHECK(cache.empty());
+    CHECK_EQ(cache.get(0x1_name), nullptr);
+
+    CHECK(cache.put(0x2_name, 2));
+    CHECK(cache.put(0x1_name, 1));
+    CHECK(cache.put(0x3_name, 3));
+    CHECK_EQ(cache.size(), 3);
+    CHECK_EQ(cache.memory_used(), 3 * sizeof(int));
+
+    CHECK_EQ(*cache.get(0x1_name), 1);
+    CHECK_EQ(*cache.peek(0x2_name), 2);
+    CHECK(cache.contains(0x3_name));
+    CHECK_FALSE(cache.contains(0x4_name));
+
+    CHECK(cache.put(0x2_name, 20));
+    CHECK_EQ(cache.size(), 3);
+    CHECK_EQ(*cache.get(0x2_name), 20);
+
+    *cache.get(0x3_name) = 30;
+    CHECK_EQ(*cache.peek(0x3_name), 30);
+
+    CHECK(cache.erase(0x2_name));
+    CHECK_FALSE(cache.erase(0x2_name));
+    CHECK_EQ(cache.size(), 2);
+    CHECK_EQ(cache.memory_used(), 2 * sizeof(int));
+
+    const auto copy = cache;
+    cache.clear();
+    CHECK(cache.empty());
+    CHECK_EQ(cache.memory_used(), 0);
+    CHECK_EQ(*copy.peek(0x1_name), 1);
+    CHECK_EQ(*copy.peek(0x3_name), 30);
+}
+
+TEST_CASE("quicr::name_cache Range Tests")
+{
+    // Enough names to split blocks many times, in both increasing and random order.
+    std::mt19937_64 rng(7);
+    const quicr::Name track = 0xA11CEE00F00001000000000000000000_name;
+
+    quicr::name_cache<int> cache;
+    std::map<quicr::Name, int> expected;
+    for (int i = 0; i < 5000; ++i)
+    {
+        const quicr::Name name = i % 2 ? track + i : quicr::Name(rng(), rng());
+        cache.put(name, i);
+        expected[name] = i;
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        const quicr::Name name = quicr::Name(rng(), rng());
+        cache.put(name, i);
+        expected[name] = i;
+    }
+
+    CHECK_EQ(cache.size(), expected.size());
+    CHECK_EQ(collect(cache, quicr::Name{}, ~quicr::Name{}), collect(expected, quicr::Name{}, ~quicr::Name{}));
+    CHECK_EQ(collect(cache, track + 100, track + 200), collect(expected, track + 100, track + 200));
+    CHECK_EQ(collect(cache, track + 200, track + 100).size(), 0);
+
+    const quicr::Namespace ns(track, 112);
+    std::size_t visited = cache.range(ns, [](const quicr::Name&, int) {});
+    CHECK_EQ(visited, collect(expected, track, track + 0xFFFF).size());
+
+    for (int i = 0; i < 20; ++i)
+    {
+        quicr::Name first(rng(), rng());
+        quicr::Name last(rng(), rng());
+        if (last < first) std::swap(first, last);
+        CHECK_EQ(collect(cache, first, last), collect(expected, first, last));
+    }
+}
+
+TEST_CASE("quicr::name_cache Namespace Eviction Tests")
+{
+    const quicr::Name track = 0xA11CEE00F00001000000000000000000_name;
+    const quicr::Name other = 0xA11CEE00F00002000000000000000000_name;
+
+    quicr::name_cache<int> cache;
+    for (int i = 0; i < 1000; ++i)
+    {
+        cache.put(track + i, i);
+        cache.put(other + i, i);
+    }
+
+    CHECK_EQ(cache.erase(quicr::Namespace(track + 0x100, 120)), 0x100);
+    CHECK_EQ(cache.size(), 1744);
+    CHECK_FALSE(cache.contains(track + 0x100));
+    CHECK_FALSE(cache.contains(track + 0x1FF));
+    CHECK(cache.contains(track + 0xFF));
+    CHECK(cache.contains(track + 0x200));
+
+    CHECK_EQ(cache.erase(quicr::Namespace(track, 80)), 744);
+    CHECK_EQ(cache.size(), 1000);
+    CHECK_EQ(cache.range(quicr::Namespace(track, 80), [](const quicr::Name&, int) {}), 0);
+    CHECK_EQ(cache.range(quicr::Namespace(other, 80), [](const quicr::Name&, int) {}), 1000);
+    CHECK_EQ(cache.memory_used(), 1000 * sizeof(int));
+
+    CHECK_EQ(cache.erase(quicr::Namespace(quicr::Name{}, 0)), 1000);
+    CHECK(cache.empty());
+
+    // Slots of evicted objects are reused.
+    CHECK(cache.put(track, 1));
+    CHECK_EQ(*cache.get(track), 1);
+}
+
+TEST_CASE("quicr::name_cache Budget Tests")
+{
+    quicr::name_cache<std::string, string_size> cache(10);
+    CHECK(cache.put(0x1_name, "aaaa"));
+    CHECK(cache.put(0x2_name, "bbb"));
+    CHECK(cache.put(0x3_name, "cc"));
+    CHECK_EQ(cache.memory_used(), 9);
+
+    // Getting 0x1 makes 0x2 the least recently used, while peeking does not change the order.
+    CHECK(cache.get(0x1_name));
+    CHECK(cache.peek(0x2_name));
+    CHECK(cache.put(0x4_name, "dd"));
+    CHECK_FALSE(cache.contains(0x2_name));
+    CHECK(cache.contains(0x1_name));
+    CHECK_EQ(cache.memory_used(), 8);
+
+    // Objects larger than the budget are not cached, and replace nothing.
+    CHECK_FALSE(cache.put(0x1_name, "eeeeeeeeeee"));
+    CHECK_FALSE(cache.contains(0x1_name));
+    CHECK_EQ(cache.memory_used(), 4);
+
+    CHECK(cache.put(0x5_name, "ffffffffff"));
+    CHECK_EQ(cache.size(), 1);
+    CHECK_EQ(*cache.peek(0x5_name), "ffffffffff");
+
+    cache.set_budget(5);
+    CHECK(cache.empty());
+    CHECK_EQ(cache.memory_used(), 0);
+}
+
+TEST_CASE("quicr::name_cache Age Eviction Tests")
+{
+    using namespace std::chrono_literals;
+    using cache_t = quicr::name_cache<int, quicr::object_size, manual_clock>;
+
+    manual_clock::current = manual_clock::time_point{};
+    cache_t cache;
+    cache.put(0x1_name, 1);
+    manual_clock::current += 1s;
+    cache.put(0x2_name, 2);
+    manual_clock::current += 1s;
+    cache.put(0x3_name, 3);
+
+    // Getting an object does not make it younger, but putting it again does.
+    CHECK(cache.get(0x1_name));
+    cache.put(0x2_name, 20);
+
+    CHECK_EQ(cache.evict_older_than(manual_clock::time_point{ 1s }), 1);
+    CHECK_FALSE(cache.contains(0x1_name));
+    CHECK_EQ(cache.evict_older_than(manual_clock::time_point{ 2s }), 0);
+    CHECK_EQ(cache.evict_older_than(manual_clock::time_point{ 3s }), 2);
+    CHECK(cache.empty());
+}
@@ -0,0 +1,162 @@
+#include <doctest/doctest.h>
+
+#include <quicr/name_hash_map.h>
+#include <quicr/namespace.h>
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+TEST_CASE("quicr::Name Hash Tests")
+{
+    const std::hash<quicr::Name> hasher;
+    CHECK_EQ(hasher(0x1234_name), hasher(0x1234_name));
+    CHECK_NE(hasher(0x1234_name), hasher(0x1235_name));
+    CHECK_NE(hasher(0x10000000000000000_name), hasher(0x1_name));
+
+    // Sequential names should not cluster in the low bits used for bucketing.
+    std::set<std::size_t> buckets;
+    quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+    for (int i = 0; i < 1024; ++i)
+        buckets.insert(hasher(name++) & 0xFFFF);
+    CHECK_GT(buckets.size(), 1000);
+
+    std::unordered_set<quicr::Name> names{ 0x1_name, 0x2_name, 0x1_name };
+    CHECK_EQ(names.size(), 2);
+}
+
+TEST_CASE("quicr::Namespace Hash Tests")
+{
+    const std::hash<quicr::Namespace> hasher;
+    const quicr::Name name = 0xA11CEE00F00001000000000000000000_name;
+    CHECK_EQ(hasher({ name, 80 }), hasher({ name + 1, 80 }));
+    CHECK_NE(hasher({ name, 80 }), hasher({ name, 88 }));
+}
+
+TEST_CASE("quicr::name_hash_map Type Tests")
+{
+    using map_t = quicr::name_hash_map<int>;
+    CHECK(std::is_same_v<map_t::key_type, quicr::Name>);
+    CHECK(std::is_same_v<map_t::value_type, std::pair<const quicr::Name, int>>);
+    CHECK(std::is_nothrow_move_constructible_v<map_t>);
+}
+
+TEST_CASE("quicr::name_hash_map Insert/Find Tests")
+{
+    quicr::name_hash_map<int> map;
+    CHECK(map.empty());
+    CHECK(map.find(0x1_name) == map.end());
+
+    CHECK(map.insert({ 0x1_name, 1 }).second);
+    CHECK_FALSE(map.insert({ 0x1_name, 2 }).second);
+    CHECK(map.try_emplace(0x2_name, 2).second);
+    map[0x3_name] = 3;
+
+    CHECK_EQ(map.size(), 3);
+    CHECK_EQ(map.at(0x1_name), 1);
+    CHECK_EQ(map.at(0x2_name), 2);
+    CHECK_EQ(map[0x3_name], 3);
+    CHECK(map.contains(0x3_name));
+    CHECK_FALSE(map.contains(0x4_name));
+    CHECK_EQ(map.count(0x4_name), 0);
+    CHECK_THROWS_AS(map.at(0x4_name), std::out_of_range);
+
+    map.insert_or_assign(0x1_name, 10);
+    CHECK_EQ(map.at(0x1_name), 10);
+}
+
+TEST_CASE("quicr::name_hash_map Growth Tests")
+{
+    constexpr int count = 100000;
+    const quicr::Name base = 0xA11CEE00F00001000000000000000000_name;
+
+    quicr::name_hash_map<int> map;
+    for (int i = 0; i < count; ++i)
+        map.try_emplace(base + i, i);
+
+    REQUIRE_EQ(map.size(), count);
+    CHECK_LE(map.load_factor(), map.max_load_factor());
+
+    bool all_found = true;
+    for (int i = 0; i < count; ++i)
+    {
+        auto it = map.find(base + i);
+        all_found = all_found && it != map.end() && it->second == i;
+    }
+    CHECK(all_found);
+    CHECK_FALSE(map.contains(base + count));
+
+    std::size_t iterated = 0;
+    for ([[maybe_unused]] const auto& [name, value] : map)
+        ++iterated;
+    CHECK_EQ(iterated, map.size());
+}
+
+TEST_CASE("quicr::name_hash_map Erase Tests")
+{
+    constexpr int count = 10000;
+    quicr::name_hash_map<std::string> map;
+    for (int i = 0; i < count; ++i)
+        map.try_emplace(quicr::Name(0x0_name) + i, std::to_string(i));
+
+    for (int i = 0; i < count; i += 2)
+        CHECK_EQ(map.erase(quicr::Name(0x0_name) + i), 1);
+    CHECK_EQ(map.erase(0x0_name), 0);
+    CHECK_EQ(map.size(), count / 2);
+
+    bool valid = true;
+    for (int i = 0; i < count; ++i)
+        valid = valid && map.contains(quicr::Name(0x0_name) + i) == (i % 2 == 1);
+    CHECK(valid);
+
+    // Reinserting into a table full of tombstones must not grow without bound.
+    const auto bucket_count = map.bucket_count();
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int i = 0; i < count; i += 2)
+            map.try_emplace(quicr::Name(0x0_name) + i, std::to_string(i));
+        for (int i = 0; i < count; i += 2)
+            map.erase(quicr::Name(0x0_name) + i);
+    }
+    CHECK_EQ(map.size(), count / 2);
+    CHECK_EQ(map.bucket_count(), bucket_count);
+
+    for (auto it = map.begin(); it != map.end();)
+        it = map.erase(it);
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("quicr::name_hash_map Copy/Move Tests")
+{
+    quicr::name_hash_map<int> map{ { 0x1_name, 1 }, { 0x2_name, 2 } };
+
+    quicr::name_hash_map<int> copy = map;
+    CHECK_EQ(copy.size(), 2);
+    CHECK_EQ(copy.at(0x2_name), 2);
+
+    quicr::name_hash_map<int> moved = std::move(map);
+    CHECK_EQ(moved.size(), 2);
+    CHECK_EQ(moved.at(0x1_name), 1);
+
+    copy.clear();
+    CHECK(copy.empty());
+    CHECK_FALSE(copy.contains(0x1_name));
+}
+
+TEST_CASE("quicr::name_hash_set Tests")
+{
+    quicr::name_hash_set<> set;
+    CHECK(set.insert(0x1_name).second);
+    CHECK_FALSE(set.insert(0x1_name).second);
+    CHECK(set.insert(0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name).second);
+
+    CHECK_EQ(set.size(), 2);
+    CHECK(set.contains(0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name));
+    CHECK_EQ(*set.find(0x1_name), 0x1_name);
+
+    CHECK_EQ(set.erase(0x1_name), 1);
+    CHECK_FALSE(set.contains(0x1_name));
+}
@@ -0,0 +1,76 @@
+#include <doctest/doctest.h>
+
+#include <quicr/hex_endec.h>
+#include <quicr/name.h>
+#include <quicr/name_layout.h>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("quicr::NameLayout Constructor Test")
+{
+    const quicr::NameLayout layout{ 24, 8, 24, 8, 16, 48 };
+    CHECK_EQ(layout.Count(), 6);
+    CHECK_EQ(layout.Width(2), 24);
+    CHECK_EQ(layout.Offset(0), 104);
+    CHECK_EQ(layout.Offset(5), 0);
+    CHECK_THROWS_AS(layout.Width(6), std::out_of_range);
+
+    using hex_endec = quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>;
+    for (std::size_t i = 0; i < layout.Count(); ++i)
+        CHECK_EQ(layout.Offset(i), hex_endec::Offset(i));
+
+    const std::vector<std::uint16_t> distribution{ 64, 64 };
+    CHECK_EQ(quicr::NameLayout(distribution).Count(), 2);
+
+    CHECK_THROWS_AS(quicr::NameLayout({ 64, 65 }), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::NameLayout({ 64, 0, 8 }), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::NameLayout({ 64, 64, 1 }), std::invalid_argument);
+}
+
+TEST_CASE("quicr::NameLayout Encode/Decode Test")
+{
+    const quicr::NameLayout layout{ 24, 8, 24, 8, 16, 48 };
+    const quicr::Name name = 0xA11CEE01F00001C20017000000000005_name;
+    const std::array<std::uint64_t, 6> values{ 0xA11CEE, 0x01, 0xF00001, 0xC2, 0x17, 0x5 };
+
+    CHECK_EQ(layout.EncodeName(values.data(), values.size()), name);
+    CHECK_EQ(layout.Encode(values.data(), values.size()), std::string(name));
+    CHECK_EQ(layout.EncodeName(values.data(), values.size()),
+             quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>::EncodeName(0xA11CEEu, 0x01u, 0xF00001u, 0xC2u, 0x17u, 0x5u));
+
+    std::array<std::uint64_t, 6> decoded{};
+    layout.Decode(name, decoded.data(), decoded.size());
+    CHECK_EQ(decoded, values);
+    CHECK_EQ(layout.Decode(name, 2), 0xF00001);
+
+    CHECK_THROWS_AS(layout.EncodeName(values.data(), 5), std::invalid_argument);
+    CHECK_THROWS_AS(layout.Decode(name, decoded.data(), 7), std::invalid_argument);
+    CHECK_THROWS_AS(layout.Decode(name, 6), std::out_of_range);
+
+#if __cplusplus >= 202002L
+    CHECK_EQ(layout.EncodeName(values), name);
+    decoded = {};
+    layout.Decode(name, decoded);
+    CHECK_EQ(decoded, values);
+#endif
+}
+
+TEST_CASE("quicr::NameLayout Partial Distribution Test")
+{
+    // Values are laid out from the most significant bits, leaving the rest of the name 0.
+    const quicr::NameLayout layout{ 16, 8 };
+    const std::array<std::uint64_t, 2> values{ 0x1FFFF, 0xAB };
+    CHECK_EQ(layout.EncodeName(values.data(), values.size()), 0xFFFFAB00000000000000000000000000_name);
+}
+
+TEST_CASE("quicr::BasicNameLayout 64bit Test")
+{
+    const quicr::BasicNameLayout<64> layout{ 32, 24, 8 };
+    const std::array<std::uint64_t, 3> values{ 0x11111111, 0x222222, 0x33 };
+    CHECK_EQ(layout.EncodeName(values.data(), values.size()), quicr::BasicName<64>(0x1111111122222233ull));
+    CHECK_EQ(layout.Decode(quicr::BasicName<64>(0x1111111122222233ull), 1), 0x222222);
+}
@@ -0,0 +1,197 @@
+#include <doctest/doctest.h>
+
+#include <quicr/name.h>
+#include <quicr/name_schema.h>
+#include <quicr/namespace.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+struct org;
+struct app;
+struct conf;
+struct media;
+struct client;
+struct object;
+
+using layout = quicr::name_schema<quicr::field<org, 24>,
+                                  quicr::field<app, 8>,
+                                  quicr::field<conf, 24>,
+                                  quicr::field<media, 8>,
+                                  quicr::field<client, 16>,
+                                  quicr::field<object, 48>>;
+
+constexpr quicr::Name name = 0xA11CEE01000007C20017000000000005_name;
+} // namespace
+
+TEST_CASE("quicr::name_schema Layout Test")
+{
+    static_assert(layout::size == 6);
+    static_assert(layout::index<org> == 0);
+    static_assert(layout::index<object> == 5);
+
+    static_assert(layout::width<conf> == 24);
+    static_assert(layout::offset<org> == 104);
+    static_assert(layout::offset<conf> == 72);
+    static_assert(layout::offset<object> == 0);
+    static_assert(layout::max_value<media> == 0xFF);
+
+    CHECK_EQ(layout::mask<conf>, 0x00000000FFFFFF000000000000000000_name);
+    CHECK_EQ(layout::mask<object>, 0x00000000000000000000FFFFFFFFFFFF_name);
+    CHECK(std::is_same_v<layout::hex_endec, quicr::HexEndec<128, 24, 8, 24, 8, 16, 48>>);
+}
+
+TEST_CASE("quicr::name_schema Get Test")
+{
+    static_assert(layout::get<org>(name) == 0xA11CEE);
+    static_assert(layout::get<app>(name) == 0x01);
+    static_assert(layout::get<conf>(name) == 0x000007);
+    static_assert(layout::get<media>(name) == 0xC2);
+    static_assert(layout::get<client>(name) == 0x0017);
+    static_assert(layout::get<object>(name) == 0x5);
+
+    const auto decoded = layout::hex_endec::Decode(name);
+    CHECK_EQ(layout::get<conf>(name), decoded[layout::index<conf>]);
+    CHECK_EQ(layout::get<client>(name), decoded[layout::index<client>]);
+}
+
+TEST_CASE("quicr::name_schema Set Test")
+{
+    quicr::Name modified = name;
+    layout::set<conf>(modified, 0x123456);
+    CHECK_EQ(modified, 0xA11CEE01123456C20017000000000005_name);
+
+    // Values are truncated to the width of the field.
+    layout::set<media>(modified, 0xABCD);
+    CHECK_EQ(modified, 0xA11CEE01123456CD0017000000000005_name);
+
+    layout::set<object>(modified, ~std::uint64_t(0));
+    CHECK_EQ(modified, 0xA11CEE01123456CD0017FFFFFFFFFFFF_name);
+}
+
+TEST_CASE("quicr::name_schema With Test")
+{
+    constexpr quicr::Name next = layout::with<client, object>(name, 0x18u, 0u);
+    static_assert(next == 0xA11CEE01000007C20018000000000000_name);
+    CHECK_EQ(layout::with<>(name), name);
+
+    const quicr::Name built =
+      layout::with<org, app, conf, media, client, object>(0x0_name, 0xA11CEEu, 0x01u, 0x07u, 0xC2u, 0x17u, 0x5u);
+    CHECK_EQ(built, name);
+}
+
+TEST_CASE("quicr::name_schema 64bit Test")
+{
+    using layout_64 = quicr::basic_name_schema<64, quicr::field<conf, 32>, quicr::field<object, 32>>;
+    using Name64 = quicr::BasicName<64>;
+
+    constexpr Name64 name_64(0x0000000700000005ull);
+    static_assert(layout_64::get<conf>(name_64) == 7);
+    static_assert(layout_64::get<object>(name_64) == 5);
+    CHECK_EQ(layout_64::with<object>(name_64, 6u), Name64(0x0000000700000006ull));
+}
+
+TEST_CASE("quicr::name_schema Increment Wrap Test")
+{
+    quicr::Name n = name;
+    CHECK_FALSE(layout::increment<object>(n));
+    CHECK_EQ(n, 0xA11CEE01000007C20017000000000006_name);
+
+    CHECK_FALSE(layout::increment<client>(n, 0x10));
+    CHECK_EQ(layout::get<client>(n), 0x27);
+
+    // Wrapping leaves the neighbouring fields untouched.
+    layout::set<client>(n, 0xFFFF);
+    CHECK(layout::increment<client>(n, 2));
+    CHECK_EQ(n, 0xA11CEE01000007C20001000000000006_name);
+
+    static_assert(
+      [] {
+          quicr::Name m = name;
+          layout::increment<org>(m);
+          return m;
+      }() == 0xA11CEF01000007C20017000000000005_name);
+}
+
+TEST_CASE("quicr::name_schema Increment Saturate Test")
+{
+    quicr::Name n = layout::with<client>(name, 0xFFFEu);
+    CHECK_FALSE(layout::increment<client, quicr::field_overflow::saturate>(n));
+    CHECK_EQ(layout::get<client>(n), 0xFFFF);
+
+    CHECK(layout::increment<client, quicr::field_overflow::saturate>(n));
+    CHECK_EQ(n, 0xA11CEE01000007C2FFFF000000000005_name);
+
+    CHECK(layout::increment<app, quicr::field_overflow::saturate>(n, 0x1000));
+    CHECK_EQ(layout::get<app>(n), 0xFF);
+    CHECK_EQ(layout::get<conf>(n), 0x7);
+}
+
+TEST_CASE("quicr::name_schema Increment Carry Test")
+{
+    quicr::Name n = layout::with<client>(name, 0xFFFFu);
+    CHECK_FALSE(layout::increment<client, quicr::field_overflow::carry>(n));
+    CHECK_EQ(n, 0xA11CEE01000007C30000000000000005_name);
+
+    // The carry crosses the boundary between the words of the name.
+    n = layout::with<object>(name, 0xFFFFFFFFFFFFu);
+    CHECK_FALSE(layout::increment<object, quicr::field_overflow::carry>(n, 2));
+    CHECK_EQ(n, 0xA11CEE01000007C20018000000000001_name);
+
+    n = ~quicr::Name{};
+    CHECK(layout::increment<org, quicr::field_overflow::carry>(n));
+    CHECK_EQ(n, 0x000000FFFFFFFFFFFFFFFFFFFFFFFFFF_name);
+}
+
+TEST_CASE("quicr::name_schema Reset Lower Test")
+{
+    static_assert(layout::lower_mask<object> == quicr::Name{});
+    static_assert(layout::lower_mask<client> == 0xFFFFFFFFFFFF_name);
+
+    quicr::Name n = name;
+    layout::reset_lower<media>(n);
+    CHECK_EQ(n, 0xA11CEE01000007C20000000000000000_name);
+
+    n = name;
+    layout::reset_lower<object>(n);
+    CHECK_EQ(n, name);
+
+    // Advancing to the next group and its first object.
+    n = name;
+    layout::increment<client>(n);
+    layout::reset_lower<client>(n);
+    CHECK_EQ(n, 0xA11CEE01000007C20018000000000000_name);
+}
+
+TEST_CASE("quicr::name_schema Make Namespace Test")
+{
+    constexpr quicr::Namespace conference = layout::make_namespace(0xA11CEEu, 0x01u, 0x7u);
+    static_assert(conference.length() == 56);
+    static_assert(conference.name() == 0xA11CEE01000007000000000000000000_name);
+    CHECK_EQ(conference, quicr::Namespace(0xA11CEE01000007000000000000000000_name, 56));
+    CHECK(conference.contains(name));
+
+    // Values are truncated to the width of their field.
+    static_assert(layout::make_namespace(0xFFA11CEEu) == quicr::Namespace(0xA11CEE_name << 104, 24));
+
+    static_assert(layout::make_namespace().length() == 0);
+    static_assert(layout::make_namespace(0xA11CEEu, 0x01u, 0x7u, 0xC2u, 0x17u, 0x5ull) ==
+                  quicr::Namespace(name, 128));
+}
+
+TEST_CASE("quicr::name_schema Pinned Fields Test")
+{
+    static_assert(layout::pinned_fields(layout::make_namespace(0xA11CEEu, 0x01u, 0x7u)) == 3);
+    static_assert(layout::pinned_fields(quicr::Namespace(name, 0)) == 0);
+    static_assert(layout::pinned_fields(quicr::Namespace(name, 23)) == 0);
+    static_assert(layout::pinned_fields(quicr::Namespace(name, 60)) == 3);
+    static_assert(layout::pinned_fields(quicr::Namespace(name, 128)) == 6);
+
+    constexpr quicr::Namespace ns(name, 64);
+    static_assert(layout::pins<org>(ns));
+    static_assert(layout::pins<media>(ns));
+    static_assert(!layout::pins<client>(ns));
+    static_assert(!layout::pins<object>(ns));
+}
@@ -0,0 +1,178 @@
+#include <doctest/doctest.h>
+
+#include <quicr/name_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<quicr::Name> make_names(std::size_t count, std::uint64_t object_range)
+{
+    std::mt19937_64 rng(count);
+    std::vector<quicr::Name> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Shared prefix, random group and object ids, so that some digits are constant.
+        const std::uint64_t group = rng() % 16;
+        const std::uint64_t object = rng() % object_range;
+        names.push_back(quicr::Name(0xA11CEE00F0000100ull, group << 48 | object));
+    }
+    return names;
+}
+} // namespace
+
+TEST_CASE("quicr::radix_sort Tests")
+{
+    std::vector<quicr::Name> empty;
+    quicr::radix_sort(empty.data(), empty.data());
+    CHECK(empty.empty());
+
+    std::vector<quicr::Name> names{ 0x3_name, 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name, 0x10000000000000000_name, 0x1_name,
+                                    0x0_name };
+    quicr::radix_sort(names.data(), names.data() + names.size());
+    CHECK_EQ(names,
+             std::vector<quicr::Name>{ 0x0_name, 0x1_name, 0x3_name, 0x10000000000000000_name,
+                                       0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name });
+
+    for (std::uint64_t range : { 1ull, 100ull, 1ull << 48 })
+    {
+        auto sorted = make_names(10000, range);
+        auto expected = sorted;
+        std::sort(expected.begin(), expected.end());
+        quicr::radix_sort(sorted.data(), sorted.data() + sorted.size());
+        CHECK_EQ(sorted, expected);
+    }
+}
+
+TEST_CASE("quicr::radix_sort Key-Value Tests")
+{
+    auto names = make_names(10000, 100);
+    std::vector<std::string> values;
+    for (std::size_t i = 0; i < names.size(); ++i)
+        values.push_back(std::to_string(i));
+
+    auto expected = names;
+    std::stable_sort(expected.begin(), expected.end());
+
+    const auto original = names;
+    quicr::radix_sort(names.data(), names.data() + names.size(), values.data());
+    CHECK_EQ(names, expected);
+
+    // Values follow their keys, and equal keys keep their original order.
+    bool stable = true;
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        const std::size_t index = std::stoul(values[i]);
+        stable = stable && original[index] == names[i];
+        if (i > 0 && names[i - 1] == names[i]) stable = stable && std::stoul(values[i - 1]) < index;
+    }
+    CHECK(stable);
+}
+
+TEST_CASE("quicr::radix_sort_unique Tests")
+{
+    std::vector<quicr::Name> same(10, 0x5_name);
+    CHECK_EQ(quicr::radix_sort_unique(same.data(), same.data() + same.size()), same.data() + 1);
+    CHECK_EQ(same[0], 0x5_name);
+
+    for (std::uint64_t range : { 1000ull, 1ull << 48 })
+    {
+        auto names = make_names(10000, range);
+        auto expected = names;
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        auto end = quicr::radix_sort_unique(names.data(), names.data() + names.size());
+        CHECK_EQ(std::vector<quicr::Name>(names.data(), end), expected);
+    }
+
+    std::vector<quicr::Name> names{ 0x2_name, 0x1_name, 0x2_name, 0x1_name };
+    std::vector<int> values{ 0, 1, 2, 3 };
+    auto end = quicr::radix_sort_unique(names.data(), names.data() + names.size(), values.data());
+    REQUIRE_EQ(end - names.data(), 2);
+    CHECK_EQ(names[0], 0x1_name);
+    CHECK_EQ(values[0], 1);
+    CHECK_EQ(names[1], 0x2_name);
+    CHECK_EQ(values[1], 0);
+}
+
+TEST_CASE("quicr::parallel_radix_sort Tests")
+{
+    constexpr std::size_t count = 200000;
+
+    for (std::size_t threads : { 1, 3, 8 })
+    {
+        auto names = make_names(count, 1ull << 48);
+        std::vector<std::uint32_t> values(count);
+        for (std::size_t i = 0; i < count; ++i)
+            values[i] = static_cast<std::uint32_t>(i);
+
+        auto expected = names;
+        std::sort(expected.begin(), expected.end());
+
+        const auto original = names;
+        quicr::parallel_radix_sort(names.data(), names.data() + names.size(), values.data(), threads);
+        CHECK_EQ(names, expected);
+
+        bool matched = true;
+        for (std::size_t i = 0; i < count; ++i)
+            matched = matched && original[values[i]] == names[i];
+        CHECK(matched);
+    }
+}
+
+TEST_CASE("quicr::parallel_radix_sort_unique Tests")
+{
+    constexpr std::size_t count = 200000;
+
+    for (std::size_t threads : { 2, 7 })
+    {
+        auto names = make_names(count, 5000);
+        auto expected = names;
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        auto end = quicr::parallel_radix_sort_unique(names.data(), names.data() + names.size(), threads);
+        CHECK_EQ(std::vector<quicr::Name>(names.data(), end), expected);
+    }
+}
+
+TEST_CASE("quicr::radix_sort_unique Key-Value In Place Tests")
+{
+    // Only the two lowest bytes differ, so the sort takes an even number of
+    // passes and deduplicates back into the input.
+    for (std::size_t threads : { 0, 2, 7 })
+    {
+        const std::size_t count = threads == 0 ? 50 : 200000;
+        const std::uint64_t distinct = threads == 0 ? 50 : 60000;
+        const std::uint64_t stride = 0x10000 / distinct;
+
+        std::vector<quicr::Name> names;
+        std::vector<std::string> values;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::uint64_t object = (i * 7919) % distinct;
+            names.push_back(quicr::Name(0xA11CEE00F0000100ull, 0xF00D0000ull | object * stride));
+            values.push_back("object " + std::to_string(object));
+        }
+
+        auto* first = names.data();
+        auto* last = first + names.size();
+        auto end = threads == 0 ? quicr::radix_sort_unique(first, last, values.data())
+                                : quicr::parallel_radix_sort_unique(first, last, values.data(), threads);
+        REQUIRE_EQ(static_cast<std::size_t>(end - names.data()), distinct);
+
+        bool matched = true;
+        for (std::size_t i = 0; i < distinct; ++i)
+        {
+            matched = matched && names[i] == quicr::Name(0xA11CEE00F0000100ull, 0xF00D0000ull | i * stride);
+            matched = matched && values[i] == "object " + std::to_string(i);
+        }
+        CHECK(matched);
+    }
+}
@@ -0,0 +1,176 @@
+#include <doctest/doctest.h>
+
+#include <quicr/hex_endec.h>
+#include <quicr/name_vector.h>
+#include <quicr/namespace.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+TEST_CASE("quicr::name_vector Layout Tests")
+{
+    quicr::name_vector names{ 0x0123456789ABCDEFFEDCBA9876543210_name, 0x1_name };
+    REQUIRE_EQ(names.size(), 2);
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(names.hi_data()) % 64, 0);
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(names.lo_data()) % 64, 0);
+    CHECK_EQ(names.hi_data()[0], 0x0123456789ABCDEFull);
+    CHECK_EQ(names.lo_data()[0], 0xFEDCBA9876543210ull);
+    CHECK_EQ(names.hi_data()[1], 0);
+    CHECK_EQ(names.lo_data()[1], 1);
+}
+
+TEST_CASE("quicr::name_vector Element Access Tests")
+{
+    quicr::name_vector names;
+    CHECK(names.empty());
+
+    names.push_back(0x1_name);
+    names.push_back(0x10000000000000000_name);
+    CHECK_EQ(names.size(), 2);
+    CHECK_EQ(names[0], 0x1_name);
+    CHECK_EQ(names.back(), 0x10000000000000000_name);
+
+    names[0] = 0x2_name;
+    names.front() = names.back();
+    CHECK_EQ(names.front(), 0x10000000000000000_name);
+    CHECK_EQ(std::as_const(names).at(1), 0x10000000000000000_name);
+    CHECK_THROWS_AS(names.at(2), std::out_of_range);
+
+    names.resize(4, 0x3_name);
+    CHECK_EQ(names[3], 0x3_name);
+    names.erase(names.cbegin() + 1);
+    CHECK_EQ(names, quicr::name_vector{ 0x10000000000000000_name, 0x3_name, 0x3_name });
+    names.pop_back();
+    CHECK_EQ(names.size(), 2);
+}
+
+TEST_CASE("quicr::name_vector Algorithm Tests")
+{
+    std::vector<quicr::Name> expected;
+    for (std::uint64_t i = 0; i < 1000; ++i)
+        expected.push_back(quicr::Name((i * 7919) % 13, (i * 104729) % 1009));
+
+    quicr::name_vector names(expected.begin(), expected.end());
+    CHECK(std::equal(names.begin(), names.end(), expected.begin(), expected.end()));
+
+    std::sort(names.begin(), names.end());
+    std::sort(expected.begin(), expected.end());
+    CHECK(std::equal(names.begin(), names.end(), expected.begin(), expected.end()));
+    CHECK(std::is_sorted(names.cbegin(), names.cend()));
+
+    std::reverse(names.begin(), names.end());
+    CHECK_EQ(names.front(), expected.back());
+
+    const auto it = std::find(names.cbegin(), names.cend(), expected[500]);
+    REQUIRE(it != names.cend());
+    CHECK_EQ(*it, expected[500]);
+
+    const auto count = std::count_if(names.begin(), names.end(), [](quicr::Name name) { return name < 0x1_name; });
+    CHECK_EQ(count, std::count_if(expected.begin(), expected.end(), [](quicr::Name name) { return name < 0x1_name; }));
+
+    auto first = names.begin();
+    auto second = names.begin() + 1;
+    const quicr::Name a = *first;
+    const quicr::Name b = *second;
+    using std::swap;
+    swap(*first, *second);
+    CHECK_EQ(names[0], b);
+    CHECK_EQ(names[1], a);
+}
+
+TEST_CASE("quicr::name_vector Mask Tests")
+{
+    quicr::name_vector names{ 0x0123456789ABCDEFFEDCBA9876543210_name, 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name };
+
+    names.mask(0xFFFF00000000000000000000000000FF_name);
+    CHECK_EQ(names[0], 0x01230000000000000000000000000010_name);
+    CHECK_EQ(names[1], 0xFFFF00000000000000000000000000FF_name);
+}
+
+TEST_CASE("quicr::name_vector Shift Tests")
+{
+    quicr::name_vector names{ 0x0123456789ABCDEFFEDCBA9876543210_name, 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name };
+
+    for (std::uint16_t shift : { 0, 4, 64, 72, 128 })
+    {
+        quicr::name_vector right = names;
+        right.shift_right(shift);
+        quicr::name_vector left = names;
+        left.shift_left(shift);
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            const quicr::Name name = names[i];
+            CHECK_EQ(right[i], shift >= 128 ? 0x0_name : name >> shift);
+            CHECK_EQ(left[i], shift >= 128 ? 0x0_name : name << shift);
+        }
+    }
+}
+
+TEST_CASE("quicr::name_vector Extract Tests")
+{
+    quicr::name_vector names{ 0x0123456789ABCDEFFEDCBA9876543210_name, 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name };
+
+    std::uint64_t out[2];
+    for (auto [offset, width] : { std::pair{ 0, 64 }, std::pair{ 64, 64 }, std::pair{ 60, 8 }, std::pair{ 120, 8 } })
+    {
+        names.extract(offset, width, out);
+        CHECK_EQ(out[0], std::as_const(names)[0].bits<std::uint64_t>(offset, width));
+        CHECK_EQ(out[1], std::as_const(names)[1].bits<std::uint64_t>(offset, width));
+    }
+
+    CHECK_THROWS_AS(names.extract(0, 65, out), std::domain_error);
+    CHECK_THROWS_AS(names.extract(100, 64, out), std::out_of_range);
+
+    quicr::HexEndec<128, 24, 8, 24, 8, 16, 48> layout;
+    names.extract(layout, 5, out);
+    CHECK_EQ(out[0], 0xBA9876543210ull);
+    names.extract(layout, 0, out);
+    CHECK_EQ(out[0], 0x012345ull);
+}
+
+TEST_CASE("quicr::name_vector Namespace Tests")
+{
+    quicr::name_vector names{ 0x0123456789ABCDEFFEDCBA9876543210_name, 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_name };
+
+    names.push_back(0x0123456789ABCDEF0000000000000000_name);
+    names.push_back(0x0123456789ABCDEE0000000000000000_name);
+
+    std::uint8_t out[4];
+    CHECK_EQ(names.contains(quicr::Namespace(0x0123456789ABCDEF0000000000000000_name, 64), out), 2);
+    CHECK_EQ(std::vector<std::uint8_t>(out, out + 4), std::vector<std::uint8_t>{ 1, 0, 1, 0 });
+    CHECK_EQ(names.count(quicr::Namespace(0x0123456789ABCDEF0000000000000000_name, 64)), 2);
+    CHECK_EQ(names.count(quicr::Namespace(0x0123456789ABCDEE0000000000000000_name, 63)), 3);
+    CHECK_EQ(names.count(quicr::Namespace(0x0_name, 0)), 4);
+    CHECK_EQ(names.count(quicr::Namespace(0x0123456789ABCDEFFEDCBA9876543210_name, 128)), 1);
+}
+
+TEST_CASE("quicr::name_vector Min/Max Tests")
+{
+    CHECK_THROWS_AS(quicr::name_vector{}.min(), std::out_of_range);
+    CHECK_THROWS_AS(quicr::name_vector{}.max(), std::out_of_range);
+
+    quicr::name_vector names{ 0x20000000000000005_name, 0x10000000000000009_name, 0x20000000000000001_name,
+                              0x10000000000000003_name };
+    CHECK_EQ(names.min(), 0x10000000000000003_name);
+    CHECK_EQ(names.max(), 0x20000000000000005_name);
+}
+
+TEST_CASE("quicr::name_vector Gather/Scatter Tests")
+{
+    quicr::name_vector names;
+    for (std::uint64_t i = 0; i < 8; ++i)
+        names.push_back(quicr::Name(i, i));
+
+    const std::size_t indices[] = { 7, 0, 3 };
+    const auto gathered = names.gather(indices, 3);
+    CHECK_EQ(gathered, quicr::name_vector{ 0x70000000000000007_name, 0x0_name, 0x30000000000000003_name });
+
+    names.scatter(indices, quicr::name_vector{ 0x1_name, 0x2_name, 0x3_name });
+    CHECK_EQ(names[7], 0x1_name);
+    CHECK_EQ(names[0], 0x2_name);
+    CHECK_EQ(names[3], 0x3_name);
+    CHECK_EQ(names[1], 0x10000000000000001_name);
+}
@@ -2,6 +2,10 @@
 
 #include <quicr/namespace.h>
 
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
 #include <type_traits>
 
 TEST_CASE("quicr::Namespace Type Tests")
@@ -60,6 +64,22 @@ TEST_CASE("quicr::Namespace Contains Namespaces Test")
     CHECK_FALSE(base_namespace.contains(invalid_namespace));
 }
 
+TEST_CASE("quicr::Namespace Common Prefix Test")
+{
+    constexpr quicr::Name a = 0xA11CEE00F00001000000000000000000_name;
+    constexpr quicr::Name b = 0xA11CEE00F00002000000000000000000_name;
+
+    static_assert(quicr::Namespace::common_prefix(a, a) == quicr::Namespace(a, 128));
+    CHECK_EQ(quicr::Namespace::common_prefix(a, b), quicr::Namespace(0xA11CEE00F00000000000000000000000_name, 54));
+    CHECK_EQ(quicr::Namespace::common_prefix(a, ~a), quicr::Namespace(0x0_name, 0));
+
+    const quicr::Namespace ns_a(a, 80);
+    const quicr::Namespace ns_b(b, 80);
+    CHECK_EQ(quicr::Namespace::common_prefix(ns_a, ns_b), quicr::Namespace(a, 54));
+    CHECK_EQ(quicr::Namespace::common_prefix(ns_a, quicr::Namespace(a, 24)), quicr::Namespace(a, 24));
+    CHECK(quicr::Namespace::common_prefix(ns_a, ns_b).contains(ns_a));
+}
+
 TEST_CASE("quicr::Namespace String Constructor Test")
 {
 #if __cplusplus >= 202002L
@@ -113,3 +133,155 @@ TEST_CASE("quicr::Namespace Map Sorting Test")
         CHECK_EQ(ns_map.find(name)->second, sub_value);
     }
 }
+
+TEST_CASE("quicr::Namespace Map Uninstrumented Test")
+{
+    using allocator_type = std::allocator<std::pair<const quicr::Namespace, int>>;
+    using map_type = quicr::namespace_map<int, std::greater, allocator_type, false>;
+    using std_map_type =
+      std::map<quicr::Namespace, int, quicr::namespace_comparator_wrapper<std::greater>, allocator_type>;
+
+    CHECK_FALSE(map_type::instrumented);
+    CHECK(std::is_same_v<map_type::key_compare, std_map_type::key_compare>);
+    CHECK_EQ(sizeof(map_type), sizeof(std_map_type));
+
+    quicr::Name name = 0xABCDEFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
+    map_type ns_map{ { { name, 16 }, 1 } };
+    ns_map.emplace(quicr::Namespace(name, 24), 2);
+    CHECK_EQ(ns_map.find(name)->second, 2);
+
+    const auto stats = ns_map.stats();
+    CHECK_EQ(stats.lookups, 0);
+    CHECK_EQ(stats.inserts, 0);
+    CHECK_EQ(stats.comparisons_per_lookup(), 0.0);
+}
+
+TEST_CASE("quicr::Namespace Map Stats Test")
+{
+    quicr::Name name = 0xABCDEFFFFFFFFFFFFFFFFFFFFFFFFFFF_name;
+    quicr::Namespace base_namespace(name, 16);
+    quicr::Namespace sub_namespace(name, 24);
+
+    quicr::instrumented_namespace_map<int> ns_map;
+    CHECK(decltype(ns_map)::instrumented);
+
+    ns_map.emplace(base_namespace, 1);
+    ns_map.insert({ sub_namespace, 2 });
+    ns_map.insert(std::make_pair(quicr::Namespace(0x11110000000000000000000000000000_name, 16), 3));
+    ns_map.emplace(base_namespace, 4);
+    ns_map[quicr::Namespace(0x22220000000000000000000000000000_name, 16)] = 5;
+    ns_map.try_emplace(sub_namespace, 6);
+
+    CHECK_EQ(ns_map.find(name)->second, 2);
+    CHECK_EQ(ns_map.find(0xABCD0000000000000000000000000000_name)->second, 1);
+    CHECK_EQ(ns_map.find(base_namespace)->second, 1);
+    CHECK_FALSE(ns_map.contains(0x33330000000000000000000000000000_name));
+
+    auto stats = ns_map.stats();
+    CHECK_EQ(stats.inserts, 4);
+    CHECK_EQ(stats.erases, 0);
+    CHECK_EQ(stats.lookups, 4);
+    CHECK_EQ(stats.hits, 3);
+    CHECK_EQ(stats.misses, 1);
+    CHECK_EQ(stats.match_lengths[24], 1);
+    CHECK_EQ(stats.match_lengths[16], 2);
+    CHECK_EQ(stats.match_lengths[0], 0);
+    CHECK_GE(stats.comparisons, stats.lookups);
+    CHECK_EQ(stats.comparisons_per_lookup(), double(stats.comparisons) / 4);
+
+    ns_map.erase(sub_namespace);
+    ns_map.erase(ns_map.begin());
+    ns_map.erase(sub_namespace);
+    CHECK_EQ(ns_map.stats().erases, 2);
+
+    const auto copy = ns_map;
+    CHECK_EQ(copy.stats().erases, 2);
+    CHECK_EQ(copy.stats().lookups, 4);
+
+    ns_map.clear();
+    CHECK_EQ(ns_map.stats().erases, 4);
+
+    ns_map.reset_stats();
+    stats = ns_map.stats();
+    CHECK_EQ(stats.lookups, 0);
+    CHECK_EQ(stats.comparisons, 0);
+    CHECK_EQ(stats.erases, 0);
+    CHECK_EQ(stats.match_lengths[16], 0);
+    CHECK_EQ(copy.stats().lookups, 4);
+}
+
+TEST_CASE("quicr::Namespace Parse Tests")
+{
+    {
+        constexpr auto result = quicr::Namespace::parse("0xA11CEE00000001010007000000000001/80");
+        static_assert(result.ec == std::errc{});
+        CHECK(result);
+        CHECK_EQ(result.value.name(), 0xA11CEE00000001010007000000000000_name);
+        CHECK_EQ(result.value.length(), 80);
+    }
+
+    CHECK_EQ(quicr::Namespace::parse("0x1/0").value.length(), 0);
+    CHECK_EQ(quicr::Namespace::parse("0x1/128").value.length(), 128);
+
+    CHECK_EQ(quicr::Namespace::parse("0x1/129").ec, std::errc::result_out_of_range);
+    CHECK_EQ(quicr::Namespace::parse("0x1/300").ec, std::errc::result_out_of_range);
+    CHECK_EQ(quicr::Namespace::parse("0x1/99999999999999999999").ec, std::errc::result_out_of_range);
+    CHECK_EQ(quicr::Namespace::parse("0x1").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Namespace::parse("0x1/").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Namespace::parse("0x1/8a").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Namespace::parse("0xG/8").ec, std::errc::invalid_argument);
+    CHECK_EQ(quicr::Namespace::parse("/8").ec, std::errc::invalid_argument);
+
+#if __cplusplus >= 202002L
+    CHECK_THROWS_AS(quicr::Namespace(std::string_view("0x1/300")), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::Namespace(std::string_view("0x1")), std::invalid_argument);
+#else
+    CHECK_THROWS_AS(quicr::Namespace("0x1/300"), std::invalid_argument);
+    CHECK_THROWS_AS(quicr::Namespace("0x1"), std::invalid_argument);
+#endif
+}
+
+TEST_CASE("quicr::BasicNamespace 64bit Test")
+{
+    using Name64 = quicr::BasicName<64>;
+    using Namespace64 = quicr::BasicNamespace<64>;
+
+    CHECK(std::is_trivial_v<Namespace64>);
+    CHECK_LT(sizeof(Namespace64), sizeof(quicr::Namespace));
+
+    const Namespace64 ns(Name64(0xA11CEE00F0000123ull), 40);
+    CHECK_EQ(ns.name(), Name64(0xA11CEE00F0000000ull));
+    CHECK(ns.contains(Name64(0xA11CEE00F0FFFFFFull)));
+    CHECK_FALSE(ns.contains(Name64(0xA11CEE00F1000000ull)));
+    CHECK_EQ(std::string(ns), "0xA11CEE00F0000000/40");
+
+    CHECK_EQ(Namespace64::parse("0xA11CEE00F0000123/40").value, ns);
+    CHECK_EQ(Namespace64::parse("0x1/65").ec, std::errc::result_out_of_range);
+    CHECK_EQ(Namespace64::common_prefix(Name64(0xFF00ull), Name64(0xFF80ull)).length(), 56);
+
+    quicr::basic_namespace_map<64, int> ns_map{ { Namespace64(Name64(0xA11CEE0000000000ull), 24), 1 }, { ns, 2 } };
+    CHECK_EQ(ns_map.find(Name64(0xA11CEE00F0000456ull))->second, 2);
+    CHECK_EQ(ns_map.find(Name64(0xA11CEE0012345678ull))->second, 1);
+    CHECK(ns_map.find(Name64(0xB000000000000000ull)) == ns_map.end());
+}
+
+TEST_CASE("quicr::BasicNamespace 256bit Test")
+{
+    using Name256 = quicr::BasicName<256>;
+    using Namespace256 = quicr::BasicNamespace<256>;
+
+    const Name256 name(0xA11CEE0000000001ull, 0x0000000700000000ull, 0ull, 0x1234ull);
+    const Namespace256 ns(name, 200);
+    CHECK_EQ(ns.length(), 200);
+    CHECK_EQ(ns.name(), Name256(0xA11CEE0000000001ull, 0x0000000700000000ull, 0ull, 0ull));
+    CHECK(ns.contains(name));
+    CHECK_FALSE(ns.contains(name + Name256(0ull, 0ull, 0ull, 0x100000000000000ull)));
+
+    CHECK_EQ(Namespace256(name, 256).name(), name);
+    CHECK_EQ(Namespace256::parse("0x1/256").value.length(), 256);
+    CHECK_EQ(Namespace256::parse("0x1/257").ec, std::errc::result_out_of_range);
+
+    quicr::basic_namespace_map<256, int> ns_map{ { ns, 1 } };
+    CHECK_EQ(ns_map.count(name), 1);
+    CHECK_EQ(ns_map.count(Name256(0ull, 0ull, 0ull, 0x1234ull)), 0);
+}
@@ -0,0 +1,167 @@
+#include <doctest/doctest.h>
+
+#include <quicr/namespace.h>
+#include <quicr/namespace_table.h>
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using table_t = quicr::namespace_table<int>;
+
+/**
+ * Random namespaces under a few prefixes, so that lengths nest and repeat.
+ */
+std::vector<std::pair<quicr::Namespace, int>> make_entries(std::size_t count, std::uint64_t seed)
+{
+    constexpr std::uint8_t lengths[] = { 0, 24, 32, 56, 64, 80, 96, 128 };
+    std::mt19937_64 rng(seed);
+    std::vector<std::pair<quicr::Namespace, int>> entries;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const quicr::Name name = 0xA11CEE00F00001000000000000000000_name + quicr::Name(rng() % 3, rng() % 5000);
+        entries.emplace_back(quicr::Namespace(name, lengths[rng() % 8]), static_cast<int>(i));
+    }
+    return entries;
+}
+
+/**
+ * The expected table: the first value of every namespace, by length and name.
+ */
+std::map<std::pair<std::uint8_t, quicr::Name>, int> expected_entries(
+  const std::vector<std::pair<quicr::Namespace, int>>& entries)
+{
+    std::map<std::pair<std::uint8_t, quicr::Name>, int> expected;
+    for (const auto& [ns, value] : entries)
+        expected.try_emplace({ ns.length(), ns.name() }, value);
+    return expected;
+}
+} // namespace
+
+TEST_CASE("quicr::namespace_table Find Tests")
+{
+    const table_t empty;
+    CHECK(empty.empty());
+    CHECK(empty.find(0x1_name) == empty.end());
+
+    const std::list<std::pair<quicr::Namespace, int>> entries{
+        { { 0xA11CEE00000000000000000000000000_name, 24 }, 1 },
+        { { 0xA11CEE00F00001000000000000000000_name, 56 }, 2 },
+        { { 0xA11CEE00F00001000000000000000000_name, 64 }, 3 },
+        { { 0xA11CEE00F00001000000000000000000_name, 56 }, 4 },
+    };
+    const table_t table(entries.begin(), entries.end(), 2);
+    CHECK_EQ(table.size(), 3);
+
+    CHECK_EQ(table.find(0xA11CEE00F00001000000000000000001_name)->second, 3);
+    CHECK_EQ(table.find(0xA11CEE00F00001010000000000000001_name)->second, 2);
+    CHECK_EQ(table.find(0xA11CEE00F00002000000000000000001_name)->second, 1);
+    CHECK_FALSE(table.contains(0xA11CEF00F00001000000000000000001_name));
+
+    // Namespaces are found by exact length, and duplicates keep their first value.
+    CHECK_EQ(table.find(quicr::Namespace(0xA11CEE00F00001000000000000000000_name, 56))->second, 2);
+    CHECK_EQ(table.find(quicr::Namespace(0xA11CEE00F00001000000000000000000_name, 64))->first.length(), 64);
+    CHECK_FALSE(table.contains(quicr::Namespace(0xA11CEE00F00001000000000000000000_name, 60)));
+
+    std::vector<int> values;
+    for (const auto& [ns, value] : table)
+        values.push_back(value);
+    CHECK_EQ(values, std::vector<int>{ 3, 2, 1 });
+}
+
+TEST_CASE("quicr::namespace_table Bulk Build Tests")
+{
+    const auto entries = make_entries(400000, 1);
+    const auto expected = expected_entries(entries);
+
+    for (const std::size_t threads : { 1, 4 })
+    {
+        quicr::task_pool pool(threads);
+        const table_t table(entries.begin(), entries.end(), pool);
+        REQUIRE_EQ(table.size(), expected.size());
+
+        bool same = true;
+        auto previous = table.begin();
+        for (auto it = table.begin(); it != table.end(); previous = it++)
+        {
+            const auto found = expected.find({ it->first.length(), it->first.name() });
+            same &= found != expected.end() && found->second == it->second;
+            if (it != table.begin())
+            {
+                const auto& [before, after] = std::tie(previous->first, it->first);
+                same &= before.length() > after.length() ||
+                        (before.length() == after.length() && before.name() < after.name());
+            }
+        }
+        CHECK(same);
+
+        // The longest namespace containing a name is found, as with a scan of every length.
+        std::mt19937_64 rng(2);
+        bool longest = true;
+        for (int i = 0; i < 5000; ++i)
+        {
+            const quicr::Name name = 0xA11CEE00F00001000000000000000000_name + quicr::Name(rng() % 4, rng() % 6000);
+            const auto it = table.find(name);
+
+            const int* value = nullptr;
+            for (int length = 128; length >= 0 && !value; --length)
+            {
+                const quicr::Namespace ns(name, static_cast<std::uint8_t>(length));
+                const auto found = expected.find({ ns.length(), ns.name() });
+                if (found != expected.end()) value = &found->second;
+            }
+
+            longest &= value ? it != table.end() && it->second == *value : it == table.end();
+        }
+        CHECK(longest);
+    }
+}
+
+TEST_CASE("quicr::namespace_table String Value Tests")
+{
+    // Distinct full length namespaces differing in their two lowest bytes sort in an even number of passes.
+    std::vector<std::pair<quicr::Namespace, std::string>> entries;
+    for (int i = 0; i < 50; ++i)
+    {
+        const quicr::Name name = 0xA11CEE00F00001000000000000000000_name + quicr::Name(0, i * 1000);
+        entries.emplace_back(quicr::Namespace(name, 128), "entry " + std::to_string(i));
+    }
+
+    const auto generated = make_entries(400000, 3);
+    const auto expected = expected_entries(generated);
+    for (const auto& [ns, value] : generated)
+        entries.emplace_back(ns, "entry " + std::to_string(value));
+
+    for (const std::size_t threads : { 1, 4 })
+    {
+        quicr::task_pool pool(threads);
+        const quicr::namespace_table<std::string> table(entries.begin(), entries.begin() + 50, pool);
+        REQUIRE_EQ(table.size(), 50);
+
+        bool same = true;
+        for (int i = 0; i < 50; ++i)
+        {
+            const auto it = table.find(0xA11CEE00F00001000000000000000000_name + quicr::Name(0, i * 1000));
+            same &= it != table.end() && it->second == "entry " + std::to_string(i);
+        }
+        CHECK(same);
+
+        const quicr::namespace_table<std::string> bulk(entries.begin() + 50, entries.end(), pool);
+        REQUIRE_EQ(bulk.size(), expected.size());
+
+        same = true;
+        for (const auto& [ns, value] : bulk)
+        {
+            const auto found = expected.find({ ns.length(), ns.name() });
+            same &= found != expected.end() && value == "entry " + std::to_string(found->second);
+        }
+        CHECK(same);
+    }
+}
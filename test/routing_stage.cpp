@@ -0,0 +1,169 @@
+#include <doctest/doctest.h>
+
+#include <quicr/namespace.h>
+#include <quicr/routing_stage.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using index_t = quicr::namespace_map<std::size_t>;
+using stage_t = quicr::routing_stage<index_t>;
+
+const quicr::Name audio = 0xA11CEE00F00001000000000000000000_name;
+const quicr::Name video = 0xA11CEE00F00002000000000000000000_name;
+const quicr::Name misrouted = 0xA11CEE00F00003000000000000000000_name;
+
+index_t make_index()
+{
+    index_t index;
+    index.emplace(quicr::Namespace(audio, 56), 0);
+    index.emplace(quicr::Namespace(video, 56), 1);
+    index.emplace(quicr::Namespace(misrouted, 56), 7);
+    return index;
+}
+
+std::vector<std::uintptr_t> drain(stage_t& stage, std::size_t destination)
+{
+    std::vector<std::uintptr_t> handles;
+    stage.drain(destination, [&](const stage_t::value_type& value) { handles.push_back(value.handle); });
+    return handles;
+}
+} // namespace
+
+TEST_CASE("quicr::routing_stage Routing Tests")
+{
+    const auto index = make_index();
+    CHECK_THROWS_AS(stage_t(index, 0, 1), std::invalid_argument);
+    CHECK_THROWS_AS(stage_t(index, 1, 0), std::invalid_argument);
+    CHECK_THROWS_AS(stage_t(index, 1, 1, 16, 0), std::invalid_argument);
+
+    stage_t stage(index, 1, 2);
+    CHECK_EQ(stage.process(0), 0);
+
+    stage.input(0).try_push(stage_t::value_type{ audio + 1, 1 });
+    stage.input(0).try_push(stage_t::value_type{ video + 2, 2 });
+    stage.input(0).try_push(stage_t::value_type{ audio + 3, 3 });
+    stage.input(0).try_push(stage_t::value_type{ misrouted + 4, 4 });
+    stage.input(0).try_push(stage_t::value_type{ 0x1_name, 5 });
+
+    CHECK_EQ(stage.process(0), 5);
+    CHECK(stage.input(0).empty());
+    CHECK_EQ(drain(stage, 0), std::vector<std::uintptr_t>{ 1, 3 });
+    CHECK_EQ(drain(stage, 1), std::vector<std::uintptr_t>{ 2 });
+
+    const auto stats = stage.stats(0);
+    CHECK_EQ(stats.routed, 3);
+    CHECK_EQ(stats.unrouted, 2);
+    CHECK_EQ(stats.batches, 1);
+    CHECK_EQ(stats.stalls, 0);
+}
+
+TEST_CASE("quicr::routing_stage Unrouted Tests")
+{
+    const auto index = make_index();
+    stage_t stage(index, 1, 2, 16, 2);
+
+    stage.input(0).try_push(stage_t::value_type{ 0x1_name, 1 });
+    stage.input(0).try_push(stage_t::value_type{ audio + 2, 2 });
+    stage.input(0).try_push(stage_t::value_type{ misrouted + 3, 3 });
+    stage.input(0).try_push(stage_t::value_type{ 0x4_name, 4 });
+
+    // Names without a destination are handed back, so that their handles can be released.
+    std::vector<std::uintptr_t> unrouted;
+    const auto release = [&](stage_t::value_type& value) { unrouted.push_back(value.handle); };
+    CHECK_EQ(stage.process(0, release), 2);
+    CHECK_EQ(stage.process(0, release), 2);
+    CHECK_EQ(stage.process(0, release), 0);
+
+    CHECK_EQ(unrouted, std::vector<std::uintptr_t>{ 1, 3, 4 });
+    CHECK_EQ(drain(stage, 0), std::vector<std::uintptr_t>{ 2 });
+    CHECK_EQ(stage.stats(0).unrouted, 3);
+}
+
+TEST_CASE("quicr::routing_stage Back-Pressure Tests")
+{
+    const auto index = make_index();
+    stage_t stage(index, 1, 2, 4, 8);
+    for (std::uintptr_t i = 0; i < 4; ++i)
+        CHECK(stage.input(0).try_push(stage_t::value_type{ audio + i, i }));
+    CHECK_FALSE(stage.input(0).try_push(stage_t::value_type{ audio, 99 }));
+    CHECK_EQ(stage.process(0), 4);
+
+    // The output ring of audio is full, so the next batch is held back and the input ring fills up again.
+    for (std::uintptr_t i = 4; i < 8; ++i)
+        CHECK(stage.input(0).try_push(stage_t::value_type{ audio + i, i }));
+    CHECK_EQ(stage.process(0), 0);
+    CHECK_EQ(stage.process(0), 0);
+    CHECK_EQ(stage.stats(0).stalls, 2);
+    CHECK(stage.input(0).try_push(stage_t::value_type{ video, 100 }));
+
+    CHECK_EQ(stage.pending(0), 4);
+    CHECK_EQ(drain(stage, 0), std::vector<std::uintptr_t>{ 0, 1, 2, 3 });
+    CHECK_EQ(stage.process(0), 4);
+    CHECK_EQ(stage.pending(0), 0);
+    CHECK_EQ(drain(stage, 0), std::vector<std::uintptr_t>{ 4, 5, 6, 7 });
+    CHECK(drain(stage, 1).empty());
+
+    stage.set_batch_size(1);
+    CHECK_EQ(stage.batch_size(), 1);
+    CHECK_THROWS_AS(stage.set_batch_size(0), std::invalid_argument);
+    CHECK_EQ(stage.process(0), 1);
+    CHECK_EQ(drain(stage, 1), std::vector<std::uintptr_t>{ 100 });
+    CHECK_EQ(stage.stats(0).batches, 3);
+    CHECK_EQ(stage.stats(0).routed, 9);
+}
+
+TEST_CASE("quicr::routing_stage Thread Tests")
+{
+    constexpr std::size_t workers = 2;
+    constexpr std::uintptr_t per_worker = 100000;
+
+    const auto index = make_index();
+    stage_t stage(index, workers, 2, 64, 16);
+    std::atomic<std::size_t> delivered{ 0 };
+
+    std::vector<std::thread> threads;
+    for (std::size_t w = 0; w < workers; ++w)
+    {
+        threads.emplace_back([&, w] {
+            for (std::uintptr_t i = 0; i < per_worker;)
+            {
+                const auto& prefix = i % 2 ? video : audio;
+                i += stage.input(w).try_push(stage_t::value_type{ prefix + i, w * per_worker + i });
+                stage.process(w);
+            }
+            while (!stage.input(w).empty() || stage.pending(w) != 0)
+                stage.process(w);
+        });
+    }
+
+    // Every destination sees the names of each worker in the order the worker took them.
+    std::vector<std::uintptr_t> next(workers * 2, 0);
+    bool ordered = true;
+    std::size_t count = 0;
+    while (count < workers * per_worker)
+    {
+        for (std::size_t destination = 0; destination < 2; ++destination)
+        {
+            count += stage.drain(destination, [&](const stage_t::value_type& value) {
+                auto& expected = next[value.handle / per_worker * 2 + destination];
+                ordered &= value.handle >= expected;
+                expected = value.handle + 1;
+            });
+        }
+    }
+    delivered = count;
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(ordered);
+    CHECK_EQ(delivered.load(), workers * per_worker);
+    CHECK_EQ(stage.stats(0).routed + stage.stats(1).routed, workers * per_worker);
+}
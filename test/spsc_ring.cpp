@@ -0,0 +1,77 @@
+#include <doctest/doctest.h>
+
+#include <quicr/spsc_ring.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("quicr::spsc_ring Push/Pop Tests")
+{
+    CHECK_THROWS_AS(quicr::spsc_ring<int>(0), std::invalid_argument);
+    CHECK_EQ(quicr::spsc_ring<int>(1).capacity(), 1);
+    CHECK_EQ(quicr::spsc_ring<int>(5).capacity(), 8);
+
+    quicr::spsc_ring<int> ring(4);
+    int value = 0;
+    CHECK(ring.empty());
+    CHECK_FALSE(ring.try_pop(value));
+
+    for (int i = 0; i < 4; ++i)
+        CHECK(ring.try_push(i));
+    CHECK_FALSE(ring.try_push(4));
+    CHECK_EQ(ring.size(), 4);
+
+    CHECK(ring.try_pop(value));
+    CHECK_EQ(value, 0);
+    CHECK(ring.try_push(4));
+
+    // Batches wrap around the end of the ring.
+    std::vector<int> popped;
+    CHECK_EQ(ring.consume([&](int v) { popped.push_back(v); }, 2), 2);
+    CHECK_EQ(popped, std::vector<int>{ 1, 2 });
+
+    const std::vector<int> more{ 5, 6, 7, 8 };
+    CHECK_EQ(ring.try_push(more.begin(), more.size()), 2);
+    CHECK_EQ(ring.try_push(more.begin(), more.size()), 0);
+
+    popped.clear();
+    CHECK_EQ(ring.consume([&](int v) { popped.push_back(v); }), 4);
+    CHECK_EQ(popped, std::vector<int>{ 3, 4, 5, 6 });
+    CHECK(ring.empty());
+}
+
+TEST_CASE("quicr::spsc_ring Thread Tests")
+{
+    constexpr std::uint64_t count = 1000000;
+    quicr::spsc_ring<std::uint64_t> ring(64);
+
+    std::thread producer([&] {
+        std::uint64_t batch[7];
+        for (std::uint64_t next = 0; next < count;)
+        {
+            if (next % 3 == 0)
+            {
+                next += ring.try_push(next);
+                continue;
+            }
+
+            for (std::uint64_t i = 0; i < 7; ++i)
+                batch[i] = next + i;
+            next += ring.try_push(batch, std::min<std::uint64_t>(7, count - next));
+        }
+    });
+
+    std::uint64_t expected = 0;
+    bool ordered = true;
+    while (expected < count)
+    {
+        ring.consume([&](std::uint64_t value) { ordered &= value == expected++; }, 5);
+    }
+    producer.join();
+
+    CHECK(ordered);
+    CHECK(ring.empty());
+}
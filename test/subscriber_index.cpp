@@ -0,0 +1,135 @@
+#include <doctest/doctest.h>
+
+#include <quicr/namespace.h>
+#include <quicr/subscriber_index.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using index_t = quicr::subscriber_index<>;
+using set_t = index_t::subscriber_set;
+} // namespace
+
+TEST_CASE("quicr::subscriber_index Subscribe Tests")
+{
+    index_t index;
+    CHECK(index.empty());
+    CHECK(index.match(0x11111111111111112222222222222222_name).empty());
+
+    const quicr::Namespace conference(0x11111111111111110000000000000000_name, 64);
+    const quicr::Namespace track(0x11111111111111112222000000000000_name, 80);
+
+    CHECK(index.subscribe(conference, 3));
+    CHECK(index.subscribe(conference, 1));
+    CHECK_FALSE(index.subscribe(conference, 1));
+    CHECK(index.subscribe(track, 2));
+    CHECK(index.subscribe(track, 3));
+
+    CHECK_EQ(index.size(), 2);
+    CHECK_EQ(index.subscription_count(), 4);
+    CHECK_EQ(index.subscribers(conference), set_t{ 1, 3 });
+    CHECK_EQ(index.subscribers(track), set_t{ 2, 3 });
+    CHECK(index.subscribers({ 0x11111111111111110000000000000000_name, 72 }).empty());
+
+    CHECK_EQ(index.match(0x11111111111111112222222222222222_name), set_t{ 1, 2, 3 });
+    CHECK_EQ(index.match(0x11111111111111113333222222222222_name), set_t{ 1, 3 });
+    CHECK(index.match(0x21111111111111112222222222222222_name).empty());
+
+    CHECK(index.unsubscribe(track, 2));
+    CHECK_FALSE(index.unsubscribe(track, 2));
+    CHECK_FALSE(index.unsubscribe({ 0x11111111111111110000000000000000_name, 72 }, 1));
+    CHECK_EQ(index.match(0x11111111111111112222222222222222_name), set_t{ 1, 3 });
+
+    CHECK_EQ(index.unsubscribe(3), 2);
+    CHECK_EQ(index.size(), 1);
+    CHECK_EQ(index.subscription_count(), 1);
+    CHECK_EQ(index.match(0x11111111111111112222222222222222_name), set_t{ 1 });
+
+    CHECK(index.unsubscribe(conference, 1));
+    CHECK(index.empty());
+    CHECK(index.match(0x11111111111111112222222222222222_name).empty());
+}
+
+TEST_CASE("quicr::subscriber_index Invalidation Tests")
+{
+    index_t index;
+    const quicr::Name name = 0x11111111111111112222333344445555_name;
+    index.subscribe({ name, 96 }, 5);
+    CHECK_EQ(index.match(name), set_t{ 5 });
+
+    // Subscribing to a namespace containing a cached one drops the cached union.
+    index.subscribe({ name, 16 }, 7);
+    CHECK_EQ(index.match(name), set_t{ 5, 7 });
+    index.subscribe({ name, 0 }, 1);
+    CHECK_EQ(index.match(name), set_t{ 1, 5, 7 });
+
+    // A namespace between the longest one and the name becomes the longest.
+    index.subscribe({ name, 112 }, 6);
+    CHECK_EQ(index.match(name), set_t{ 1, 5, 6, 7 });
+    CHECK_EQ(index.match(name + 0x10000), set_t{ 1, 5, 7 });
+
+    // Subscribing to a namespace that does not contain the name keeps its union.
+    index.subscribe({ name, 128 }, 9);
+    index.subscribe({ name + 0x10000, 112 }, 8);
+    CHECK_EQ(index.match(name), set_t{ 1, 5, 6, 7, 9 });
+    CHECK_EQ(index.match(name + 0x10000), set_t{ 1, 5, 7, 8 });
+
+    index.unsubscribe({ name, 16 }, 7);
+    CHECK_EQ(index.match(name), set_t{ 1, 5, 6, 9 });
+    CHECK_EQ(index.match(name + 0x10000), set_t{ 1, 5, 8 });
+
+    const index_t copy = index;
+    index.clear();
+    CHECK(index.match(name).empty());
+
+    index_t restored = copy;
+    CHECK_EQ(restored.match(name), set_t{ 1, 5, 6, 9 });
+    restored.subscribe({ name, 8 }, 2);
+    CHECK_EQ(restored.match(name + 0x10000), set_t{ 1, 2, 5, 8 });
+    CHECK_EQ(copy.subscription_count(), 5);
+}
+
+TEST_CASE("quicr::subscriber_index Random Tests")
+{
+    std::mt19937_64 rng(5);
+    const quicr::Name base = 0xA11CEE00F00001000000000000000000_name;
+
+    index_t index;
+    std::set<std::tuple<quicr::Name, std::uint8_t, std::uint32_t>> expected;
+    const auto random_name = [&] { return base + (rng() % 4) * 0x100000000 + (rng() % 4) * 0x10000 + rng() % 4; };
+
+    for (int i = 0; i < 3000; ++i)
+    {
+        constexpr std::uint8_t lengths[] = { 0, 64, 96, 112, 128 };
+        const quicr::Namespace ns(random_name(), lengths[rng() % 5]);
+        const auto id = static_cast<std::uint32_t>(rng() % 50);
+        if (rng() % 3)
+        {
+            index.subscribe(ns, id);
+            expected.emplace(ns.name(), ns.length(), id);
+        }
+        else
+        {
+            CHECK_EQ(index.unsubscribe(ns, id), expected.erase({ ns.name(), ns.length(), id }) == 1);
+        }
+
+        const quicr::Name name = random_name();
+        std::set<std::uint32_t> subscribers;
+        for (const auto& [prefix, length, subscriber] : expected)
+        {
+            if (quicr::Namespace(prefix, length).contains(name)) subscribers.insert(subscriber);
+        }
+
+        const auto& matched = index.match(name);
+        REQUIRE(std::is_sorted(matched.begin(), matched.end()));
+        REQUIRE_EQ(matched, set_t(subscribers.begin(), subscribers.end()));
+    }
+
+    CHECK_EQ(index.subscription_count(), expected.size());
+}
@@ -0,0 +1,51 @@
+#include <doctest/doctest.h>
+
+#include <quicr/task_pool.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("quicr::task_pool Run Tests")
+{
+    for (const std::size_t threads : { 0, 1, 3 })
+    {
+        quicr::task_pool pool(threads);
+        CHECK_EQ(pool.size(), threads == 0 ? 1 : threads);
+
+        std::atomic<std::size_t> none{ 0 };
+        pool.run(0, [&](std::size_t) { ++none; });
+        CHECK_EQ(none.load(), 0);
+
+        // The threads are reused by every batch, and every task runs exactly once.
+        for (const std::size_t count : { 1, 2, 7, 1000 })
+        {
+            std::vector<std::atomic<int>> runs(count);
+            pool.run(count, [&](std::size_t i) { ++runs[i]; });
+
+            bool once = true;
+            for (const auto& n : runs)
+                once &= n == 1;
+            CHECK(once);
+        }
+    }
+}
+
+TEST_CASE("quicr::task_pool Exception Tests")
+{
+    quicr::task_pool pool(4);
+    std::atomic<std::size_t> ran{ 0 };
+    CHECK_THROWS_AS(pool.run(100,
+                             [&](std::size_t i) {
+                                 ++ran;
+                                 if (i == 42) throw std::runtime_error("task failed");
+                             }),
+                    std::runtime_error);
+    CHECK_EQ(ran.load(), 100);
+
+    // The pool keeps working after a batch fails.
+    std::atomic<std::size_t> sum{ 0 };
+    pool.run(10, [&](std::size_t i) { sum += i; });
+    CHECK_EQ(sum.load(), 45);
+}